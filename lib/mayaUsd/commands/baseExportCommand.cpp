@@ -148,6 +148,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kExportBlendShapesFlag,
         UsdMayaJobExportArgsTokens->exportBlendShapes.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kBlendShapeOffsetEpsilonFlag,
+        UsdMayaJobExportArgsTokens->blendShapeOffsetEpsilon.GetText(),
+        MSyntax::kDouble);
     syntax.addFlag(
         kParentScopeFlag, UsdMayaJobExportArgsTokens->parentScope.GetText(), MSyntax::kString);
     syntax.addFlag(
@@ -70,6 +70,7 @@ public:
     static constexpr auto kExportSkelsFlag = "skl";
     static constexpr auto kExportSkinFlag = "skn";
     static constexpr auto kExportBlendShapesFlag = "ebs";
+    static constexpr auto kBlendShapeOffsetEpsilonFlag = "bse";
     static constexpr auto kParentScopeFlag = "psc";
     static constexpr auto kRenderableOnlyFlag = "ro";
     static constexpr auto kDefaultCamerasFlag = "dc";
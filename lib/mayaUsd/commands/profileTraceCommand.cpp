@@ -0,0 +1,427 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "profileTraceCommand.h"
+
+#include <pxr/base/js/json.h>
+#include <pxr/base/trace/collector.h>
+#include <pxr/base/trace/reporter.h>
+#include <pxr/base/trace/reporterDataSourceCollector.h>
+
+#include <maya/MAnimControl.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MArgList.h>
+#include <maya/MGlobal.h>
+#include <maya/MProfiler.h>
+#include <maya/MStringArray.h>
+#include <maya/MSyntax.h>
+#include <maya/MTime.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+const char kFileFlag[] = "f";
+const char kFileFlagL[] = "file";
+const char kFramesFlag[] = "fr";
+const char kFramesFlagL[] = "frames";
+const char kStartFrameFlag[] = "sf";
+const char kStartFrameFlagL[] = "startFrame";
+const char kCategoryFlag[] = "c";
+const char kCategoryFlagL[] = "category";
+const char kUsdTraceFlag[] = "ut";
+const char kUsdTraceFlagL[] = "usdTrace";
+
+// Profiler categories registered by mayaUsd and by the AL plugin. The AL
+// categories with generic names that Maya may also use ("Mesh", "Camera",
+// "Transform"...) are left out; they can be requested with -category.
+const char* const kDefaultCategories[] = { "ProxyShapeBase",
+                                           "ProxyAccessor",
+                                           "HdVP2RenderDelegate",
+                                           "UsdMayaGLBatchRenderer",
+                                           "AL_usdmaya_ProxyShape",
+                                           "AL_usdmaya_ProxyShape_selection",
+                                           "AL_usdmaya_ProxyShape_variant_fallbacks",
+                                           "AnimationTranslator",
+                                           "LayerManager",
+                                           "MayaReference",
+                                           "PrimFIlter",
+                                           "StageCache",
+                                           "TransformationMatrix",
+                                           "TranslatorContext",
+                                           "TranslatorManufacture" };
+
+// The recordings of Maya and USD have unrelated time origins, so they are
+// shown as two processes.
+const int kMayaProcessId = 0;
+const int kUsdProcessId = 1;
+
+void reportError(const MString& errorString) { MGlobal::displayError(errorString); }
+
+// Aggregated durations, in microseconds, of all the events of one scope.
+struct ScopeStats
+{
+    size_t count = 0;
+    double total = 0.0;
+    double min = std::numeric_limits<double>::max();
+    double max = 0.0;
+
+    void add(double duration)
+    {
+        ++count;
+        total += duration;
+        min = std::min(min, duration);
+        max = std::max(max, duration);
+    }
+};
+
+// Keyed by category, then scope name.
+using ScopeStatsMap = std::map<std::pair<std::string, std::string>, ScopeStats>;
+
+double getNumber(const JsValue& value)
+{
+    if (value.IsInt()) {
+        return static_cast<double>(value.GetInt64());
+    }
+    return value.IsReal() ? value.GetReal() : 0.0;
+}
+
+std::string getString(const JsObject& object, const char* key)
+{
+    auto it = object.find(key);
+    return (it != object.end() && it->second.IsString()) ? it->second.GetString() : std::string();
+}
+
+JsValue makeProcessName(int processId, const char* name)
+{
+    JsObject args;
+    args["name"] = JsValue(std::string(name));
+
+    JsObject event;
+    event["name"] = JsValue(std::string("process_name"));
+    event["ph"] = JsValue(std::string("M"));
+    event["pid"] = JsValue(processId);
+    event["args"] = JsValue(args);
+    return JsValue(event);
+}
+
+// Appends the profiler events from firstEvent on, which were recorded by the command.
+void appendMayaEvents(
+    int                  firstEvent,
+    const std::set<int>& categories,
+    const MStringArray&  categoryNames,
+    JsArray&             events,
+    ScopeStatsMap&       stats)
+{
+    const int eventCount = MProfiler::getEventCount();
+    for (int i = firstEvent; i < eventCount; ++i) {
+        const int category = MProfiler::getEventCategory(i);
+        if (categories.find(category) == categories.end()) {
+            continue;
+        }
+
+        const char*       eventName = MProfiler::getEventName(i);
+        const std::string name = eventName ? eventName : "";
+        const std::string categoryName = categoryNames[category].asChar();
+        const double      start = static_cast<double>(MProfiler::getEventTime(i));
+
+        JsObject event;
+        event["name"] = JsValue(name);
+        event["cat"] = JsValue(categoryName);
+        event["ts"] = JsValue(start);
+        event["pid"] = JsValue(kMayaProcessId);
+        event["tid"] = JsValue(MProfiler::getThreadId(i));
+
+        if (const char* description = MProfiler::getDescription(i)) {
+            JsObject args;
+            args["description"] = JsValue(std::string(description));
+            event["args"] = JsValue(args);
+        }
+
+        if (MProfiler::isSignalEvent(i)) {
+            event["ph"] = JsValue(std::string("i"));
+            event["s"] = JsValue(std::string("t"));
+        } else {
+            const double duration = static_cast<double>(MProfiler::getEventDuration(i));
+            event["ph"] = JsValue(std::string("X"));
+            event["dur"] = JsValue(duration);
+            stats[std::make_pair(categoryName, name)].add(duration);
+        }
+
+        events.push_back(JsValue(event));
+    }
+}
+
+// Appends the events of a Chrome trace written by the USD TraceReporter,
+// accumulating the duration of both complete events and begin/end pairs.
+void appendUsdEvents(const std::string& usdTrace, JsArray& events, ScopeStatsMap& stats)
+{
+    JsParseError parseError;
+    const JsValue trace = JsParseString(usdTrace, &parseError);
+    if (!trace.IsObject()) {
+        MGlobal::displayWarning(
+            MString("Could not read the USD trace: ") + parseError.reason.c_str());
+        return;
+    }
+
+    const JsObject& traceObject = trace.GetJsObject();
+    auto            traceEventsIt = traceObject.find("traceEvents");
+    if (traceEventsIt == traceObject.end() || !traceEventsIt->second.IsArray()) {
+        return;
+    }
+
+    // Begin events waiting for their end, per thread.
+    std::map<std::string, std::vector<std::pair<std::string, double>>> openScopes;
+
+    for (const JsValue& value : traceEventsIt->second.GetJsArray()) {
+        if (!value.IsObject()) {
+            continue;
+        }
+
+        JsObject          event = value.GetJsObject();
+        const std::string phase = getString(event, "ph");
+        const std::string name = getString(event, "name");
+        const std::string thread = JsWriteToString(event["tid"]);
+
+        if (phase == "X") {
+            stats[std::make_pair(std::string("USD"), name)].add(getNumber(event["dur"]));
+        } else if (phase == "B") {
+            openScopes[thread].emplace_back(name, getNumber(event["ts"]));
+        } else if (phase == "E") {
+            auto& scopes = openScopes[thread];
+            if (!scopes.empty()) {
+                const double duration = getNumber(event["ts"]) - scopes.back().second;
+                stats[std::make_pair(std::string("USD"), scopes.back().first)].add(duration);
+                scopes.pop_back();
+            }
+        }
+
+        event["pid"] = JsValue(kUsdProcessId);
+        events.push_back(JsValue(event));
+    }
+}
+
+JsArray makeStatsArray(const ScopeStatsMap& stats)
+{
+    std::vector<ScopeStatsMap::const_iterator> sorted;
+    sorted.reserve(stats.size());
+    for (auto it = stats.begin(); it != stats.end(); ++it) {
+        sorted.push_back(it);
+    }
+
+    // Most expensive scopes first.
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a->second.total > b->second.total;
+    });
+
+    JsArray statsArray;
+    statsArray.reserve(sorted.size());
+    for (const auto& it : sorted) {
+        const ScopeStats& scopeStats = it->second;
+
+        JsObject entry;
+        entry["category"] = JsValue(it->first.first);
+        entry["name"] = JsValue(it->first.second);
+        entry["count"] = JsValue(static_cast<uint64_t>(scopeStats.count));
+        entry["totalUs"] = JsValue(scopeStats.total);
+        entry["minUs"] = JsValue(scopeStats.min);
+        entry["maxUs"] = JsValue(scopeStats.max);
+        entry["meanUs"] = JsValue(scopeStats.total / scopeStats.count);
+        statsArray.push_back(JsValue(entry));
+    }
+    return statsArray;
+}
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+const char ProfileTraceCommand::commandName[] = "mayaUsdProfileTrace";
+
+// plug-in callback to create the command object
+void* ProfileTraceCommand::creator() { return static_cast<MPxCommand*>(new ProfileTraceCommand()); }
+
+// plug-in callback to register the command syntax
+MSyntax ProfileTraceCommand::createSyntax()
+{
+    MSyntax syntax;
+
+    syntax.addFlag(kFileFlag, kFileFlagL, MSyntax::kString);
+    syntax.addFlag(kFramesFlag, kFramesFlagL, MSyntax::kLong);
+    syntax.addFlag(kStartFrameFlag, kStartFrameFlagL, MSyntax::kDouble);
+    syntax.addFlag(kCategoryFlag, kCategoryFlagL, MSyntax::kString);
+    syntax.makeFlagMultiUse(kCategoryFlag);
+    syntax.addFlag(kUsdTraceFlag, kUsdTraceFlagL, MSyntax::kBoolean);
+
+    syntax.enableQuery(false);
+    syntax.enableEdit(false);
+
+    return syntax;
+}
+
+// main MPxCommand execution point
+MStatus ProfileTraceCommand::doIt(const MArgList& argList)
+{
+    setCommandString(commandName);
+    clearResult();
+
+    MStatus      status;
+    MArgDatabase argData(syntax(), argList, &status);
+    if (!status) {
+        return MS::kInvalidParameter;
+    }
+
+    if (!argData.isFlagSet(kFileFlag)) {
+        reportError("The -file flag is required.");
+        return MS::kInvalidParameter;
+    }
+    const MString fileName = argData.flagArgumentString(kFileFlag, 0);
+
+    int frames = 10;
+    if (argData.isFlagSet(kFramesFlag)) {
+        frames = argData.flagArgumentInt(kFramesFlag, 0);
+        if (frames < 1) {
+            reportError("The -frames flag must be at least 1.");
+            return MS::kInvalidParameter;
+        }
+    }
+
+    double startFrame = MAnimControl::minTime().value();
+    if (argData.isFlagSet(kStartFrameFlag)) {
+        startFrame = argData.flagArgumentDouble(kStartFrameFlag, 0);
+    }
+
+    bool recordUsdTrace = true;
+    if (argData.isFlagSet(kUsdTraceFlag)) {
+        recordUsdTrace = argData.flagArgumentBool(kUsdTraceFlag, 0);
+    }
+
+    std::vector<std::string> categoryNames;
+    const unsigned int       categoryFlagUses = argData.numberOfFlagUses(kCategoryFlag);
+    if (categoryFlagUses > 0) {
+        for (unsigned int i = 0; i < categoryFlagUses; ++i) {
+            MArgList categoryArgs;
+            argData.getFlagArgumentList(kCategoryFlag, i, categoryArgs);
+            categoryNames.emplace_back(categoryArgs.asString(0).asChar());
+        }
+    } else {
+        categoryNames.assign(std::begin(kDefaultCategories), std::end(kDefaultCategories));
+    }
+
+    // Categories only exist once the code that registers them is loaded, so
+    // the missing default ones are silently ignored.
+    MStringArray allCategories;
+    MProfiler::getAllCategories(allCategories);
+    std::set<int> categories;
+    for (const std::string& categoryName : categoryNames) {
+        bool found = false;
+        for (unsigned int i = 0; i < allCategories.length(); ++i) {
+            if (categoryName == allCategories[i].asChar()) {
+                categories.insert(static_cast<int>(i));
+                found = true;
+                break;
+            }
+        }
+        if (!found && categoryFlagUses > 0) {
+            MGlobal::displayWarning(
+                MString("Unknown profiler category \"") + categoryName.c_str() + "\"");
+        }
+    }
+
+    if (categories.empty() && !recordUsdTrace) {
+        reportError("Nothing to record: no known profiler category and no USD trace.");
+        return MS::kInvalidParameter;
+    }
+
+    // Enable the requested categories, remembering their previous state.
+    std::vector<std::pair<int, bool>> previousCategoryStates;
+    for (int category : categories) {
+        previousCategoryStates.emplace_back(category, MProfiler::categoryRecording(category));
+        MProfiler::setCategoryRecording(category, true);
+    }
+
+    // The USD trace is reported by a reporter of its own, which only receives the trace
+    // collected from now on, so that the data of the global reporter is kept.
+    TraceCollector&  collector = TraceCollector::GetInstance();
+    TraceReporterPtr reporter;
+    const bool       wasTracing = collector.IsEnabled();
+    if (recordUsdTrace) {
+        collector.CreateCollection();
+        reporter = TraceReporter::New(commandName, TraceReporterDataSourceCollector::New());
+        collector.SetEnabled(true);
+    }
+
+    // Likewise, the profiler data already recorded in the session is kept, and only the events
+    // added from now on are reported.
+    const bool wasRecording = MProfiler::isRecordingActive();
+    const int  firstEvent = MProfiler::getEventCount();
+    MProfiler::setRecordingActive(true);
+
+    const MTime oldCurTime = MAnimControl::currentTime();
+    for (int i = 0; i < frames; ++i) {
+        MGlobal::viewFrame(MTime(startFrame + i, MTime::uiUnit()));
+    }
+
+    MProfiler::setRecordingActive(wasRecording);
+
+    std::ostringstream usdTrace;
+    if (recordUsdTrace) {
+        collector.SetEnabled(wasTracing);
+        reporter->ReportChromeTracing(usdTrace);
+    }
+
+    MGlobal::viewFrame(oldCurTime);
+
+    for (const auto& categoryState : previousCategoryStates) {
+        MProfiler::setCategoryRecording(categoryState.first, categoryState.second);
+    }
+
+    JsArray       events;
+    ScopeStatsMap stats;
+    events.push_back(makeProcessName(kMayaProcessId, "Maya"));
+    appendMayaEvents(firstEvent, categories, allCategories, events, stats);
+    if (recordUsdTrace) {
+        events.push_back(makeProcessName(kUsdProcessId, "USD"));
+        appendUsdEvents(usdTrace.str(), events, stats);
+    }
+
+    JsObject report;
+    report["traceEvents"] = JsValue(events);
+    report["displayTimeUnit"] = JsValue(std::string("ms"));
+    report["frames"] = JsValue(frames);
+    report["stats"] = JsValue(makeStatsArray(stats));
+
+    std::ofstream reportFile(fileName.asChar());
+    if (!reportFile) {
+        reportError(MString("Could not write the profile trace to \"") + fileName + "\"");
+        return MS::kFailure;
+    }
+    JsWriteToStream(JsValue(report), reportFile);
+
+    setResult(fileName);
+    return MS::kSuccess;
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,56 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef MAYAUSD_COMMANDS_PROFILE_TRACE_COMMAND_H
+#define MAYAUSD_COMMANDS_PROFILE_TRACE_COMMAND_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/mayaUsd.h>
+
+#include <maya/MPxCommand.h>
+
+namespace MAYAUSD_NS_DEF {
+
+//! \brief Plays back a number of frames while recording the mayaUsd profiler
+//! categories, and USD trace scopes, then writes them to a Chrome trace file.
+//!
+//! The written JSON file can be opened in chrome://tracing or Perfetto. Besides
+//! the trace events, it holds per-scope aggregate statistics so that recordings
+//! from different builds can be compared without a GUI.
+class ProfileTraceCommand : public MPxCommand
+{
+public:
+    // plugin registration requirements
+    MAYAUSD_CORE_PUBLIC
+    static const char commandName[];
+
+    MAYAUSD_CORE_PUBLIC
+    static void* creator();
+
+    MAYAUSD_CORE_PUBLIC
+    static MSyntax createSyntax();
+
+    // MPxCommand callbacks
+    MAYAUSD_CORE_PUBLIC
+    MStatus doIt(const MArgList& argList) override;
+
+    MAYAUSD_CORE_PUBLIC
+    bool isUndoable() const override { return false; }
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_COMMANDS_PROFILE_TRACE_COMMAND_H
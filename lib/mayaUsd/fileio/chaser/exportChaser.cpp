@@ -29,6 +29,20 @@ bool UsdMayaExportChaser::ExportFrame(const UsdTimeCode& time)
     return true;
 }
 
+UsdMayaExportChaser::SampledPlugs UsdMayaExportChaser::GetSampledPlugs()
+{
+    // Export each frame by default.
+    return SampledPlugs();
+}
+
+bool UsdMayaExportChaser::ExportFrames(
+    const std::vector<UsdTimeCode>&          times,
+    const std::vector<std::vector<VtValue>>& values)
+{
+    // Do nothing by default.
+    return true;
+}
+
 bool UsdMayaExportChaser::PostExport()
 {
     // Do nothing by default.
@@ -20,9 +20,15 @@
 
 #include <pxr/base/tf/declarePtrs.h>
 #include <pxr/base/tf/refPtr.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/valueTypeName.h>
 #include <pxr/usd/usd/timeCode.h>
 
+#include <maya/MPlug.h>
+
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DECLARE_REF_PTRS(UsdMayaExportChaser);
@@ -36,6 +42,11 @@ TF_DECLARE_REF_PTRS(UsdMayaExportChaser);
 /// after the core process the given frame, all the chasers will be invoked to
 /// process that frame.
 ///
+/// Chasers that only need the values of some Maya plugs at each frame can
+/// instead return them from GetSampledPlugs(). The export then samples them
+/// while it evaluates each frame, and gives all the samples to ExportFrames()
+/// after the last frame, so that the chaser can author them in a single pass.
+///
 /// The key difference between these and the mel/python postScripts is that a
 /// chaser can have direct access to the core usdExport context.
 ///
@@ -62,6 +73,33 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual bool ExportFrame(const UsdTimeCode& time);
 
+    /// A plug sampled at each exported frame, and the type of the USD values
+    /// its samples are converted to.
+    struct SampledPlug
+    {
+        MPlug            plug;
+        SdfValueTypeName typeName;
+    };
+    typedef std::vector<SampledPlug> SampledPlugs;
+
+    /// Gets the plugs whose values are needed at each exported frame.
+    /// When plugs are returned, ExportFrame() is not called: the values of
+    /// the plugs are given to ExportFrames() instead.
+    /// This is called once, after ExportDefault().
+    /// The base implementation returns no plugs.
+    MAYAUSD_CORE_PUBLIC
+    virtual SampledPlugs GetSampledPlugs();
+
+    /// Do custom processing of all the exported frames at once, after
+    /// UsdMaya has exported data at all the \p times.
+    /// \p values holds, for each plug returned by GetSampledPlugs(), its
+    /// values at each of the \p times.
+    /// Returning false will terminate the whole export.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool ExportFrames(
+        const std::vector<UsdTimeCode>&          times,
+        const std::vector<std::vector<VtValue>>& values);
+
     /// Do custom post-processing that needs to run after the main UsdMaya
     /// export loop.
     /// At this point, all data has been authored to the stage (except for
@@ -59,6 +59,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (frameStride) \
     (frameSample) \
     (apiSchema) \
+    (blendShapeOffsetEpsilon) \
     (chaser) \
     (chaserArgs) \
     (compatibility) \
@@ -191,6 +192,11 @@ struct UsdMayaJobExportArgs
     const TfToken     exportSkels;
     const TfToken     exportSkin;
     const bool        exportBlendShapes;
+
+    /// If greater than zero, blend shape offsets whose point and normal
+    /// components are all within this tolerance are dropped on export, so
+    /// that only the affected components are written to `pointIndices`.
+    const double      blendShapeOffsetEpsilon;
     const bool        exportVisibility;
     const bool        exportComponentTags;
     const std::string file;
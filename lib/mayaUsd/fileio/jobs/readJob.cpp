@@ -16,6 +16,7 @@
 #include "readJob.h"
 
 #include <mayaUsd/fileio/chaser/importChaserRegistry.h>
+#include <mayaUsd/fileio/jobs/translatorProfiler.h>
 #include <mayaUsd/fileio/primReaderRegistry.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
@@ -410,9 +411,21 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
         }
     }
 
+    if (UsdMaya_TranslatorProfiler::IsRequested()) {
+        _profiler.reset(new UsdMaya_TranslatorProfiler("usdImport"));
+    }
+
     DoImport(range, usdRootPrim);
     progressBar.advance();
 
+    if (_profiler) {
+        const std::string reportPath = _profiler->WriteReport();
+        if (!reportPath.empty()) {
+            TF_STATUS("Translator profile written to '%s'", reportPath.c_str());
+        }
+        _profiler.reset();
+    }
+
     // NOTE: (yliangsiew) Storage to later pass on to `PostImport` for import chasers.
     MDagPathArray currentAddedDagPaths;
     SdfPathVector fromSdfPaths;
@@ -502,6 +515,11 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
         // specified one.
         auto primReaderIt = primReaderMap.find(prim.GetPath());
         if (primReaderIt != primReaderMap.end()) {
+            UsdMaya_TranslatorProfiler::Scope profilerScope(
+                _profiler.get(),
+                UsdMaya_TranslatorProfiler::Phase::PostReadSubtree,
+                typeid(*primReaderIt->second),
+                prim.GetPath());
             primReaderIt->second->PostReadSubtree(readCtx);
         }
     } else {
@@ -517,7 +535,14 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
             UsdMayaPrimReaderSharedPtr primReader = factoryFn(args);
             if (primReader) {
                 TempNodeTrackerScope scope(readCtx);
-                primReader->Read(readCtx);
+                {
+                    UsdMaya_TranslatorProfiler::Scope profilerScope(
+                        _profiler.get(),
+                        UsdMaya_TranslatorProfiler::Phase::Read,
+                        typeid(*primReader),
+                        prim.GetPath());
+                    primReader->Read(readCtx);
+                }
                 if (primReader->HasPostReadSubtree()) {
                     primReaderMap[prim.GetPath()] = primReader;
                 }
@@ -30,12 +30,14 @@
 #include <maya/MDagPath.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class UsdMayaPrimReaderArgs;
+class UsdMaya_TranslatorProfiler;
 
 class UsdMaya_ReadJob
 {
@@ -139,6 +141,9 @@ private:
     /// Cache of import chasers that were run. Currently used to aid in redo/undo operations
     /// This cache is cleared for every new Read() operation.
     UsdMayaImportChaserRefPtrVector mImportChasers;
+
+    // Only set while importing when translator profiling was requested.
+    std::unique_ptr<UsdMaya_TranslatorProfiler> _profiler;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,261 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "translatorProfiler.h"
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/arch/timing.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/mallocTag.h>
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <maya/MUuid.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_TRANSLATOR_PROFILE_DIR,
+    "",
+    "When set to a directory, every USD export and import job writes a JSON "
+    "report there with the time spent in each prim writer and prim reader call.");
+
+namespace {
+
+const char* _GetPhaseName(UsdMaya_TranslatorProfiler::Phase phase)
+{
+    switch (phase) {
+    case UsdMaya_TranslatorProfiler::Phase::Write: return "Write";
+    case UsdMaya_TranslatorProfiler::Phase::PostExport: return "PostExport";
+    case UsdMaya_TranslatorProfiler::Phase::Read: return "Read";
+    case UsdMaya_TranslatorProfiler::Phase::PostReadSubtree: return "PostReadSubtree";
+    }
+    return "Unknown";
+}
+
+double _TicksToMicroseconds(uint64_t ticks)
+{
+    return static_cast<double>(ArchTicksToNanoseconds(ticks)) / 1000.0;
+}
+
+int64_t _GetHeapBytes(bool trackMemory)
+{
+    return trackMemory ? static_cast<int64_t>(TfMallocTag::GetTotalBytes()) : 0;
+}
+
+// Aggregated statistics for one phase of a translator type or of a prim.
+struct _PhaseStats
+{
+    size_t   calls = 0;
+    uint64_t totalTicks = 0;
+    uint64_t maxTicks = 0;
+    int64_t  bytes = 0;
+
+    void Add(uint64_t ticks, int64_t eventBytes)
+    {
+        ++calls;
+        totalTicks += ticks;
+        maxTicks = std::max(maxTicks, ticks);
+        bytes += eventBytes;
+    }
+
+    JsObject ToJson(bool trackMemory) const
+    {
+        JsObject stats;
+        stats["calls"] = JsValue(static_cast<uint64_t>(calls));
+        stats["totalMs"] = JsValue(_TicksToMicroseconds(totalTicks) / 1000.0);
+        stats["maxMs"] = JsValue(_TicksToMicroseconds(maxTicks) / 1000.0);
+        if (trackMemory) {
+            stats["bytes"] = JsValue(bytes);
+        }
+        return stats;
+    }
+};
+
+using _PhaseStatsMap = std::map<UsdMaya_TranslatorProfiler::Phase, _PhaseStats>;
+
+} // namespace
+
+UsdMaya_TranslatorProfiler::UsdMaya_TranslatorProfiler(const std::string& jobName)
+    : _jobName(jobName)
+    , _originTicks(ArchGetTickTime())
+    , _trackMemory(TfMallocTag::IsInitialized())
+{
+}
+
+/* static */
+bool UsdMaya_TranslatorProfiler::IsRequested()
+{
+    return !TfGetEnvSetting(MAYAUSD_TRANSLATOR_PROFILE_DIR).empty();
+}
+
+UsdMaya_TranslatorProfiler::Scope::Scope(
+    UsdMaya_TranslatorProfiler* profiler,
+    Phase                       phase,
+    const std::type_info&       translatorType,
+    const SdfPath&              primPath)
+    : _profiler(profiler)
+    , _phase(phase)
+    , _translatorType(translatorType)
+    , _startTicks(0)
+    , _startBytes(0)
+{
+    if (_profiler) {
+        _primPath = primPath;
+        _startBytes = _GetHeapBytes(_profiler->_trackMemory);
+        _startTicks = ArchGetTickTime();
+    }
+}
+
+UsdMaya_TranslatorProfiler::Scope::~Scope()
+{
+    if (_profiler) {
+        const uint64_t endTicks = ArchGetTickTime();
+        const int64_t  bytes = _GetHeapBytes(_profiler->_trackMemory) - _startBytes;
+        _profiler->_Record(_phase, _translatorType, _primPath, _startTicks, endTicks, bytes);
+    }
+}
+
+void UsdMaya_TranslatorProfiler::_Record(
+    Phase                 phase,
+    const std::type_info& translatorType,
+    const SdfPath&        primPath,
+    uint64_t              startTicks,
+    uint64_t              endTicks,
+    int64_t               bytes)
+{
+    // Demangling is costly, so only do it once per translator type.
+    auto found = _translatorIndices.find(std::type_index(translatorType));
+    if (found == _translatorIndices.end()) {
+        found = _translatorIndices
+                    .emplace(
+                        std::type_index(translatorType),
+                        static_cast<uint32_t>(_translatorNames.size()))
+                    .first;
+        _translatorNames.push_back(ArchGetDemangled(translatorType));
+    }
+
+    _events.push_back(
+        { primPath, startTicks, endTicks - startTicks, bytes, found->second, phase });
+}
+
+std::string UsdMaya_TranslatorProfiler::WriteReport() const
+{
+    const std::string profileDir = TfGetEnvSetting(MAYAUSD_TRANSLATOR_PROFILE_DIR);
+    if (profileDir.empty()) {
+        return std::string();
+    }
+
+    if (!TfIsDir(profileDir) && !TfMakeDirs(profileDir, -1, true)) {
+        TF_WARN("Could not create translator profile directory '%s'", profileDir.c_str());
+        return std::string();
+    }
+
+    // Merged transform and shape writers share their prim path, so the prim statistics are kept
+    // per translator.
+    std::vector<_PhaseStatsMap>                            translatorStats(_translatorNames.size());
+    std::map<std::pair<SdfPath, uint32_t>, _PhaseStatsMap> primStats;
+
+    JsArray traceEvents;
+    traceEvents.reserve(_events.size());
+    for (const _Event& event : _events) {
+        translatorStats[event.translatorIndex][event.phase].Add(event.durationTicks, event.bytes);
+        primStats[std::make_pair(event.primPath, event.translatorIndex)][event.phase].Add(
+            event.durationTicks, event.bytes);
+
+        JsObject args;
+        args["prim"] = JsValue(event.primPath.GetString());
+        if (_trackMemory) {
+            args["bytes"] = JsValue(event.bytes);
+        }
+
+        // Complete ("X") events, in the Chrome trace event format.
+        JsObject traceEvent;
+        traceEvent["name"] = JsValue(_translatorNames[event.translatorIndex]);
+        traceEvent["cat"] = JsValue(std::string(_GetPhaseName(event.phase)));
+        traceEvent["ph"] = JsValue(std::string("X"));
+        traceEvent["ts"] = JsValue(_TicksToMicroseconds(event.startTicks - _originTicks));
+        traceEvent["dur"] = JsValue(_TicksToMicroseconds(event.durationTicks));
+        traceEvent["pid"] = JsValue(0);
+        traceEvent["tid"] = JsValue(0);
+        traceEvent["args"] = JsValue(args);
+        traceEvents.push_back(JsValue(traceEvent));
+    }
+
+    JsObject translators;
+    for (size_t i = 0; i < _translatorNames.size(); ++i) {
+        JsObject phases;
+        for (const auto& phaseStats : translatorStats[i]) {
+            phases[_GetPhaseName(phaseStats.first)]
+                = JsValue(phaseStats.second.ToJson(_trackMemory));
+        }
+        translators[_translatorNames[i]] = JsValue(phases);
+    }
+
+    // The entries of a prim are consecutive in the map, so each prim object is completed before
+    // moving on to the next one.
+    JsObject prims;
+    for (auto primIter = primStats.begin(); primIter != primStats.end();) {
+        const SdfPath& primPath = primIter->first.first;
+        JsObject       primTranslators;
+        for (; primIter != primStats.end() && primIter->first.first == primPath; ++primIter) {
+            JsObject phases;
+            for (const auto& phaseStats : primIter->second) {
+                phases[_GetPhaseName(phaseStats.first)]
+                    = JsValue(phaseStats.second.ToJson(_trackMemory));
+            }
+            primTranslators[_translatorNames[primIter->first.second]] = JsValue(phases);
+        }
+        prims[primPath.GetString()] = JsValue(primTranslators);
+    }
+
+    JsObject summary;
+    summary["job"] = JsValue(_jobName);
+    summary["translators"] = JsValue(translators);
+    summary["prims"] = JsValue(prims);
+    if (_trackMemory) {
+        summary["peakHeapBytes"]
+            = JsValue(static_cast<uint64_t>(TfMallocTag::GetMaxTotalBytes()));
+    }
+
+    JsObject report;
+    report["traceEvents"] = JsValue(traceEvents);
+    report["displayTimeUnit"] = JsValue(std::string("ms"));
+    report["summary"] = JsValue(summary);
+
+    MUuid uuid;
+    uuid.generate();
+    const std::string reportPath = TfStringCatPaths(
+        profileDir, TfStringPrintf("%s_%s.json", _jobName.c_str(), uuid.asString().asChar()));
+
+    std::ofstream reportFile(reportPath);
+    if (!reportFile) {
+        TF_WARN("Could not write translator profile '%s'", reportPath.c_str());
+        return std::string();
+    }
+    JsWriteToStream(JsValue(report), reportFile);
+
+    return reportPath;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,127 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_TRANSLATOR_PROFILER_H
+#define PXRUSDMAYA_TRANSLATOR_PROFILER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Records how long every prim writer and prim reader call of a write or read
+/// job takes, so that slow translators can be found on production scenes.
+///
+/// Profiling is off by default. Setting the MAYAUSD_TRANSLATOR_PROFILE_DIR
+/// environment variable to a directory turns it on: every export and import
+/// job then writes a JSON report into that directory. The report is a Chrome
+/// trace (its "traceEvents" load directly in chrome://tracing or Perfetto)
+/// with one event per translator call, plus a "summary" object aggregating the
+/// call count, total and maximum time per translator type and phase, and per
+/// prim and translator type.
+///
+/// When TfMallocTag has been initialized, the net heap growth of each call is
+/// recorded as well, along with the peak heap size of the session.
+class UsdMaya_TranslatorProfiler
+{
+public:
+    enum class Phase : uint8_t
+    {
+        Write,
+        PostExport,
+        Read,
+        PostReadSubtree
+    };
+
+    /// Creates a profiler for a job named \p jobName, used to name the report.
+    MAYAUSD_CORE_PUBLIC
+    explicit UsdMaya_TranslatorProfiler(const std::string& jobName);
+
+    /// Returns true if translator profiling was requested for this session.
+    MAYAUSD_CORE_PUBLIC
+    static bool IsRequested();
+
+    /// Times one translator call for as long as it is in scope. Does nothing
+    /// when \p profiler is null, so call sites don't need to check whether
+    /// profiling is on.
+    class Scope
+    {
+    public:
+        MAYAUSD_CORE_PUBLIC
+        Scope(
+            UsdMaya_TranslatorProfiler* profiler,
+            Phase                       phase,
+            const std::type_info&       translatorType,
+            const SdfPath&              primPath);
+
+        MAYAUSD_CORE_PUBLIC
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        UsdMaya_TranslatorProfiler* _profiler;
+        Phase                       _phase;
+        const std::type_info&       _translatorType;
+        SdfPath                     _primPath;
+        uint64_t                    _startTicks;
+        int64_t                     _startBytes;
+    };
+
+    /// Writes the report into the profile directory. Returns the path of the
+    /// written file, or an empty string on failure.
+    MAYAUSD_CORE_PUBLIC
+    std::string WriteReport() const;
+
+private:
+    struct _Event
+    {
+        SdfPath  primPath;
+        uint64_t startTicks;
+        uint64_t durationTicks;
+        int64_t  bytes;
+        uint32_t translatorIndex;
+        Phase    phase;
+    };
+
+    void _Record(
+        Phase                 phase,
+        const std::type_info& translatorType,
+        const SdfPath&        primPath,
+        uint64_t              startTicks,
+        uint64_t              endTicks,
+        int64_t               bytes);
+
+    std::string _jobName;
+    uint64_t    _originTicks;
+    bool        _trackMemory;
+
+    std::unordered_map<std::type_index, uint32_t> _translatorIndices;
+    std::vector<std::string>                       _translatorNames;
+    std::vector<_Event>                            _events;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
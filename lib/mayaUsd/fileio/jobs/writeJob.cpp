@@ -35,13 +35,16 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDag.h>
 #include <maya/MObjectArray.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPxNode.h>
 #include <maya/MStatus.h>
 #include <maya/MUuid.h>
 
+#include <chrono>
 #include <limits>
 #include <map>
 #include <unordered_set>
+#include <vector>
 // Needed for directly removing a UsdVariant via Sdf
 //   Remove when UsdVariantSet::RemoveVariant() is exposed
 //   XXX [bug 75864]
@@ -49,11 +52,13 @@
 #include <mayaUsd/fileio/chaser/exportChaserRegistry.h>
 #include <mayaUsd/fileio/jobs/jobArgs.h>
 #include <mayaUsd/fileio/jobs/modelKindProcessor.h>
+#include <mayaUsd/fileio/jobs/translatorProfiler.h>
 #include <mayaUsd/fileio/primWriter.h>
 #include <mayaUsd/fileio/primWriterRegistry.h>
 #include <mayaUsd/fileio/shading/shadingModeExporterContext.h>
 #include <mayaUsd/fileio/transformWriter.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
+#include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/utils/progressBarScope.h>
 #include <mayaUsd/utils/util.h>
 
@@ -82,11 +87,75 @@ UsdMaya_WriteJob::~UsdMaya_WriteJob() { }
 SdfPath UsdMaya_WriteJob::MapDagPathToSdfPath(const MDagPath& dagPath) const
 {
     SdfPath usdPrimPath;
-    TfMapLookup(mDagPathToUsdPathMap, dagPath, &usdPrimPath);
+    if (!dagPath.isInstanced()) {
+        TfMapLookup(mDagNodeToUsdPathMap, MObjectHandle(dagPath.node()), &usdPrimPath);
+    } else {
+        TfMapLookup(mDagPathToUsdPathMap, dagPath, &usdPrimPath);
+    }
 
     return usdPrimPath;
 }
 
+namespace {
+
+/// Set of DAG paths identified by their node handle, which is much cheaper
+/// to get and hash than a path name. Instanced nodes can be reached through
+/// several DAG paths, so these are identified by their partial path name
+/// instead, which Maya guarantees to be unique.
+class _DagPathSet
+{
+public:
+    /// Returns false if \p dagPath was already in the set.
+    bool Insert(const MDagPath& dagPath)
+    {
+        if (dagPath.isInstanced()) {
+            return _instancedPaths.insert(dagPath.partialPathName().asChar()).second;
+        }
+        return _nodes.insert(MObjectHandle(dagPath.node())).second;
+    }
+
+    bool Contains(const MDagPath& dagPath) const
+    {
+        if (dagPath.isInstanced()) {
+            return _instancedPaths.count(dagPath.partialPathName().asChar()) > 0;
+        }
+        return _nodes.count(MObjectHandle(dagPath.node())) > 0;
+    }
+
+private:
+    UsdMayaUtil::MObjectHandleUnorderedSet _nodes;
+    TfHashSet<std::string, TfHash>         _instancedPaths;
+};
+
+/// Measures the time spent in each phase of an export, for the export log.
+class _PhaseTimer
+{
+public:
+    /// Ends the current phase, and starts the next one.
+    void EndPhase(const char* name)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        _phases.emplace_back(name, std::chrono::duration<double>(now - _start).count());
+        _start = now;
+    }
+
+    /// Returns the phase timings, e.g. "setup 0.01s, DAG traversal 1.20s".
+    std::string GetReport() const
+    {
+        std::vector<std::string> phases;
+        for (const auto& phase : _phases) {
+            phases.push_back(TfStringPrintf("%s %.2fs", phase.first, phase.second));
+        }
+        return TfStringJoin(phases, ", ");
+    }
+
+private:
+    std::chrono::steady_clock::time_point       _start { std::chrono::steady_clock::now() };
+    std::vector<std::pair<const char*, double>> _phases;
+};
+
+} // namespace
+
 /// Generates a name for a temporary usdc file in \p dir.
 /// Unless you are very, very unlucky, the stage name is unique because it's
 /// generated from a UUID.
@@ -123,6 +192,10 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
     int                       nbSteps = 1 + timeSamples.size();
     MayaUsd::ProgressBarScope progressBar(showProgress, true /*interruptible */, nbSteps, "");
 
+    if (UsdMaya_TranslatorProfiler::IsRequested()) {
+        _profiler.reset(new UsdMaya_TranslatorProfiler("usdExport"));
+    }
+
     // Default-time export.
     if (!_BeginWriting(fileName, append)) {
         return false;
@@ -153,6 +226,10 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 
         // Set the time back.
         MGlobal::viewFrame(oldCurTime);
+
+        if (!_ExportChaserFrames()) {
+            return false;
+        }
     }
 
     // Finalize the export, close the stage.
@@ -160,12 +237,21 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
         return false;
     }
     progressBar.advance();
+
+    if (_profiler) {
+        const std::string reportPath = _profiler->WriteReport();
+        if (!reportPath.empty()) {
+            TF_STATUS("Translator profile written to '%s'", reportPath.c_str());
+        }
+        _profiler.reset();
+    }
     return true;
 }
 
 bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 {
     MayaUsd::ProgressBarScope progressBar(8);
+    _PhaseTimer               phaseTimer;
 
     // Check for DAG nodes that are a child of an already specified DAG node to export
     // if that's the case, report the issue and skip the export
@@ -293,13 +379,14 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     }
     progressBar.advance();
 
-    // Pre-process the argument dagPath path names into two sets. One set
-    // contains just the arg dagPaths, and the other contains all parents of
-    // arg dagPaths all the way up to the world root. Partial path names are
-    // enough because Maya guarantees them to still be unique, and they require
-    // less work to hash and compare than full path names.
-    TfHashSet<std::string, TfHash>           argDagPaths;
-    TfHashSet<std::string, TfHash>           argDagPathParents;
+    phaseTimer.EndPhase("setup");
+
+    // Pre-process the argument dagPaths into two sets. One set contains just
+    // the arg dagPaths, and the other contains all parents of arg dagPaths all
+    // the way up to the world root. See _DagPathSet for how paths are
+    // identified.
+    _DagPathSet                              argDagPaths;
+    _DagPathSet                              argDagPathParents;
     UsdMayaUtil::MDagPathSet::const_iterator end = mJobCtx.mArgs.dagPaths.end();
     for (UsdMayaUtil::MDagPathSet::const_iterator it = mJobCtx.mArgs.dagPaths.begin(); it != end;
          ++it) {
@@ -310,12 +397,7 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
             continue;
         }
 
-        std::string curDagPathStr(curDagPath.partialPathName(&status).asChar());
-        if (status != MS::kSuccess) {
-            continue;
-        }
-
-        argDagPaths.insert(curDagPathStr);
+        argDagPaths.Insert(curDagPath);
 
         status = curDagPath.pop();
         if (status != MS::kSuccess) {
@@ -324,16 +406,10 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         curDagPathIsValid = curDagPath.isValid(&status);
 
         while (status == MS::kSuccess && curDagPathIsValid) {
-            curDagPathStr = curDagPath.partialPathName(&status).asChar();
-            if (status != MS::kSuccess) {
-                break;
-            }
-
-            if (argDagPathParents.find(curDagPathStr) != argDagPathParents.end()) {
+            if (!argDagPathParents.Insert(curDagPath)) {
                 // We've already traversed up from this path.
                 break;
             }
-            argDagPathParents.insert(curDagPathStr);
 
             status = curDagPath.pop();
             if (status != MS::kSuccess) {
@@ -343,31 +419,31 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         }
     }
     progressBar.advance();
-
-    // We are entering a loop here, so count the number of dag objects
-    // so we can have a better progress bar status.
-    // Note: Maya does the same thing during its write.
-    uint32_t numberDagObjects { 0 };
-    {
-        for (MItDag itDag(MItDag::kDepthFirst, MFn::kInvalid); !itDag.isDone(); itDag.next()) {
-            ++numberDagObjects;
-        }
-    }
+    phaseTimer.EndPhase("export paths");
 
     // Now do a depth-first traversal of the Maya DAG from the world root.
     // We keep a reference to arg dagPaths as we encounter them.
-    MayaUsd::ProgressBarLoopScope dagObjLoop(numberDagObjects);
+    //
+    // Counting the dag objects beforehand would take a second full walk of
+    // the DAG, so the progress bar advances for each child of the world root
+    // instead.
+    MayaUsd::ProgressBarLoopScope dagObjLoop(MFnDagNode(MItDag().root()).childCount());
     MDagPath                      curLeafDagPath;
+    size_t                        numVisited = 0;
     for (MItDag itDag(MItDag::kDepthFirst, MFn::kInvalid); !itDag.isDone(); itDag.next()) {
+        ++numVisited;
+        if (itDag.depth() == 1) {
+            dagObjLoop.loopAdvance();
+        }
+
         MDagPath curDagPath;
         itDag.getPath(curDagPath);
-        std::string curDagPathStr(curDagPath.partialPathName().asChar());
 
-        if (argDagPathParents.find(curDagPathStr) != argDagPathParents.end()) {
+        if (argDagPathParents.Contains(curDagPath)) {
             // This dagPath is a parent of one of the arg dagPaths. It should
             // be included in the export, but not necessarily all of its
             // children should be, so we continue to traverse down.
-        } else if (argDagPaths.find(curDagPathStr) != argDagPaths.end()) {
+        } else if (argDagPaths.Contains(curDagPath)) {
             // This dagPath IS one of the arg dagPaths. It AND all of its
             // children should be included in the export.
             curLeafDagPath = curDagPath;
@@ -394,11 +470,24 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                         return false;
                     }
 
-                    primWriter->Write(UsdTimeCode::Default());
+                    {
+                        UsdMaya_TranslatorProfiler::Scope profilerScope(
+                            _profiler.get(),
+                            UsdMaya_TranslatorProfiler::Phase::Write,
+                            typeid(*primWriter),
+                            primWriter->GetUsdPath());
+                        primWriter->Write(UsdTimeCode::Default());
+                    }
 
                     const UsdMayaUtil::MDagPathMap<SdfPath>& mapping
                         = primWriter->GetDagToUsdPathMapping();
                     mDagPathToUsdPathMap.insert(mapping.begin(), mapping.end());
+                    for (const auto& dagAndUsdPath : mapping) {
+                        if (!dagAndUsdPath.first.isInstanced()) {
+                            mDagNodeToUsdPathMap.emplace(
+                                MObjectHandle(dagAndUsdPath.first.node()), dagAndUsdPath.second);
+                        }
+                    }
 
                     _modelKindProcessor->OnWritePrim(usdPrim, primWriter);
                 }
@@ -408,8 +497,8 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                 }
             }
         }
-        dagObjLoop.loopAdvance();
     }
+    phaseTimer.EndPhase("DAG traversal");
 
     if (!mJobCtx.mArgs.rootMapFunction.IsNull()) {
         // Check if there was no intersection between export roots and given selection.
@@ -425,6 +514,7 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     // Writing Materials/Shading
     UsdMayaTranslatorMaterial::ExportShadingEngines(mJobCtx, mDagPathToUsdPathMap);
     progressBar.advance();
+    phaseTimer.EndPhase("shading");
 
     // Perform post-processing for instances, skel, etc.
     // We shouldn't be creating new instance masters after this point, and we
@@ -437,6 +527,7 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     if (!_modelKindProcessor->MakeModelHierarchy(mJobCtx.mStage)) {
         return false;
     }
+    phaseTimer.EndPhase("post-process");
 
     // now we populate the chasers and run export default
     mChasers.clear();
@@ -454,12 +545,26 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     }
 
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
+    mChaserSamples.clear();
+    mChaserSampleTimes.clear();
     for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
         if (!chaser->ExportDefault()) {
             return false;
         }
+
+        _ChaserSamples samples;
+        samples.plugs = chaser->GetSampledPlugs();
+        samples.values.resize(samples.plugs.size());
+        mChaserSamples.push_back(std::move(samples));
         chasersLoop.loopAdvance();
     }
+    phaseTimer.EndPhase("chasers");
+
+    TF_STATUS(
+        "Export preparation: %s; %zu DAG nodes visited, %zu prim writers",
+        phaseTimer.GetReport().c_str(),
+        numVisited,
+        mJobCtx.mMayaPrimWriterList.size());
 
     return true;
 }
@@ -468,16 +573,58 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 {
     const UsdTimeCode usdTime(iFrame);
 
+    // The prim writers sharing a batch are written by a single call once the
+    // other ones are written.
+    std::vector<UsdMayaPrimWriterBatchSharedPtr>                       batches;
+    std::map<UsdMayaPrimWriterBatch*, std::vector<UsdMayaPrimWriter*>> batchedPrimWriters;
+
     for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
         const UsdPrim& usdPrim = primWriter->GetUsdPrim();
         if (usdPrim) {
+            if (UsdMayaPrimWriterBatchSharedPtr batch = primWriter->GetBatch()) {
+                std::vector<UsdMayaPrimWriter*>& primWriters = batchedPrimWriters[batch.get()];
+                if (primWriters.empty()) {
+                    batches.push_back(batch);
+                }
+                primWriters.push_back(primWriter.get());
+                continue;
+            }
+
+            UsdMaya_TranslatorProfiler::Scope profilerScope(
+                _profiler.get(),
+                UsdMaya_TranslatorProfiler::Phase::Write,
+                typeid(*primWriter),
+                primWriter->GetUsdPath());
             primWriter->Write(usdTime);
         }
     }
 
-    for (UsdMayaExportChaserRefPtr& chaser : mChasers) {
-        if (!chaser->ExportFrame(iFrame)) {
-            return false;
+    for (const UsdMayaPrimWriterBatchSharedPtr& batch : batches) {
+        const std::vector<UsdMayaPrimWriter*>& primWriters = batchedPrimWriters[batch.get()];
+        UsdMaya_TranslatorProfiler::Scope      profilerScope(
+            _profiler.get(),
+            UsdMaya_TranslatorProfiler::Phase::Write,
+            typeid(*primWriters.front()),
+            primWriters.front()->GetUsdPath());
+        batch->Write(primWriters, usdTime);
+    }
+
+    // The chasers exporting all the frames at once only need their plugs
+    // sampled, while the frame is evaluated.
+    mChaserSampleTimes.push_back(usdTime);
+    for (size_t i = 0; i < mChasers.size(); ++i) {
+        _ChaserSamples& samples = mChaserSamples[i];
+        if (samples.plugs.empty()) {
+            if (!mChasers[i]->ExportFrame(iFrame)) {
+                return false;
+            }
+            continue;
+        }
+
+        for (size_t j = 0; j < samples.plugs.size(); ++j) {
+            const UsdMayaExportChaser::SampledPlug& sampledPlug = samples.plugs[j];
+            samples.values[j].push_back(UsdMayaWriteUtil::GetVtValue(
+                sampledPlug.plug, sampledPlug.typeName, /*linearizeColors*/ false));
         }
     }
 
@@ -486,6 +633,30 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
     return true;
 }
 
+bool UsdMaya_WriteJob::_ExportChaserFrames()
+{
+    if (mChaserSampleTimes.empty()) {
+        return true;
+    }
+
+    for (size_t i = 0; i < mChasers.size(); ++i) {
+        _ChaserSamples& samples = mChaserSamples[i];
+        if (samples.plugs.empty()) {
+            continue;
+        }
+
+        if (!mChasers[i]->ExportFrames(mChaserSampleTimes, samples.values)) {
+            return false;
+        }
+
+        // The samples are no longer needed, and can be large on long animations.
+        samples.values.clear();
+    }
+    mChaserSampleTimes.clear();
+
+    return true;
+}
+
 bool UsdMaya_WriteJob::_FinishWriting()
 {
     MayaUsd::ProgressBarScope progressBar(6);
@@ -562,7 +733,14 @@ bool UsdMaya_WriteJob::_FinishWriting()
     const int                     loopSize = mJobCtx.mMayaPrimWriterList.size();
     MayaUsd::ProgressBarLoopScope primWriterLoop(loopSize);
     for (auto& primWriter : mJobCtx.mMayaPrimWriterList) {
-        primWriter->PostExport();
+        {
+            UsdMaya_TranslatorProfiler::Scope profilerScope(
+                _profiler.get(),
+                UsdMaya_TranslatorProfiler::Phase::PostExport,
+                typeid(*primWriter),
+                primWriter->GetUsdPath());
+            primWriter->PostExport();
+        }
         primWriterLoop.loopAdvance();
     }
 
@@ -710,8 +888,8 @@ TfToken UsdMaya_WriteJob::_WriteVariants(const UsdPrim& usdRootPrim)
             MDagPath   dagPath;
             dagFn.getPath(dagPath);
             dagPath.extendToShape();
-            SdfPath usdPrimPath;
-            if (!TfMapLookup(mDagPathToUsdPathMap, dagPath, &usdPrimPath)) {
+            SdfPath usdPrimPath = MapDagPathToSdfPath(dagPath);
+            if (usdPrimPath.IsEmpty()) {
                 continue;
             }
             usdPrimPath = usdPrimPath.ReplacePrefix(
@@ -27,10 +27,12 @@
 #include <maya/MObjectHandle.h>
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class UsdMaya_ModelKindProcessor;
+class UsdMaya_TranslatorProfiler;
 
 class UsdMaya_WriteJob
 {
@@ -66,6 +68,10 @@ private:
     /// WriteFrame() call, internal code may generate errors.
     bool _WriteFrame(double iFrame);
 
+    /// Gives the values sampled at all the written frames to the chasers that
+    /// export all the frames at once.
+    bool _ExportChaserFrames();
+
     /// Runs any post-export processes, closes the USD stage, and writes it out
     /// to disk.
     bool _FinishWriting();
@@ -95,14 +101,32 @@ private:
 
     UsdMayaUtil::MDagPathMap<SdfPath> mDagPathToUsdPathMap;
 
+    // Same mapping for the DAG paths that are not instanced, keyed by node
+    // handle to avoid building and comparing full path names on lookup.
+    UsdMayaUtil::MObjectHandleUnorderedMap<SdfPath> mDagNodeToUsdPathMap;
+
     // Currently only used if stripNamespaces is on, to ensure we don't have clashes
     TfHashMap<SdfPath, MDagPath, SdfPath::Hash> mUsdPathToDagPathMap;
 
     UsdMayaExportChaserRefPtrVector mChasers;
 
+    // Plugs sampled at each written frame for the chasers exporting all the
+    // frames at once, and their values. Indexed like mChasers, with no plugs
+    // for the chasers exporting each frame.
+    struct _ChaserSamples
+    {
+        UsdMayaExportChaser::SampledPlugs plugs;
+        std::vector<std::vector<VtValue>> values;
+    };
+    std::vector<_ChaserSamples> mChaserSamples;
+    std::vector<UsdTimeCode>    mChaserSampleTimes;
+
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
+
+    // Only set when translator profiling was requested.
+    std::unique_ptr<UsdMaya_TranslatorProfiler> _profiler;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
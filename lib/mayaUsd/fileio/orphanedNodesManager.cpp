@@ -30,7 +30,6 @@
 #include <maya/MPlug.h>
 #include <ufe/hierarchy.h>
 #include <ufe/sceneSegmentHandler.h>
-#include <ufe/trie.imp.h>
 
 // For Tf diagnostics macros.
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -41,7 +40,7 @@ namespace MAYAUSD_NS_DEF {
 // Class OrphanedNodesManager::Memento
 //------------------------------------------------------------------------------
 
-OrphanedNodesManager::Memento::Memento(Ufe::Trie<PullVariantInfo>&& pulledPrims)
+OrphanedNodesManager::Memento::Memento(PulledPrimsTrie&& pulledPrims)
     : _pulledPrims(std::move(pulledPrims))
 {
 }
@@ -62,7 +61,7 @@ OrphanedNodesManager::Memento& OrphanedNodesManager::Memento::operator=(Memento&
     return *this;
 }
 
-Ufe::Trie<OrphanedNodesManager::PullVariantInfo> OrphanedNodesManager::Memento::release()
+OrphanedNodesManager::PulledPrimsTrie OrphanedNodesManager::Memento::release()
 {
     return std::move(_pulledPrims);
 }
@@ -76,8 +75,9 @@ namespace {
 using PullVariantInfo = OrphanedNodesManager::PullVariantInfo;
 using VariantSetDescriptor = OrphanedNodesManager::VariantSetDescriptor;
 using VariantSelection = OrphanedNodesManager::VariantSelection;
+using PulledPrimsTrie = OrphanedNodesManager::PulledPrimsTrie;
 
-Ufe::Path trieNodeToPulledPrimUfePath(Ufe::TrieNode<PullVariantInfo>::Ptr trieNode);
+Ufe::Path trieKeyToPulledPrimUfePath(const Ufe::PathSegment::Components& trieKey);
 
 void renameVariantDescriptors(
     std::list<VariantSetDescriptor>& descriptors,
@@ -93,12 +93,14 @@ void renameVariantDescriptors(
 }
 
 void renameVariantInfo(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    const Ufe::Path&                           oldPath,
-    const Ufe::Path&                           newPath)
+    PulledPrimsTrie&                    pulledPrims,
+    const PulledPrimsTrie::NodePtr&     trieNode,
+    const Ufe::PathSegment::Components& trieKey,
+    const Ufe::Path&                    oldPath,
+    const Ufe::Path&                    newPath)
 {
-    // Note: TrieNode has no non-const data() function, so to modify the
-    //       data we must make a copy, modify the copy and call setData().
+    // Note: trie nodes are shared with the mementos, so to modify the data
+    //       we must make a copy, modify the copy and add it back to the trie.
     PullVariantInfo newVariantInfo = trieNode->data();
 
     // Note: the change to USD data must be done *after* changes to Maya data because
@@ -107,46 +109,47 @@ void renameVariantInfo(
     //       hidden by that point. So the node visibility change must be done *first*.
     renameVariantDescriptors(newVariantInfo.variantSetDescriptors, oldPath, newPath);
 
-    Ufe::Path pulledPath = trieNodeToPulledPrimUfePath(trieNode);
+    Ufe::Path pulledPath = trieKeyToPulledPrimUfePath(trieKey);
     TF_VERIFY(writePullInformation(pulledPath, newVariantInfo.editedAsMayaRoot));
 
-    trieNode->setData(newVariantInfo);
+    pulledPrims.add(trieKey, std::move(newVariantInfo));
 }
 
 void recursiveRename(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    const Ufe::Path&                           oldPath,
-    const Ufe::Path&                           newPath)
+    PulledPrimsTrie&                pulledPrims,
+    const PulledPrimsTrie::NodePtr& trieNode,
+    Ufe::PathSegment::Components&   trieKey,
+    const Ufe::Path&                oldPath,
+    const Ufe::Path&                newPath)
 {
+    // Note: trieNode is not modified by the renames, which add new nodes to
+    //       the trie, so it is safe to iterate over its children.
     if (trieNode->hasData()) {
-        renameVariantInfo(trieNode, oldPath, newPath);
+        renameVariantInfo(pulledPrims, trieNode, trieKey, oldPath, newPath);
     } else {
-        auto childrenComponents = trieNode->childrenComponents();
-        for (auto& c : childrenComponents) {
-            recursiveRename((*trieNode)[c], oldPath, newPath);
+        for (const auto& child : trieNode->children()) {
+            trieKey.push_back(child.second->component());
+            recursiveRename(pulledPrims, child.second, trieKey, oldPath, newPath);
+            trieKey.pop_back();
         }
     }
 }
 
 void handlePathChange(
-    const Ufe::Path&            oldPath,
-    const Ufe::SceneItem::Ptr&  item,
-    Ufe::Trie<PullVariantInfo>& pulledPrims)
+    const Ufe::Path&           oldPath,
+    const Ufe::SceneItem::Ptr& item,
+    PulledPrimsTrie&           pulledPrims)
 {
     if (!item)
         return;
 
-    auto trieNode = pulledPrims.node(oldPath);
-    if (trieNode) {
+    if (pulledPrims.node(oldPath)) {
+        // Renames and reparents both move the trie node to the new path.
         const Ufe::Path& newPath = item->path();
-        // If the only change is the last part of the UFE path, then
-        // we are dealing with a rename. Else it is a reparent.
-        if (newPath.pop() == oldPath.pop()) {
-            trieNode->rename(newPath.back());
-        } else {
-            pulledPrims.move(oldPath, newPath);
-        }
-        recursiveRename(trieNode, oldPath, newPath);
+        pulledPrims.move(oldPath, newPath);
+
+        Ufe::PathSegment::Components trieKey = PulledPrimsTrie::components(newPath);
+        recursiveRename(pulledPrims, pulledPrims.node(newPath), trieKey, oldPath, newPath);
     }
 }
 
@@ -250,6 +253,22 @@ void OrphanedNodesManager::operator()(const Ufe::Notification& n)
     }
 }
 
+// Hide or show the pulled prims once all orphaned Maya nodes have been
+// updated, with a single change block per stage.
+struct OrphanedNodesManager::ExcludeFromRenderingEdits
+{
+    ~ExcludeFromRenderingEdits()
+    {
+        if (!toRemove.empty())
+            removeExcludeFromRendering(toRemove);
+        if (!toAdd.empty())
+            addExcludeFromRendering(toAdd);
+    }
+
+    std::vector<Ufe::Path> toAdd;
+    std::vector<Ufe::Path> toRemove;
+};
+
 void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& op)
 {
     if (_inOrphaning > 0)
@@ -257,6 +276,10 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
 
     Orphaning orphaning(_inOrphaning);
 
+    // Declared after the orphaning guard, so that the USD edits are still
+    // done while orphaning.
+    ExcludeFromRenderingEdits excludeEdits;
+
     switch (op.opType) {
     case Ufe::SceneCompositeNotification::OpType::ObjectAdd: {
         // Restoring a previously-deleted scene item may restore an orphaned
@@ -266,7 +289,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // point.  It may be an internal node, without data.
         auto ancestorNode = pulledPrims().node(op.path);
         TF_VERIFY(ancestorNode);
-        recursiveSwitch(ancestorNode, op.path);
+        recursiveSwitch(ancestorNode, op.path, excludeEdits);
     } break;
     case Ufe::SceneCompositeNotification::OpType::ObjectDelete: {
         // The following cases will generate object delete:
@@ -285,7 +308,8 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // the path.  It may be an internal node, without data.
         auto ancestorNode = pulledPrims().node(op.path);
         TF_VERIFY(ancestorNode);
-        recursiveSetOrphaned(ancestorNode, true);
+        auto trieKey = PulledPrimsTrie::components(op.path);
+        recursiveSetOrphaned(ancestorNode, trieKey, true, excludeEdits);
     } break;
     case Ufe::SceneCompositeNotification::OpType::SubtreeInvalidate: {
         // On subtree invalidate, the scene item itself has not had a structure
@@ -305,7 +329,8 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         if (!parentHier->hasChildren()) {
             auto ancestorNode = pulledPrims().node(op.path);
             if (ancestorNode) {
-                recursiveSetOrphaned(ancestorNode, true);
+                auto trieKey = PulledPrimsTrie::components(op.path);
+                recursiveSetOrphaned(ancestorNode, trieKey, true, excludeEdits);
             }
             return;
         } else {
@@ -346,7 +371,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
                     continue;
 
                 foundChild = true;
-                recursiveSwitch(ancestorNode, childPath);
+                recursiveSwitch(ancestorNode, childPath, excludeEdits);
             }
             if (!foundChild) {
                 // Following a subtree invalidate, if none of the now-valid
@@ -355,7 +380,8 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
                 // hidden.
                 auto ancestorNode = pulledPrims().node(op.path);
                 if (ancestorNode) {
-                    recursiveSetOrphaned(ancestorNode, true);
+                    auto trieKey = PulledPrimsTrie::components(op.path);
+                    recursiveSetOrphaned(ancestorNode, trieKey, true, excludeEdits);
                 }
             }
         }
@@ -374,17 +400,18 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
     }
 }
 
-Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims() { return _pulledPrims; }
+PulledPrimsTrie& OrphanedNodesManager::pulledPrims() { return _pulledPrims; }
 
-const Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims() const { return _pulledPrims; }
+const PulledPrimsTrie& OrphanedNodesManager::pulledPrims() const { return _pulledPrims; }
 
 void OrphanedNodesManager::clear() { pulledPrims().clear(); }
 
-bool OrphanedNodesManager::empty() const { return pulledPrims().root()->empty(); }
+bool OrphanedNodesManager::empty() const { return pulledPrims().empty(); }
 
 OrphanedNodesManager::Memento OrphanedNodesManager::preserve() const
 {
-    return Memento(deepCopy(pulledPrims()));
+    // Copying the trie only shares its root: later edits copy the nodes they modify.
+    return Memento(PulledPrimsTrie(pulledPrims()));
 }
 
 void OrphanedNodesManager::restore(Memento&& previous) { _pulledPrims = previous.release(); }
@@ -415,20 +442,11 @@ bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath) const
 
 namespace {
 
-Ufe::Path
-trieNodeToPulledPrimUfePath(Ufe::TrieNode<OrphanedNodesManager::PullVariantInfo>::Ptr trieNode)
+Ufe::Path trieKeyToPulledPrimUfePath(const Ufe::PathSegment::Components& trieKey)
 {
     // Accumulate all UFE path components, in reverse order. We will pop them
     // from the back while building the pulled prim path.
-    //
-    // Note: the trie root node is not really part of the hierarchy, so do not
-    //       include it in the components. We detect we are at the root when
-    //       the node has no parent.
-    Ufe::PathSegment::Components pathComponents;
-    while (trieNode->parent()) {
-        pathComponents.push_back(trieNode->component());
-        trieNode = trieNode->parent();
-    }
+    Ufe::PathSegment::Components pathComponents(trieKey.rbegin(), trieKey.rend());
 
     // We assume the prim path is comosed of two segments: one in Maya, up to the
     // stage proxy shape, then in USD.
@@ -482,8 +500,10 @@ MStatus setNodeVisibility(const MDagPath& dagPath, bool visibility)
 
 /* static */
 bool OrphanedNodesManager::setOrphaned(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    bool                                       orphaned)
+    const PulledPrimsTrie::NodePtr&     trieNode,
+    const Ufe::PathSegment::Components& trieKey,
+    bool                                orphaned,
+    ExcludeFromRenderingEdits&          excludeEdits)
 {
     TF_VERIFY(trieNode->hasData());
 
@@ -497,7 +517,7 @@ bool OrphanedNodesManager::setOrphaned(
     pullParentPath.pop();
     CHECK_MSTATUS_AND_RETURN(setNodeVisibility(pullParentPath, !orphaned), false);
 
-    const Ufe::Path pulledPrimPath = trieNodeToPulledPrimUfePath(trieNode);
+    const Ufe::Path pulledPrimPath = trieKeyToPulledPrimUfePath(trieKey);
 
     // Note: if we are called due to the user deleting the stage, then the pulled prim
     //       path will be invalid and trying to add or remove information on it will
@@ -505,10 +525,10 @@ bool OrphanedNodesManager::setOrphaned(
     if (!pulledPrimPath.empty()) {
         if (orphaned) {
             removePulledPrimMetadata(pulledPrimPath);
-            removeExcludeFromRendering(pulledPrimPath);
+            excludeEdits.toRemove.push_back(pulledPrimPath);
         } else {
             writePulledPrimMetadata(pulledPrimPath, variantInfo.editedAsMayaRoot);
-            addExcludeFromRendering(pulledPrimPath);
+            excludeEdits.toAdd.push_back(pulledPrimPath);
         }
     }
 
@@ -517,26 +537,30 @@ bool OrphanedNodesManager::setOrphaned(
 
 /* static */
 void OrphanedNodesManager::recursiveSetOrphaned(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    bool                                       orphaned)
+    const PulledPrimsTrie::NodePtr& trieNode,
+    Ufe::PathSegment::Components&   trieKey,
+    bool                            orphaned,
+    ExcludeFromRenderingEdits&      excludeEdits)
 {
     // We know in our case that a trie node with data can't have children,
     // since descendants of a pulled prim can't be pulled.
     if (trieNode->hasData()) {
         TF_VERIFY(trieNode->empty());
-        TF_VERIFY(setOrphaned(trieNode, orphaned));
+        TF_VERIFY(setOrphaned(trieNode, trieKey, orphaned, excludeEdits));
     } else {
-        auto childrenComponents = trieNode->childrenComponents();
-        for (const auto& c : childrenComponents) {
-            recursiveSetOrphaned((*trieNode)[c], orphaned);
+        for (const auto& child : trieNode->children()) {
+            trieKey.push_back(child.second->component());
+            recursiveSetOrphaned(child.second, trieKey, orphaned, excludeEdits);
+            trieKey.pop_back();
         }
     }
 }
 
 /* static */
 void OrphanedNodesManager::recursiveSwitch(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    const Ufe::Path&                           ufePath)
+    const PulledPrimsTrie::NodePtr& trieNode,
+    const Ufe::Path&                ufePath,
+    ExcludeFromRenderingEdits&      excludeEdits)
 {
     // We know in our case that a trie node with data can't have children,
     // since descendants of a pulled prim can't be pulled.  A trie node with
@@ -558,21 +582,21 @@ void OrphanedNodesManager::recursiveSwitch(
         const auto  currentDesc = variantSetDescriptors(ufePath.pop());
         const bool  variantSetsMatch = (originalDesc == currentDesc);
         const bool  orphaned = (pulledNode && !variantSetsMatch);
-        TF_VERIFY(setOrphaned(trieNode, orphaned));
+        TF_VERIFY(
+            setOrphaned(trieNode, PulledPrimsTrie::components(ufePath), orphaned, excludeEdits));
     } else {
         const bool isGatewayToUsd = Ufe::SceneSegmentHandler::isGateway(ufePath);
-        for (const auto& c : trieNode->childrenComponents()) {
-            auto childTrieNode = (*trieNode)[c];
-            if (childTrieNode) {
-                // When not crossing runtimes, we can simply use the UFE path
-                // component stored in the trie. When crossing runtimes, we
-                // need to create a segment instead with the new runtime ID.
-                if (!isGatewayToUsd) {
-                    recursiveSwitch(childTrieNode, ufePath + c);
-                } else {
-                    Ufe::PathSegment childSegment(c, ufe::getUsdRunTimeId(), '/');
-                    recursiveSwitch(childTrieNode, ufePath + childSegment);
-                }
+        for (const auto& child : trieNode->children()) {
+            const auto& childTrieNode = child.second;
+            const auto& c = childTrieNode->component();
+            // When not crossing runtimes, we can simply use the UFE path
+            // component stored in the trie. When crossing runtimes, we
+            // need to create a segment instead with the new runtime ID.
+            if (!isGatewayToUsd) {
+                recursiveSwitch(childTrieNode, ufePath + c, excludeEdits);
+            } else {
+                Ufe::PathSegment childSegment(c, ufe::getUsdRunTimeId(), '/');
+                recursiveSwitch(childTrieNode, ufePath + childSegment, excludeEdits);
             }
         }
     }
@@ -598,28 +622,4 @@ OrphanedNodesManager::variantSetDescriptors(const Ufe::Path& p)
     return vsd;
 }
 
-/* static */
-Ufe::Trie<PullVariantInfo> OrphanedNodesManager::deepCopy(const Ufe::Trie<PullVariantInfo>& src)
-{
-    Ufe::Trie<PullVariantInfo> dst;
-    deepCopy(src.root(), dst.root());
-    return dst;
-}
-
-/* static */
-void OrphanedNodesManager::deepCopy(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& src,
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& dst)
-{
-    for (const auto& c : src->childrenComponents()) {
-        const auto& srcChild = (*src)[c];
-        auto        dstChild = std::make_shared<Ufe::TrieNode<PullVariantInfo>>(c);
-        dst->add(dstChild);
-        if (srcChild->hasData()) {
-            dstChild->setData(srcChild->data());
-        }
-        deepCopy(srcChild, dstChild);
-    }
-}
-
 } // namespace MAYAUSD_NS_DEF
@@ -17,12 +17,12 @@
 #pragma once
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/persistentTrie.h>
 
 #include <maya/MDagPath.h>
 #include <ufe/observer.h>
 #include <ufe/path.h>
 #include <ufe/sceneNotification.h>
-#include <ufe/trie.h>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -96,7 +96,13 @@ public:
         std::list<VariantSetDescriptor> variantSetDescriptors;
     };
 
+    /// \brief Trie of pulled prims. Its copies share their unchanged nodes.
+    using PulledPrimsTrie = PersistentTrie<PullVariantInfo>;
+
     /// \brief Entire state of the OrphanedNodesManager at a point in time, used for undo/redo.
+    ///
+    /// The memento shares the nodes of the trie it was taken from, so taking and
+    /// restoring a memento are O(1), whatever the number of pulled prims.
     class Memento
     {
     public:
@@ -117,11 +123,11 @@ public:
         // Private, for opacity.
         friend class OrphanedNodesManager;
 
-        Memento(Ufe::Trie<PullVariantInfo>&& pulledPrims);
+        Memento(PulledPrimsTrie&& pulledPrims);
 
-        Ufe::Trie<PullVariantInfo> release();
+        PulledPrimsTrie release();
 
-        Ufe::Trie<PullVariantInfo> _pulledPrims;
+        PulledPrimsTrie _pulledPrims;
     };
 
     // Construct an empty orphan manager.
@@ -163,28 +169,38 @@ public:
 private:
     void handleOp(const Ufe::SceneCompositeNotification::Op& op);
 
-    Ufe::Trie<PullVariantInfo>&       pulledPrims();
-    const Ufe::Trie<PullVariantInfo>& pulledPrims() const;
-
-    static void
-    recursiveSetOrphaned(const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode, bool orphaned);
-    static void
-    recursiveSwitch(const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode, const Ufe::Path& ufePath);
-
-    static bool setOrphaned(const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode, bool orphaned);
+    PulledPrimsTrie&       pulledPrims();
+    const PulledPrimsTrie& pulledPrims() const;
+
+    // Pulled prims to hide or show in USD, which are edited in a batch
+    // once all the Maya nodes have been updated.
+    struct ExcludeFromRenderingEdits;
+
+    // The trie key is the list of components of the UFE path of the trie node,
+    // kept up to date while recursing.
+    static void recursiveSetOrphaned(
+        const PulledPrimsTrie::NodePtr& trieNode,
+        Ufe::PathSegment::Components&   trieKey,
+        bool                            orphaned,
+        ExcludeFromRenderingEdits&      excludeEdits);
+    static void recursiveSwitch(
+        const PulledPrimsTrie::NodePtr& trieNode,
+        const Ufe::Path&                ufePath,
+        ExcludeFromRenderingEdits&      excludeEdits);
+
+    static bool setOrphaned(
+        const PulledPrimsTrie::NodePtr&     trieNode,
+        const Ufe::PathSegment::Components& trieKey,
+        bool                                orphaned,
+        ExcludeFromRenderingEdits&          excludeEdits);
 
     // Member function to access private nested classes.
     static std::list<VariantSetDescriptor> variantSetDescriptors(const Ufe::Path& path);
 
-    static Ufe::Trie<PullVariantInfo> deepCopy(const Ufe::Trie<PullVariantInfo>& src);
-    static void                       deepCopy(
-                              const Ufe::TrieNode<PullVariantInfo>::Ptr& src,
-                              const Ufe::TrieNode<PullVariantInfo>::Ptr& dst);
-
     // Trie for fast lookup of descendant pulled prims.  The Trie key is the
     // UFE pulled path, and the Trie value is the corresponding Dag pull parent
     // and all ancestor variant set selections.
-    Ufe::Trie<PullVariantInfo> _pulledPrims;
+    PulledPrimsTrie _pulledPrims;
 
     // Flag to tell that the orphaned nodes manager is currently orphaning
     // nodes and should not react to its own actions.
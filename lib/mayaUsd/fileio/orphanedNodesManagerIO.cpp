@@ -24,7 +24,6 @@
 #include <maya/MDagPath.h>
 #include <maya/MString.h>
 #include <ufe/pathString.h>
-#include <ufe/trie.imp.h>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -74,8 +73,8 @@ using VariantSelection = OrphanedNodesManager::VariantSelection;
 using VariantSetDesc = OrphanedNodesManager::VariantSetDescriptor;
 using VariantSetDescList = std::list<VariantSetDesc>;
 using PullVariantInfo = OrphanedNodesManager::PullVariantInfo;
-using PullInfoTrie = Ufe::Trie<PullVariantInfo>;
-using PullInfoTrieNode = Ufe::TrieNode<PullVariantInfo>;
+using PullInfoTrie = OrphanedNodesManager::PulledPrimsTrie;
+using PullInfoTrieNodePtr = PullInfoTrie::NodePtr;
 using Memento = OrphanedNodesManager::Memento;
 
 ////////////////////////////////////////////////////////////////////////////
@@ -90,14 +89,17 @@ PXR_NS::JsArray  convertToArray(const VariantSelection& variantSel);
 PXR_NS::JsObject convertToObject(const VariantSetDesc& variantDesc);
 PXR_NS::JsArray  convertToArray(const std::list<VariantSetDesc>& allVariantDesc);
 PXR_NS::JsObject convertToObject(const PullVariantInfo& pullInfo);
-PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNode);
+PXR_NS::JsObject convertToObject(const PullInfoTrieNodePtr& pullInfoNode);
 PXR_NS::JsObject convertToObject(const PullInfoTrie& allPulledInfo);
 
 VariantSelection   convertToVariantSelection(const PXR_NS::JsArray& variantSelJson);
 VariantSetDesc     convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson);
 VariantSetDescList convertToVariantSetDescList(const PXR_NS::JsArray& allVariantDescJson);
 PullVariantInfo    convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson);
-void         convertToPullInfoTrieNodePtr(const PXR_NS::JsObject&, PullInfoTrieNode::Ptr intoRoot);
+void convertToPullInfoTrieNodes(
+    const PXR_NS::JsObject&       pullInfoNodeJson,
+    Ufe::PathSegment::Components& trieKey,
+    PullInfoTrie&                 intoTrie);
 PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPulledInfoJson);
 
 PXR_NS::JsArray convertToArray(const VariantSelection& variantSel)
@@ -199,12 +201,12 @@ PullVariantInfo convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson)
     return pullInfo;
 }
 
-PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
+PXR_NS::JsObject convertToObject(const PullInfoTrieNodePtr& pullInfoNodePtr)
 {
     if (!pullInfoNodePtr)
         return {};
 
-    const PullInfoTrieNode& pullInfoNode = *pullInfoNodePtr;
+    const PullInfoTrie::Node& pullInfoNode = *pullInfoNodePtr;
 
     PXR_NS::JsObject pullInfoNodeJson;
 
@@ -212,19 +214,20 @@ PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
         pullInfoNodeJson[pullInfoJsonKey] = convertToObject(pullInfoNode.data());
     }
 
-    for (const auto& child : pullInfoNode.childrenComponents()) {
-        PXR_NS::JsObject childJson = convertToObject(pullInfoNode[child]);
+    for (const auto& child : pullInfoNode.children()) {
+        PXR_NS::JsObject childJson = convertToObject(child.second);
         if (childJson.empty())
             continue;
-        pullInfoNodeJson[ufeComponentPrefix + child.string()] = childJson;
+        pullInfoNodeJson[ufeComponentPrefix + child.second->component().string()] = childJson;
     }
 
     return pullInfoNodeJson;
 }
 
-void convertToPullInfoTrieNodePtr(
-    const PXR_NS::JsObject& pullInfoNodeJson,
-    PullInfoTrieNode::Ptr   intoRoot)
+void convertToPullInfoTrieNodes(
+    const PXR_NS::JsObject&       pullInfoNodeJson,
+    Ufe::PathSegment::Components& trieKey,
+    PullInfoTrie&                 intoTrie)
 {
     for (const auto& keyValue : pullInfoNodeJson) {
         const std::string&     key = keyValue.first;
@@ -232,12 +235,12 @@ void convertToPullInfoTrieNodePtr(
         if (key.size() <= 0) {
             continue;
         } else if (key == pullInfoJsonKey) {
-            intoRoot->setData(convertToPullVariantInfo(convertToObject(value)));
+            intoTrie.add(trieKey, convertToPullVariantInfo(convertToObject(value)));
 
         } else if (key[0] == '/') {
-            PullInfoTrieNode::Ptr child = std::make_shared<PullInfoTrieNode>(key.substr(1));
-            intoRoot->add(child);
-            convertToPullInfoTrieNodePtr(convertToObject(value), child);
+            trieKey.push_back(Ufe::PathComponent(key.substr(1)));
+            convertToPullInfoTrieNodes(convertToObject(value), trieKey, intoTrie);
+            trieKey.pop_back();
         }
     }
 }
@@ -249,9 +252,10 @@ PXR_NS::JsObject convertToObject(const PullInfoTrie& allPullInfo)
 
 PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 {
-    PullInfoTrie allPullInfo;
+    PullInfoTrie                 allPullInfo;
+    Ufe::PathSegment::Components trieKey;
 
-    convertToPullInfoTrieNodePtr(allPullInfoJson, allPullInfo.root());
+    convertToPullInfoTrieNodes(allPullInfoJson, trieKey, allPullInfo);
 
     return allPullInfo;
 }
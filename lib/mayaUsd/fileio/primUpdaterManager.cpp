@@ -112,6 +112,19 @@ Ufe::Path usdToMaya(const Ufe::Path& usdPath)
     return Ufe::PathString::path(dagPathStr);
 }
 
+// Hide or show the pulled prim with the per-stage functions, on the stage that the
+// pulled path leads to when the edit is done, undone or redone.
+bool excludeFromRendering(const Ufe::Path& pulledPath, bool exclude)
+{
+    UsdStagePtr stage = MayaUsd::ufe::getStage(pulledPath);
+    if (!stage || pulledPath.nbSegments() < 2)
+        return false;
+
+    const SdfPathVector pulledPaths { SdfPath(pulledPath.getSegments()[1].string()) };
+    return exclude ? addExcludeFromRendering(stage, pulledPaths)
+                   : removeExcludeFromRendering(stage, pulledPaths);
+}
+
 SdfPath makeDstPath(const SdfPath& dstRootParentPath, const SdfPath& srcPath)
 {
     auto relativeSrcPath = srcPath.MakeRelativePath(SdfPath::AbsoluteRootPath());
@@ -392,9 +405,9 @@ PullImportPaths pullImport(
 
         if (!FunctionUndoItem::execute(
                 "Pull import rendering exclusion",
-                [ufePulledPath]() { return addExcludeFromRendering(ufePulledPath); },
+                [ufePulledPath]() { return excludeFromRendering(ufePulledPath, true); },
                 [ufePulledPath]() {
-                    removeExcludeFromRendering(ufePulledPath);
+                    excludeFromRendering(ufePulledPath, false);
                     return true;
                 })) {
             TF_WARN("Cannot exclude original USD data from viewport rendering.");
@@ -1034,10 +1047,10 @@ bool PrimUpdaterManager::mergeToUsd(
         if (!FunctionUndoItem::execute(
                 "Merge to Maya rendering inclusion",
                 [pulledPath]() {
-                    removeExcludeFromRendering(pulledPath);
+                    excludeFromRendering(pulledPath, false);
                     return true;
                 },
-                [pulledPath]() { return addExcludeFromRendering(pulledPath); })) {
+                [pulledPath]() { return excludeFromRendering(pulledPath, true); })) {
             TF_WARN("Cannot re-enable original USD data in viewport rendering.");
             return false;
         }
@@ -1335,10 +1348,10 @@ bool PrimUpdaterManager::discardPrimEdits(const Ufe::Path& pulledPath)
     if (!FunctionUndoItem::execute(
             "Discard edits rendering inclusion",
             [pulledPath]() {
-                removeExcludeFromRendering(pulledPath);
+                excludeFromRendering(pulledPath, false);
                 return true;
             },
-            [pulledPath]() { return addExcludeFromRendering(pulledPath); })) {
+            [pulledPath]() { return excludeFromRendering(pulledPath, true); })) {
         TF_WARN("Cannot re-enable original USD data in viewport rendering.");
         return false;
     }
@@ -85,6 +85,8 @@ UsdMayaPrimWriter::UsdMayaPrimWriter(
 /* virtual */
 UsdMayaPrimWriter::~UsdMayaPrimWriter() { }
 
+UsdMayaPrimWriterBatch::~UsdMayaPrimWriterBatch() { }
+
 bool UsdMayaPrimWriter::_IsMergedTransform() const
 {
     return _writeJobCtx.IsMergedTransform(GetDagPath());
@@ -238,6 +240,9 @@ const UsdMayaUtil::MDagPathMap<SdfPath>& UsdMayaPrimWriter::GetDagToUsdPathMappi
     return _baseDagToUsdPaths;
 }
 
+/* virtual */
+UsdMayaPrimWriterBatchSharedPtr UsdMayaPrimWriter::GetBatch() const { return nullptr; }
+
 const MDagPath& UsdMayaPrimWriter::GetDagPath() const { return _dagPath; }
 
 const MObject& UsdMayaPrimWriter::GetMayaObject() const { return _mayaObject; }
@@ -35,9 +35,11 @@
 #include <maya/MObject.h>
 
 #include <memory>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class UsdMayaPrimWriterBatch;
 class UsdMayaWriteJobContext;
 
 /// Base class for all built-in and user-defined prim writers. Translates Maya
@@ -138,6 +140,14 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual const UsdMayaUtil::MDagPathMap<SdfPath>& GetDagToUsdPathMapping() const;
 
+    /// Gets the batch that writes the time samples of this prim writer along
+    /// with the ones of the other prim writers sharing it, instead of calling
+    /// Write() on each of them at every exported frame.
+    ///
+    /// The base implementation returns an empty pointer.
+    MAYAUSD_CORE_PUBLIC
+    virtual std::shared_ptr<UsdMayaPrimWriterBatch> GetBatch() const;
+
     /// The source Maya DAG path that we are consuming.
     ///
     /// If this prim writer is for a Maya DG node and not a DAG node, this will
@@ -222,6 +232,24 @@ private:
 
 typedef std::shared_ptr<UsdMayaPrimWriter> UsdMayaPrimWriterSharedPtr;
 
+/// Writes the time samples of several prim writers in a single call, for prim
+/// writers whose per-call overhead matters, such as the ones implemented in
+/// Python. The write job groups the prim writers that return the same batch
+/// from UsdMayaPrimWriter::GetBatch() and writes them together at each frame.
+class UsdMayaPrimWriterBatch
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    virtual ~UsdMayaPrimWriterBatch();
+
+    /// Writes the prims of all the given prim writers at \p usdTime.
+    MAYAUSD_CORE_PUBLIC
+    virtual void
+    Write(const std::vector<UsdMayaPrimWriter*>& primWriters, const UsdTimeCode& usdTime) = 0;
+};
+
+typedef std::shared_ptr<UsdMayaPrimWriterBatch> UsdMayaPrimWriterBatchSharedPtr;
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif
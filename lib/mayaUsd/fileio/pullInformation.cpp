@@ -19,8 +19,9 @@
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsd/utils/primActivation.h>
 
-#include <usdUfe/utils/usdUtils.h>
-
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
 
 #include <maya/MDagPath.h>
@@ -34,6 +35,10 @@
 #include <ufe/pathString.h>
 #include <ufe/sceneItem.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 
 namespace {
@@ -44,6 +49,37 @@ const PXR_NS::TfToken kPullPrimMetadataKey("Maya:Pull:DagPath");
 // Metadata key used to store pull information on a DG node
 const MString kPullDGMetadataKey("Pull_UfePath");
 
+using StagePaths = std::vector<std::pair<PXR_NS::UsdStagePtr, PXR_NS::SdfPathVector>>;
+
+// Group the USD paths of the UFE paths by stage, in the order in which the
+// stages are first found. Paths whose stage cannot be found are skipped, and
+// allFound is then set to false.
+StagePaths groupPathsPerStage(const std::vector<Ufe::Path>& ufePaths, bool& allFound)
+{
+    StagePaths stagePaths;
+    allFound = true;
+    for (const Ufe::Path& ufePath : ufePaths) {
+        PXR_NS::UsdStagePtr stage = MayaUsd::ufe::getStage(ufePath);
+        if (!stage) {
+            allFound = false;
+            continue;
+        }
+
+        const auto segments = ufePath.getSegments();
+        const auto usdPath = (segments.size() < 2) ? PXR_NS::SdfPath::AbsoluteRootPath()
+                                                   : PXR_NS::SdfPath(segments[1].string());
+
+        auto found = std::find_if(
+            stagePaths.begin(), stagePaths.end(), [&stage](const StagePaths::value_type& entry) {
+                return entry.first == stage;
+            });
+        if (found == stagePaths.end())
+            found = stagePaths.emplace(stagePaths.end(), stage, PXR_NS::SdfPathVector());
+        found->second.push_back(usdPath);
+    }
+    return stagePaths;
+}
+
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -187,22 +223,54 @@ void removePulledPrimMetadata(const PXR_NS::UsdStagePtr& stage, PXR_NS::UsdPrim&
 
 bool addExcludeFromRendering(const Ufe::Path& ufePulledPath)
 {
-    // Note: must make sure the prim is accessible by activating all its ancestors.
-    PrimActivation activation(ufePulledPath);
+    return addExcludeFromRendering(std::vector<Ufe::Path> { ufePulledPath });
+}
 
-    PXR_NS::UsdPrim prim = MayaUsd::ufe::ufePathToPrim(ufePulledPath);
-    if (!prim.IsValid())
-        return false;
+bool addExcludeFromRendering(const std::vector<Ufe::Path>& ufePulledPaths)
+{
+    bool       allFound = false;
+    const auto stagePaths = groupPathsPerStage(ufePulledPaths, allFound);
 
-    auto stage = prim.GetStage();
-    if (!stage)
-        return false;
+    bool success = (ufePulledPaths.size() > 0) && allFound;
+    for (const auto& entry : stagePaths)
+        success = addExcludeFromRendering(entry.first, entry.second) && success;
+    return success;
+}
 
-    PXR_NS::UsdEditContext editContext(stage, stage->GetSessionLayer());
-    if (!prim.SetActive(false))
+bool addExcludeFromRendering(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::SdfPathVector& pulledPaths)
+{
+    if (!stage || pulledPaths.empty())
         return false;
 
-    return true;
+    // Note: must make sure the prims are accessible by activating all their ancestors.
+    PrimActivation activation(stage, pulledPaths);
+
+    // The deactivations and the restoration of the ancestors are authored in
+    // a single change block, so that the stage is recomposed only once.
+    PXR_NS::SdfLayerHandle sessionLayer = stage->GetSessionLayer();
+    PXR_NS::SdfChangeBlock changeBlock;
+
+    bool success = true;
+    for (const PXR_NS::SdfPath& pulledPath : pulledPaths) {
+        if (!stage->GetPrimAtPath(pulledPath).IsValid()) {
+            success = false;
+            continue;
+        }
+
+        PXR_NS::SdfPrimSpecHandle primSpec = PXR_NS::SdfCreatePrimInLayer(sessionLayer, pulledPath);
+        if (!primSpec) {
+            success = false;
+            continue;
+        }
+
+        primSpec->SetActive(false);
+    }
+
+    activation.restore();
+
+    return success;
 }
 
 //------------------------------------------------------------------------------
@@ -212,34 +280,60 @@ bool addExcludeFromRendering(const Ufe::Path& ufePulledPath)
 
 bool removeExcludeFromRendering(const Ufe::Path& ufePulledPath)
 {
-    // Note: must make sure the prim is accessible by activating all its ancestors.
-    PrimActivation activation(ufePulledPath);
+    return removeExcludeFromRendering(std::vector<Ufe::Path> { ufePulledPath });
+}
 
-    PXR_NS::UsdPrim prim = MayaUsd::ufe::ufePathToPrim(ufePulledPath);
-    if (!prim.IsValid())
-        return false;
+bool removeExcludeFromRendering(const std::vector<Ufe::Path>& ufePulledPaths)
+{
+    bool       allFound = false;
+    const auto stagePaths = groupPathsPerStage(ufePulledPaths, allFound);
 
-    // If already active, nothing to do. This happens in some recursive
-    // notification situations.
-    if (prim.IsActive())
-        return true;
+    bool success = (ufePulledPaths.size() > 0) && allFound;
+    for (const auto& entry : stagePaths)
+        success = removeExcludeFromRendering(entry.first, entry.second) && success;
+    return success;
+}
 
-    auto stage = prim.GetStage();
-    if (!stage)
+bool removeExcludeFromRendering(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::SdfPathVector& pulledPaths)
+{
+    if (!stage || pulledPaths.empty())
         return false;
 
+    // Note: must make sure the prims are accessible by activating all their ancestors.
+    PrimActivation activation(stage, pulledPaths);
+
+    // The cleanups and the restoration of the ancestors are authored in a
+    // single change block, so that the stage is recomposed only once.
     PXR_NS::SdfLayerHandle sessionLayer = stage->GetSessionLayer();
-    PXR_NS::UsdEditContext editContext(stage, sessionLayer);
+    PXR_NS::SdfChangeBlock changeBlock;
+
+    bool success = true;
+    for (const PXR_NS::SdfPath& pulledPath : pulledPaths) {
+        PXR_NS::UsdPrim prim = stage->GetPrimAtPath(pulledPath);
+        if (!prim.IsValid()) {
+            success = false;
+            continue;
+        }
 
-    // Cleanup the field and potentially empty over
-    if (!prim.ClearActive())
-        return false;
+        // If already active, nothing to do. This happens in some recursive
+        // notification situations.
+        if (prim.IsActive())
+            continue;
+
+        // Cleanup the field and potentially empty over
+        PXR_NS::SdfPrimSpecHandle primSpec = sessionLayer->GetPrimAtPath(pulledPath);
+        if (!primSpec)
+            continue;
 
-    PXR_NS::SdfPrimSpecHandle primSpec = UsdUfe::getPrimSpecAtEditTarget(prim);
-    if (sessionLayer && primSpec)
+        primSpec->ClearActive();
         sessionLayer->ScheduleRemoveIfInert(primSpec.GetSpec());
+    }
+
+    activation.restore();
 
-    return true;
+    return success;
 }
 
 //------------------------------------------------------------------------------
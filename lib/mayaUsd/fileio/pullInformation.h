@@ -19,11 +19,15 @@
 #include <mayaUsd/base/api.h>
 
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
 
 #include <maya/MDagPath.h>
 #include <ufe/sceneItem.h>
 
+#include <vector>
+
 UFE_NS_DEF { class Path; }
 
 namespace MAYAUSD_NS_DEF {
@@ -64,11 +68,33 @@ void removePulledPrimMetadata(const PXR_NS::UsdStagePtr& stage, PXR_NS::UsdPrim&
 MAYAUSD_CORE_PUBLIC
 bool addExcludeFromRendering(const Ufe::Path& ufePulledPath);
 
+/// @brief Hide the USD prims that are edited as Maya.
+///        The ancestors of the prims of each stage are activated with one change
+///        block per nesting level, then the edits and the restoration of the
+///        ancestors are done in one more change block.
+MAYAUSD_CORE_PUBLIC
+bool addExcludeFromRendering(const std::vector<Ufe::Path>& ufePulledPaths);
+MAYAUSD_CORE_PUBLIC
+bool addExcludeFromRendering(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::SdfPathVector& pulledPaths);
+
 /// @brief Show again the USD prim that was edited as Maya.
 ///        This is done once the Maya data is meged into USD and removed from the scene.
 MAYAUSD_CORE_PUBLIC
 bool removeExcludeFromRendering(const Ufe::Path& ufePulledPath);
 
+/// @brief Show again the USD prims that were edited as Maya.
+///        The ancestors of the prims of each stage are activated with one change
+///        block per nesting level, then the edits and the restoration of the
+///        ancestors are done in one more change block.
+MAYAUSD_CORE_PUBLIC
+bool removeExcludeFromRendering(const std::vector<Ufe::Path>& ufePulledPaths);
+MAYAUSD_CORE_PUBLIC
+bool removeExcludeFromRendering(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::SdfPathVector& pulledPaths);
+
 /// @brief Verify if the edited as Maya nodes corresponding to the given prim is orphaned.
 MAYAUSD_CORE_PUBLIC
 bool isEditedAsMayaOrphaned(const PXR_NS::UsdPrim& prim);
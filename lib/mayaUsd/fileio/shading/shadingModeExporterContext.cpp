@@ -221,6 +221,45 @@ MObject UsdMayaShadingModeExportContext::GetDisplacementShader() const
     return _GetShaderFromShadingEngine(_shadingEngine, _displacementShaderPlugName);
 }
 
+const UsdMayaShadingModeExportContext::_MemberAssignmentVector&
+UsdMayaShadingModeExportContext::_GetMemberAssignments(const MDagPath& dagPath) const
+{
+    auto iter = _memberAssignments.find(dagPath);
+    if (iter != _memberAssignments.end()) {
+        return iter->second;
+    }
+
+    // Querying the sets of a DAG path is expensive: record all of them, so
+    // that a mesh with many shading engines is only queried once.
+    _MemberAssignmentVector& memberAssignments = _memberAssignments[dagPath];
+
+    MStatus    status;
+    MFnDagNode dagNode(dagPath, &status);
+    if (!status) {
+        return memberAssignments;
+    }
+
+    MObjectArray sgObjs, compObjs;
+    status = dagNode.getConnectedSetsAndMembers(dagPath.instanceNumber(), sgObjs, compObjs, true);
+    if (status != MS::kSuccess) {
+        return memberAssignments;
+    }
+
+    memberAssignments.reserve(sgObjs.length());
+    for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+        VtIntArray faceIndices;
+        if (!compObjs[j].isNull()) {
+            MItMeshPolygon faceIt(dagPath, compObjs[j]);
+            faceIndices.reserve(faceIt.count());
+            for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
+                faceIndices.push_back(faceIt.index());
+            }
+        }
+        memberAssignments.push_back(_MemberAssignment { sgObjs[j], faceIndices });
+    }
+    return memberAssignments;
+}
+
 UsdMayaShadingModeExportContext::AssignmentVector
 UsdMayaShadingModeExportContext::GetAssignments() const
 {
@@ -244,7 +283,6 @@ UsdMayaShadingModeExportContext::GetAssignments() const
     SdfPathSet seenBoundPrimPaths;
 
     for (auto& dagPath : dagPaths) {
-        unsigned int instanceNumber = dagPath.instanceNumber();
 #else
     // Maya 2022 and older use this version
     MPlug dsmPlug = seDepNode.findPlug("dagSetMembers", true, &status);
@@ -317,27 +355,14 @@ UsdMayaShadingModeExportContext::GetAssignments() const
             continue;
         }
 
-        MObjectArray sgObjs, compObjs;
-        status = dagNode.getConnectedSetsAndMembers(instanceNumber, sgObjs, compObjs, true);
-        if (status != MS::kSuccess) {
-            continue;
-        }
-
-        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+        for (const _MemberAssignment& memberAssignment : _GetMemberAssignments(dagPath)) {
             // If the shading group isn't the one we're interested in, skip it.
-            if (sgObjs[j] != _shadingEngine) {
+            if (memberAssignment.shadingEngine != _shadingEngine) {
                 continue;
             }
 
-            VtIntArray faceIndices;
-            if (!compObjs[j].isNull()) {
-                MItMeshPolygon faceIt(dagPath, compObjs[j]);
-                faceIndices.reserve(faceIt.count());
-                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
-                    faceIndices.push_back(faceIt.index());
-                }
-            }
-            ret.push_back(Assignment { usdPath, faceIndices, TfToken(dagNode.name().asChar()) });
+            ret.push_back(Assignment {
+                usdPath, memberAssignment.faceIndices, TfToken(dagNode.name().asChar()) });
         }
     }
     return ret;
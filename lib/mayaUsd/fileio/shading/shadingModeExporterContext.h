@@ -28,6 +28,7 @@
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <maya/MDagPath.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 
@@ -91,6 +92,10 @@ public:
 
     /// Returns a vector of binding assignments associated with the shading
     /// engine.
+    ///
+    /// The shading engines and faces of each member are queried from Maya only
+    /// once per export, the first time one of its shading engines is exported,
+    /// and reused for the other shading engines.
     MAYAUSD_CORE_PUBLIC
     AssignmentVector GetAssignments() const;
 
@@ -119,6 +124,17 @@ public:
         const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdMap);
 
 private:
+    /// The faces of a DAG path assigned to one of its shading engines. The
+    /// faceIndices are empty when the whole DAG path is assigned.
+    struct _MemberAssignment
+    {
+        MObject    shadingEngine;
+        VtIntArray faceIndices;
+    };
+    typedef std::vector<_MemberAssignment> _MemberAssignmentVector;
+
+    const _MemberAssignmentVector& _GetMemberAssignments(const MDagPath& dagPath) const;
+
     MObject                                  _shadingEngine;
     const UsdStageRefPtr&                    _stage;
     const UsdMayaUtil::MDagPathMap<SdfPath>& _dagPathToUsdMap;
@@ -130,6 +146,10 @@ private:
     /// Shaders that are bound to prims under \p _bindableRoot paths will get
     /// exported. If \p bindableRoots is empty, it will export all.
     SdfPathSet _bindableRoots;
+
+    /// Assignments of the DAG paths already queried, shared by all the shading
+    /// engines exported with this context.
+    mutable UsdMayaUtil::MDagPathMap<_MemberAssignmentVector> _memberAssignments;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -16,7 +16,6 @@
 #include "orphanedNodesManagerUtil.h"
 
 #include <maya/MGlobal.h>
-#include <ufe/trie.imp.h>
 
 namespace MAYAUSD_NS_DEF {
 namespace utils {
@@ -26,6 +25,7 @@ namespace {
 using PullVariantInfo = OrphanedNodesManager::PullVariantInfo;
 using VariantSetDescriptor = OrphanedNodesManager::VariantSetDescriptor;
 using VariantSelection = OrphanedNodesManager::VariantSelection;
+using PulledPrimsTrie = OrphanedNodesManager::PulledPrimsTrie;
 
 void addIndent(std::string& buf, int indent)
 {
@@ -95,16 +95,12 @@ void toText(std::string& buf, const PullVariantInfo& variantInfo, int indent, bo
     toText(buf, "", "}", indent, eol);
 }
 
-void toText(
-    std::string&                               buffer,
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    int                                        indent,
-    bool                                       eol)
+void toText(std::string& buffer, const PulledPrimsTrie::NodePtr& trieNode, int indent, bool eol)
 {
     if (!trieNode)
         return;
 
-    const Ufe::TrieNode<PullVariantInfo>& node = *trieNode;
+    const PulledPrimsTrie::Node& node = *trieNode;
 
     toText(buffer, "", node.component().string(), indent, eol);
 
@@ -112,8 +108,8 @@ void toText(
         toText(buffer, node.data(), indent, eol);
     }
 
-    for (const auto& childComp : node.childrenComponents()) {
-        toText(buffer, node[childComp], indent + 1, eol);
+    for (const auto& child : node.children()) {
+        toText(buffer, child.second, indent + 1, eol);
     }
 
     if (eol)
@@ -121,9 +117,9 @@ void toText(
 }
 
 void printOrphanedNodesManagerPullInfo(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    int                                        indent,
-    bool                                       eol)
+    const PulledPrimsTrie::NodePtr& trieNode,
+    int                             indent,
+    bool                            eol)
 {
     std::string buffer("Trie ==========================================\n");
     toText(buffer, trieNode, indent, eol);
@@ -62,6 +62,7 @@
 #include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/imageable.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformable.h>
 #include <pxr/usd/usdUtils/stageCache.h>
 
 #include <maya/MBoundingBox.h>
@@ -1176,6 +1177,7 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
     const bool isNormalContext = dataBlock.context().isNormal();
     if (isNormalContext) {
         TfReset(_boundingBoxCache);
+        _ResetMayaExtentsIndex();
 
         // Reset the stage listener until we determine that everything is valid.
         _stageNoticeListener.SetStage(UsdStageWeakPtr());
@@ -1486,7 +1488,22 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     GfBBox3d allBox
         = imageablePrim.ComputeUntransformedBound(currTime, purpose1, purpose2, purpose3, purpose4);
 
-    UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
+    if (!_mayaExtentsIndexValid || _mayaExtentsRootPath != prim.GetPath()) {
+        MProfilingScope indexProfilingScope(
+            _shapeBaseProfilerCategory, MProfiler::kColorB_L1, "Index Maya extents prims");
+
+        nonConstThis->_ResetMayaExtentsIndex();
+        UsdMayaUtil::CollectMayaExtentsPrims(prim, nonConstThis->_mayaExtentsPrims);
+        nonConstThis->_mayaExtentsRootPath = prim.GetPath();
+        nonConstThis->_mayaExtentsIndexValid = true;
+    }
+
+    if (!_mayaExtentsPrims.empty()) {
+        // Setting a different time clears the cached transforms.
+        UsdGeomXformCache& xformCache = nonConstThis->_mayaExtentsXformCache;
+        xformCache.SetTime(currTime);
+        UsdMayaUtil::AddMayaExtents(allBox, prim, _mayaExtentsPrims, xformCache);
+    }
 
     MBoundingBox& retval = nonConstThis->_boundingBoxCache[currTime];
 
@@ -1507,6 +1524,68 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
 
 void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.clear(); }
 
+void MayaUsdProxyShapeBase::_ResetMayaExtentsIndex()
+{
+    _mayaExtentsPrims.clear();
+    _mayaExtentsRootPath = SdfPath();
+    _mayaExtentsIndexValid = false;
+    _mayaExtentsXformCache.Clear();
+}
+
+void MayaUsdProxyShapeBase::_UpdateMayaExtentsIndex(const UsdNotice::ObjectsChanged& notice)
+{
+    // The index is built lazily on the next bounding box computation.
+    if (!_mayaExtentsIndexValid) {
+        return;
+    }
+
+    // Cached transforms are only stale if a resync happened or if an
+    // attribute affecting transforms was modified.
+    bool xformsChanged = !notice.GetResyncedPaths().empty();
+    if (!xformsChanged) {
+        for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
+            if (!changedPath.IsPrimPropertyPath()
+                || UsdGeomXformable::IsTransformationAffectedByAttrNamed(
+                    changedPath.GetNameToken())) {
+                xformsChanged = true;
+                break;
+            }
+        }
+    }
+    if (xformsChanged) {
+        _mayaExtentsXformCache.Clear();
+    }
+
+    const UsdStageWeakPtr stage = notice.GetStage();
+    for (const auto& resyncedPath : notice.GetResyncedPaths()) {
+        // Whether a prim carries Maya extents only depends on its type, which
+        // cannot be changed by a property resync.
+        if (resyncedPath.IsPropertyPath()) {
+            continue;
+        }
+
+        const SdfPath primPath = resyncedPath.GetPrimPath();
+
+        // A resync above the proxy root invalidates everything.
+        if (_mayaExtentsRootPath.HasPrefix(primPath)) {
+            _ResetMayaExtentsIndex();
+            return;
+        }
+
+        if (!primPath.HasPrefix(_mayaExtentsRootPath)) {
+            continue;
+        }
+
+        // Descendants of a path are sorted right after it in the set.
+        auto iter = _mayaExtentsPrims.lower_bound(primPath);
+        while (iter != _mayaExtentsPrims.end() && iter->HasPrefix(primPath)) {
+            iter = _mayaExtentsPrims.erase(iter);
+        }
+
+        UsdMayaUtil::CollectMayaExtentsPrims(stage->GetPrimAtPath(primPath), _mayaExtentsPrims);
+    }
+}
+
 bool MayaUsdProxyShapeBase::isStageValid() const
 {
     MStatus                localStatus;
@@ -1992,6 +2071,8 @@ void MayaUsdProxyShapeBase::_OnStageObjectsChanged(const UsdNotice::ObjectsChang
         return;
     }
 
+    _UpdateMayaExtentsIndex(notice);
+
     // This will definitely force a BBox recomputation on "Frame All" or when framing a selected
     // stage. Computing bounds in USD is expensive, so if it pops up in other frequently used
     // scenarios we will have to investigate ways to make this cache clearing less expensive.
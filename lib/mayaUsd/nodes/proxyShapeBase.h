@@ -24,6 +24,7 @@
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 
 #include <maya/MBoundingBox.h>
 #include <maya/MDGContext.h>
@@ -400,9 +401,23 @@ private:
     void _OnLayerMutingChanged(const UsdNotice::LayerMutingChanged& notice);
     void _OnStageEditTargetChanged(const UsdNotice::StageEditTargetChanged& notice);
 
+    void _UpdateMayaExtentsIndex(const UsdNotice::ObjectsChanged& notice);
+    void _ResetMayaExtentsIndex();
+
     UsdMayaStageNoticeListener _stageNoticeListener;
 
     std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
+
+    // Index of the prims under the proxy root that carry Maya-specific extents,
+    // built on the first bounding box computation and then kept up to date
+    // from resync notifications, along with the transform cache used to
+    // place these extents relative to the root. The cache only holds the
+    // transforms of the last time code, so it does not grow during playback.
+    SdfPathSet        _mayaExtentsPrims;
+    SdfPath           _mayaExtentsRootPath;
+    bool              _mayaExtentsIndexValid { false };
+    UsdGeomXformCache _mayaExtentsXformCache;
+
     size_t                              _excludePrimPathsVersion { 1 };
     size_t                              _UsdStageVersion { 1 };
 
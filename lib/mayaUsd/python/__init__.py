@@ -12,5 +12,6 @@ del Tf
 from usdUfe import registerEditRouter
 from usdUfe import restoreDefaultEditRouter
 from usdUfe import restoreAllDefaultEditRouters
+from usdUfe import clearEditRouterCache
 from usdUfe import OperationEditRouterContext
 from usdUfe import AttributeEditRouterContext
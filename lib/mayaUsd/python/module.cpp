@@ -33,6 +33,9 @@ TF_WRAP_MODULE
     TF_WRAP(ConverterArgs);
     TF_WRAP(DiagnosticDelegate);
     TF_WRAP(MeshWriteUtils);
+#ifdef WANT_MATERIALX_BUILD
+    TF_WRAP(OgsFragmentCache);
+#endif
 #ifdef UFE_V3_FEATURES_AVAILABLE
     TF_WRAP(PrimUpdater);
     TF_WRAP(PrimUpdaterArgs);
@@ -21,6 +21,9 @@
 #include <mayaUsd/fileio/registryHelper.h>
 
 #include <pxr/base/tf/pyPolymorphic.h>
+#include <pxr/usd/sdf/valueTypeName.h>
+
+#include <maya/MPlug.h>
 
 #include <boost/python/class.hpp>
 #include <boost/python/def.hpp>
@@ -62,6 +65,70 @@ public:
         return this->CallVirtual<>("ExportFrame", &This::default_ExportFrame)(time);
     }
 
+    // GetSampledPlugs and ExportFrames can be overridden in Python but are not exposed to it:
+    // the sampled plugs have no Python conversion.
+    SampledPlugs default_GetSampledPlugs() { return base_t::GetSampledPlugs(); }
+    SampledPlugs GetSampledPlugs() override
+    {
+        if (Override o = GetOverride("GetSampledPlugs")) {
+            auto res = std::function<boost::python::object()>(TfPyCall<boost::python::object>(o))();
+            if (res) {
+                SampledPlugs sampledPlugs;
+                TfPyLock     pyLock;
+
+                boost::python::list tuples(res);
+                for (int i = 0; i < len(tuples); ++i) {
+                    boost::python::tuple t(tuples[i]);
+                    if (boost::python::len(t) != 2) {
+                        TF_CODING_ERROR("ExportChaserWrapper.GetSampledPlugs: list<tuples> "
+                                        "expected, not found!");
+                        return SampledPlugs();
+                    }
+                    boost::python::extract<SdfValueTypeName> extractedTypeName(t[1]);
+                    if (!extractedTypeName.check()) {
+                        TF_CODING_ERROR("ExportChaserWrapper.GetSampledPlugs: Sdf.ValueTypeName "
+                                        "expected, not found!");
+                        return SampledPlugs();
+                    }
+
+                    MPlug plug = boost::python::extract<MPlug>(t[0]);
+                    sampledPlugs.push_back({ plug, extractedTypeName() });
+                }
+                return sampledPlugs;
+            }
+        }
+        return This::default_GetSampledPlugs();
+    }
+
+    bool default_ExportFrames(
+        const std::vector<UsdTimeCode>&          times,
+        const std::vector<std::vector<VtValue>>& values)
+    {
+        return base_t::ExportFrames(times, values);
+    }
+    bool ExportFrames(
+        const std::vector<UsdTimeCode>&          times,
+        const std::vector<std::vector<VtValue>>& values) override
+    {
+        if (Override o = GetOverride("ExportFrames")) {
+            TfPyLock            pyLock;
+            boost::python::list pyTimes;
+            for (const UsdTimeCode& time : times) {
+                pyTimes.append(time);
+            }
+            boost::python::list pyValues;
+            for (const std::vector<VtValue>& plugValues : values) {
+                boost::python::list pyPlugValues;
+                for (const VtValue& value : plugValues) {
+                    pyPlugValues.append(value);
+                }
+                pyValues.append(pyPlugValues);
+            }
+            return TfPyCall<bool>(o)(pyTimes, pyValues);
+        }
+        return This::default_ExportFrames(times, values);
+    }
+
     bool default_PostExport() { return base_t::PostExport(); }
     bool PostExport() override
     {
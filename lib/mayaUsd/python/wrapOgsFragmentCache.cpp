@@ -0,0 +1,114 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsFragment.h>
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsFragmentCache.h>
+
+#include <pxr/imaging/hdMtlx/hdMtlx.h>
+#include <pxr/pxr.h>
+
+#include <MaterialXFormat/Util.h>
+#include <MaterialXFormat/XmlIo.h>
+
+#include <boost/python.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/tuple.hpp>
+
+#include <memory>
+#include <mutex>
+
+using namespace boost::python;
+using namespace boost;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using MaterialXMaya::OgsFragmentCache;
+
+namespace {
+
+struct _MaterialXLibrary
+{
+    _MaterialXLibrary()
+        : searchPath(HdMtlxSearchPaths())
+        , library(mx::createDocument())
+    {
+        mx::loadLibraries({}, searchPath, library);
+    }
+
+    mx::FileSearchPath searchPath;
+    mx::DocumentPtr    library;
+};
+
+const _MaterialXLibrary& _GetMaterialXLibrary()
+{
+    static std::unique_ptr<_MaterialXLibrary> library;
+    static std::once_flag                     once;
+    std::call_once(once, []() { library.reset(new _MaterialXLibrary()); });
+    return *library;
+}
+
+// Generate the OGS fragment of an element of a MaterialX document, going
+// through the cache. Returns the fragment name and source, and whether they
+// came from the cache.
+tuple _GenerateFragment(const std::string& documentXml, const std::string& elementPath)
+{
+    const _MaterialXLibrary& mtlxLibrary = _GetMaterialXLibrary();
+
+    mx::DocumentPtr document = mx::createDocument();
+    mx::readFromXmlString(document, documentXml);
+    document->importLibrary(mtlxLibrary.library);
+
+    mx::ElementPtr element = document->getDescendant(elementPath);
+    if (!element) {
+        throw mx::Exception("No element " + elementPath + " in the MaterialX document");
+    }
+
+    MaterialXMaya::OgsFragment fragment(element, mtlxLibrary.searchPath);
+    return make_tuple(
+        fragment.getFragmentName(), fragment.getFragmentSource(), fragment.isFromCache());
+}
+
+void _SetDirectory(const std::string& directory, size_t maxSize)
+{
+    OgsFragmentCache::get().setDirectory(directory, maxSize);
+}
+
+std::string _GetDirectory() { return OgsFragmentCache::get().getDirectory(); }
+
+void _Clear() { OgsFragmentCache::get().clear(); }
+
+size_t _GetHitCount() { return OgsFragmentCache::get().getHitCount(); }
+
+size_t _GetMissCount() { return OgsFragmentCache::get().getMissCount(); }
+
+} // namespace
+
+void wrapOgsFragmentCache()
+{
+    class_<OgsFragmentCache, noncopyable>("OgsFragmentCache", no_init)
+        .def("GenerateFragment", _GenerateFragment, (arg("documentXml"), arg("elementPath")))
+        .staticmethod("GenerateFragment")
+        .def("SetDirectory", _SetDirectory, (arg("directory"), arg("maxSize")))
+        .staticmethod("SetDirectory")
+        .def("GetDirectory", _GetDirectory)
+        .staticmethod("GetDirectory")
+        .def("Clear", _Clear)
+        .staticmethod("Clear")
+        .def("GetHitCount", _GetHitCount)
+        .staticmethod("GetHitCount")
+        .def("GetMissCount", _GetMissCount)
+        .staticmethod("GetMissCount");
+}
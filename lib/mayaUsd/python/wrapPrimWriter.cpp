@@ -26,6 +26,7 @@
 
 #include <pxr/base/tf/pyContainerConversions.h>
 #include <pxr/base/tf/pyEnum.h>
+#include <pxr/base/tf/pyError.h>
 #include <pxr/base/tf/pyPolymorphic.h>
 #include <pxr/base/tf/pyResultConversions.h>
 
@@ -179,6 +180,8 @@ public:
         return This::default_GetDagToUsdPathMapping();
     }
 
+    UsdMayaPrimWriterBatchSharedPtr GetBatch() const override { return _batch; }
+
     //---------------------------------------------------------------------------------------------
     /// \brief  wraps a factory function that allows registering an updated Python class
     //---------------------------------------------------------------------------------------------
@@ -203,6 +206,10 @@ public:
             boost::python::object instance = pyClass((uintptr_t)&sptr);
             boost::python::incref(instance.ptr());
             initialize_wrapper(instance.ptr(), sptr.get());
+            // Classes defining WriteBatch write the time samples of all their prims at once.
+            if (PyObject_HasAttrString(pyClass.ptr(), "WriteBatch")) {
+                sptr->_batch = _classBatch;
+            }
             return sptr;
         }
 
@@ -230,11 +237,52 @@ public:
         }
 
     private:
+        // Batch calling the WriteBatch method of the latest class registered with the Python
+        // instances of all the prim writers to write, instead of calling Write on each of them.
+        class Batch : public UsdMayaPrimWriterBatch
+        {
+        public:
+            Batch(size_t classIndex)
+                : _classIndex(classIndex) {};
+
+            void Write(
+                const std::vector<UsdMayaPrimWriter*>& primWriters,
+                const UsdTimeCode&                     usdTime) override
+            {
+                TfPyLock              pyLock;
+                boost::python::object pyClass = GetPythonObject(_classIndex);
+                if (!pyClass || PyErr_Occurred()) {
+                    return;
+                }
+
+                try {
+                    boost::python::list pyPrimWriters;
+                    for (UsdMayaPrimWriter* primWriter : primWriters) {
+                        // The batch is only shared by the wrappers created by this factory.
+                        PyObject* owner = boost::python::detail::wrapper_base_::get_owner(
+                            *static_cast<This*>(primWriter));
+                        pyPrimWriters.append(boost::python::object(
+                            boost::python::handle<>(boost::python::borrowed(owner))));
+                    }
+                    pyClass.attr("WriteBatch")(pyPrimWriters, usdTime);
+                } catch (boost::python::error_already_set const&) {
+                    // Convert any exception to TF_ERRORs.
+                    TfPyConvertPythonExceptionToTfErrors();
+                    PyErr_Clear();
+                }
+            }
+
+        private:
+            size_t _classIndex;
+        };
+
         // Function object constructor. Requires only the index of the Python class to use.
         FactoryFnWrapper(size_t classIndex)
-            : _classIndex(classIndex) {};
+            : _classIndex(classIndex)
+            , _classBatch(std::make_shared<Batch>(classIndex)) {};
 
-        size_t _classIndex;
+        size_t                          _classIndex;
+        UsdMayaPrimWriterBatchSharedPtr _classBatch;
 
         // Generates a unique key based on the name of the class, along with the class
         // purpose:
@@ -261,6 +309,7 @@ public:
 private:
     SdfPathVector                     _modelPaths;
     UsdMayaUtil::MDagPathMap<SdfPath> _dagPathMap;
+    UsdMayaPrimWriterBatchSharedPtr   _batch;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -509,6 +558,7 @@ void wrapJobExportArgs()
         .def_readonly("eulerFilter", &UsdMayaJobExportArgs::eulerFilter)
         .def_readonly("excludeInvisible", &UsdMayaJobExportArgs::excludeInvisible)
         .def_readonly("exportBlendShapes", &UsdMayaJobExportArgs::exportBlendShapes)
+        .def_readonly("blendShapeOffsetEpsilon", &UsdMayaJobExportArgs::blendShapeOffsetEpsilon)
         .def_readonly(
             "exportCollectionBasedBindings", &UsdMayaJobExportArgs::exportCollectionBasedBindings)
         .def_readonly("exportColorSets", &UsdMayaJobExportArgs::exportColorSets)
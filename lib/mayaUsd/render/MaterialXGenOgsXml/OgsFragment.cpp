@@ -1,6 +1,7 @@
 #include "OgsFragment.h"
 
 #include <mayaUsd/render/MaterialXGenOgsXml/GlslFragmentGenerator.h>
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsFragmentCache.h>
 #include <mayaUsd/render/MaterialXGenOgsXml/OgsXmlGenerator.h>
 
 #include <MaterialXFormat/XmlIo.h>
@@ -369,21 +370,55 @@ std::string generateLightRig(
 } // anonymous namespace
 
 OgsFragment::OgsFragment(mx::ElementPtr element, const mx::FileSearchPath& librarySearchPath)
-    : OgsFragment(element, LocalGlslGeneratorWrapper(element, librarySearchPath))
+    : _element(element)
 {
+    if (!_element)
+        throw mx::Exception("No element specified");
+
+    OgsFragmentCache& cache = OgsFragmentCache::get();
+    const std::string cacheKey = cache.isEnabled()
+        ? OgsFragmentCache::computeKey(_element, librarySearchPath)
+        : std::string();
+
+    OgsFragmentCache::Entry entry;
+    if (!cacheKey.empty() && cache.load(cacheKey, entry)) {
+        _fragmentName = std::move(entry.fragmentName);
+        _fragmentSource = std::move(entry.fragmentSource);
+        _lightRigName = std::move(entry.lightRigName);
+        _lightRigSource = std::move(entry.lightRigSource);
+        _pathInputMap = std::move(entry.pathInputMap);
+        _vertexInputNames = std::move(entry.vertexInputNames);
+        _isTransparent = entry.transparent;
+        _fromCache = true;
+        return;
+    }
+
+    generate(LocalGlslGeneratorWrapper(element, librarySearchPath));
+
+    if (!cacheKey.empty()) {
+        entry.fragmentName = _fragmentName;
+        entry.fragmentSource = _fragmentSource;
+        entry.lightRigName = _lightRigName;
+        entry.lightRigSource = _lightRigSource;
+        entry.pathInputMap = _pathInputMap;
+        entry.vertexInputNames = _vertexInputNames;
+        entry.transparent = _isTransparent;
+        cache.store(cacheKey, entry);
+    }
 }
 
 OgsFragment::OgsFragment(mx::ElementPtr element, mx::GenContext& genContext)
-    : OgsFragment(element, ExternalGlslGeneratorWrapper(element, genContext))
+    : _element(element)
 {
+    if (!_element)
+        throw mx::Exception("No element specified");
+
+    generate(ExternalGlslGeneratorWrapper(element, genContext));
 }
 
 template <typename GLSL_GENERATOR_WRAPPER>
-OgsFragment::OgsFragment(mx::ElementPtr element, GLSL_GENERATOR_WRAPPER&& glslGeneratorWrapper)
-    : _element(element)
+void OgsFragment::generate(GLSL_GENERATOR_WRAPPER&& glslGeneratorWrapper)
 {
-    if (!_element)
-        throw mx::Exception("No element specified");
 
     // The non-unique name of the fragment.
     // Must match the name of the root function of the fragment.
@@ -399,6 +434,13 @@ OgsFragment::OgsFragment(mx::ElementPtr element, GLSL_GENERATOR_WRAPPER&& glslGe
     // Generate the complete XML fragment source embedding both GLSL and HLSL
     // code.
     _fragmentName = generateFragment(_fragmentSource, *_glslShader, baseFragmentName);
+    _isTransparent = _glslShader->hasAttribute(mx::HW::ATTR_TRANSPARENT);
+
+    const mx::VariableBlock& vertexInputs
+        = _glslShader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
+    for (size_t i = 0; i < vertexInputs.size(); ++i) {
+        _vertexInputNames.push_back(vertexInputs[i]->getName());
+    }
 
     const mx::ShaderGraph& graph = _glslShader->getGraph();
     bool                   lighting
@@ -452,28 +494,15 @@ const std::string& OgsFragment::getLightRigSource() const { return _lightRigSour
 
 const mx::StringMap& OgsFragment::getPathInputMap() const { return _pathInputMap; }
 
+const mx::StringVec& OgsFragment::getVertexInputNames() const { return _vertexInputNames; }
+
 bool OgsFragment::isElementAShader() const
 {
     mx::TypedElementPtr typeElement = _element ? _element->asA<mx::TypedElement>() : nullptr;
     return typeElement && typeElement->getType() == mx::SURFACE_SHADER_TYPE_STRING;
 }
 
-bool OgsFragment::isTransparent() const
-{
-    return _glslShader && _glslShader->hasAttribute(mx::HW::ATTR_TRANSPARENT);
-}
-
-mx::ImageSamplingProperties
-OgsFragment::getImageSamplingProperties(const std::string& fileParameterName) const
-{
-    mx::ImageSamplingProperties samplingProperties;
-    if (_glslShader && _glslShader->hasStage(mx::Stage::PIXEL)) {
-        mx::ShaderStage&   stage = _glslShader->getStage(mx::Stage::PIXEL);
-        mx::VariableBlock& block = stage.getUniformBlock(mx::HW::PUBLIC_UNIFORMS);
-        samplingProperties.setProperties(fileParameterName, block);
-    }
-    return samplingProperties;
-}
+bool OgsFragment::isTransparent() const { return _isTransparent; }
 
 std::string OgsFragment::getMatrix4Name(const std::string& matrix3Name)
 {
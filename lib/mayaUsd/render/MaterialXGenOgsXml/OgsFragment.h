@@ -19,7 +19,8 @@ namespace MaterialXMaya {
 class OgsFragment
 {
 public:
-    /// Creates a local GLSL fragment generator
+    /// Creates a local GLSL fragment generator. The generated fragment is
+    /// looked up in, or added to, the OgsFragmentCache.
     OgsFragment(mx::ElementPtr, const mx::FileSearchPath& librarySearchPath);
 
     /// Reuses an externally-provided GLSL fragment generator. Used in the test
@@ -47,9 +48,17 @@ public:
         return _element ? _element->getDocument() : mx::DocumentPtr();
     }
 
-    /// Get the GLSL shader generated for this fragment
+    /// Get the GLSL shader generated for this fragment. Null when the fragment
+    /// was restored from the OgsFragmentCache.
     mx::ShaderPtr getShader() const { return _glslShader; }
 
+    /// Return whether the fragment was restored from the OgsFragmentCache
+    /// instead of being generated.
+    bool isFromCache() const { return _fromCache; }
+
+    /// Return the names of the vertex inputs required by the fragment.
+    const mx::StringVec& getVertexInputNames() const;
+
     /// Return the source of the OGS fragment as a string.
     const std::string& getFragmentSource() const;
 
@@ -73,10 +82,6 @@ public:
     /// as opposed to a texture graph.
     bool isElementAShader() const;
 
-    /// Get image sampling properties for a given file parameter.
-    mx::ImageSamplingProperties
-    getImageSamplingProperties(const std::string& fileParameterName) const;
-
     /// Return whether the fragment represents a transparent surface, as
     /// determined by MaterialX at generation time.
     bool isTransparent() const;
@@ -89,17 +94,19 @@ public:
     static std::string getSpecularEnvKey();
 
 private:
-    /// The constructor implementation that public constructors delegate to.
-    template <typename GLSL_GENERATOR_WRAPPER>
-    OgsFragment(mx::ElementPtr, GLSL_GENERATOR_WRAPPER&&);
-
-    mx::ElementPtr _element;        ///< The MaterialX element.
-    std::string    _fragmentName;   ///< An automatically generated fragment name.
-    std::string    _fragmentSource; ///< The generated fragment source.
-    std::string    _lightRigName;   ///< An automatically generated light rig name.
-    std::string    _lightRigSource; ///< The generated light rig for surface fragments.
-    mx::StringMap  _pathInputMap;   ///< Maps MaterialX element paths to fragment input names.
-    mx::ShaderPtr  _glslShader;     ///< The MaterialX-generated GLSL shader.
+    /// The generation implementation that public constructors delegate to.
+    template <typename GLSL_GENERATOR_WRAPPER> void generate(GLSL_GENERATOR_WRAPPER&&);
+
+    mx::ElementPtr _element;               ///< The MaterialX element.
+    std::string    _fragmentName;          ///< An automatically generated fragment name.
+    std::string    _fragmentSource;        ///< The generated fragment source.
+    std::string    _lightRigName;          ///< An automatically generated light rig name.
+    std::string    _lightRigSource;        ///< The generated light rig for surface fragments.
+    mx::StringMap  _pathInputMap;          ///< Maps MaterialX element paths to input names.
+    mx::ShaderPtr  _glslShader;            ///< The MaterialX-generated GLSL shader.
+    mx::StringVec  _vertexInputNames;      ///< The vertex inputs of the generated shader.
+    bool           _isTransparent = false; ///< Whether the generated shader is transparent.
+    bool           _fromCache = false;     ///< Whether the fragment was restored from the cache.
 };
 
 } // namespace MaterialXMaya
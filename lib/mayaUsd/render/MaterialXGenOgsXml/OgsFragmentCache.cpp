@@ -0,0 +1,466 @@
+#include "OgsFragmentCache.h"
+
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsFragment.h>
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsXmlGenerator.h>
+
+#include <pxr/base/arch/hash.h>
+#include <pxr/base/arch/systemInfo.h>
+
+#include <MaterialXFormat/XmlIo.h>
+
+#include <ghc/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if !defined(MAYAUSD_VERSION)
+#error "MAYAUSD_VERSION is not defined"
+#endif
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+namespace fs = ghc::filesystem;
+
+namespace MaterialXMaya {
+namespace {
+
+/// Identifies the entry files, and their layout version.
+const std::string ENTRY_HEADER = "MayaUsdOgsFragment 1";
+const std::string ENTRY_EXTENSION = ".ogsfrag";
+
+/// Entries are evicted down to this fraction of the size limit, so that
+/// eviction does not run again for every new entry.
+constexpr size_t EVICTION_NUMERATOR = 3;
+constexpr size_t EVICTION_DENOMINATOR = 4;
+
+constexpr size_t DEFAULT_SIZE_MB = 256;
+
+// The Maya user application directory, as documented for MAYA_APP_DIR.
+fs::path mayaUserAppDirectory()
+{
+    if (const char* appDir = std::getenv("MAYA_APP_DIR")) {
+        if (*appDir) {
+            return appDir;
+        }
+    }
+#if defined(_WIN32)
+    const char* home = std::getenv("USERPROFILE");
+#else
+    const char* home = std::getenv("HOME");
+#endif
+    if (!home || !*home) {
+        return fs::path();
+    }
+#if defined(_WIN32)
+    return fs::path(home) / "Documents" / "maya";
+#elif defined(__APPLE__)
+    return fs::path(home) / "Library" / "Preferences" / "Autodesk" / "maya";
+#else
+    return fs::path(home) / "maya";
+#endif
+}
+
+std::string defaultDirectory()
+{
+    if (const char* directory = std::getenv("MAYAUSD_MATERIALX_FRAGMENT_CACHE_DIR")) {
+        if (*directory) {
+            return directory;
+        }
+    }
+    const fs::path appDirectory = mayaUserAppDirectory();
+    if (appDirectory.empty()) {
+        return std::string();
+    }
+    return (appDirectory / "cache" / "mayaUsdMaterialXFragments").string();
+}
+
+// Return whether only the current user can add or replace entries in the directory, since
+// the fragments read from it are compiled and run by the GPU.
+bool isPrivateDirectory(const std::string& directory)
+{
+#if defined(_WIN32)
+    // The default directory is in the user profile, which is private to the user.
+    std::error_code ec;
+    return fs::is_directory(directory, ec);
+#else
+    struct stat info;
+    if (lstat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+        return false;
+    }
+    return info.st_uid == geteuid() && (info.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#endif
+}
+
+size_t defaultMaxSize()
+{
+    if (const char* sizeMB = std::getenv("MAYAUSD_MATERIALX_FRAGMENT_CACHE_SIZE_MB")) {
+        if (*sizeMB) {
+            return static_cast<size_t>(std::strtoull(sizeMB, nullptr, 10)) * 1024 * 1024;
+        }
+    }
+    return DEFAULT_SIZE_MB * 1024 * 1024;
+}
+
+// Entries are a sequence of length-prefixed strings, so that any fragment
+// source can be stored as is.
+void writeString(std::ostream& stream, const std::string& value)
+{
+    stream << value.size() << '\n';
+    stream.write(value.data(), value.size());
+    stream << '\n';
+}
+
+bool readString(std::istream& stream, std::string& value)
+{
+    size_t size = 0;
+    if (!(stream >> size) || stream.get() != '\n') {
+        return false;
+    }
+    value.resize(size);
+    if (!stream.read(&value[0], size)) {
+        return false;
+    }
+    return stream.get() == '\n';
+}
+
+bool readCount(std::istream& stream, size_t& count)
+{
+    std::string value;
+    if (!readString(stream, value)) {
+        return false;
+    }
+    count = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+    return true;
+}
+
+void writeEntry(std::ostream& stream, const std::string& key, const OgsFragmentCache::Entry& entry)
+{
+    writeString(stream, ENTRY_HEADER);
+    writeString(stream, key);
+    writeString(stream, entry.fragmentName);
+    writeString(stream, entry.fragmentSource);
+    writeString(stream, entry.lightRigName);
+    writeString(stream, entry.lightRigSource);
+    writeString(stream, entry.transparent ? "1" : "0");
+    writeString(stream, std::to_string(entry.pathInputMap.size()));
+    for (const auto& pathInput : entry.pathInputMap) {
+        writeString(stream, pathInput.first);
+        writeString(stream, pathInput.second);
+    }
+    writeString(stream, std::to_string(entry.vertexInputNames.size()));
+    for (const std::string& name : entry.vertexInputNames) {
+        writeString(stream, name);
+    }
+}
+
+bool readEntry(std::istream& stream, const std::string& key, OgsFragmentCache::Entry& entry)
+{
+    std::string header, storedKey, transparent;
+    if (!readString(stream, header) || header != ENTRY_HEADER || !readString(stream, storedKey)
+        || storedKey != key) {
+        return false;
+    }
+
+    if (!readString(stream, entry.fragmentName) || !readString(stream, entry.fragmentSource)
+        || !readString(stream, entry.lightRigName) || !readString(stream, entry.lightRigSource)
+        || !readString(stream, transparent)) {
+        return false;
+    }
+    entry.transparent = (transparent == "1");
+
+    size_t count = 0;
+    if (!readCount(stream, count)) {
+        return false;
+    }
+    entry.pathInputMap.clear();
+    for (size_t i = 0; i < count; ++i) {
+        std::string path, input;
+        if (!readString(stream, path) || !readString(stream, input)) {
+            return false;
+        }
+        entry.pathInputMap[path] = input;
+    }
+
+    if (!readCount(stream, count)) {
+        return false;
+    }
+    entry.vertexInputNames.resize(count);
+    for (std::string& name : entry.vertexInputNames) {
+        if (!readString(stream, name)) {
+            return false;
+        }
+    }
+    return !entry.fragmentName.empty() && !entry.fragmentSource.empty();
+}
+
+} // anonymous namespace
+
+OgsFragmentCache& OgsFragmentCache::get()
+{
+    static OgsFragmentCache cache(defaultDirectory(), defaultMaxSize());
+    return cache;
+}
+
+OgsFragmentCache::OgsFragmentCache(const std::string& directory, size_t maxSize)
+    : _directory(directory)
+    , _maxSize(directory.empty() ? 0 : maxSize)
+{
+}
+
+bool OgsFragmentCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxSize > 0;
+}
+
+std::string OgsFragmentCache::getDirectory() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _directory;
+}
+
+void OgsFragmentCache::setDirectory(const std::string& directory, size_t maxSize)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _directory = directory;
+    _maxSize = directory.empty() ? 0 : maxSize;
+    _sizeKnown = false;
+    _trustChecked = false;
+}
+
+std::string OgsFragmentCache::computeKey(
+    const mx::ElementPtr&     element,
+    const mx::FileSearchPath& librarySearchPath)
+{
+    if (!element) {
+        return std::string();
+    }
+
+    // Library elements imported into the document are covered by the library
+    // search path and the MaterialX version, only the network itself is written.
+    mx::XmlWriteOptions writeOptions;
+    writeOptions.elementPredicate
+        = [](mx::ConstElementPtr element) { return !element->hasSourceUri(); };
+
+    std::ostringstream key;
+    key << "mayaUsd " << TOSTRING(MAYAUSD_VERSION) << '\n'
+        << "MaterialX " << mx::getVersionString() << '\n'
+        << "lightAPI " << mx::OgsXmlGenerator::useLightAPI() << '\n'
+        << "environment " << OgsFragment::getSpecularEnvKey() << '\n'
+        << "libraries " << librarySearchPath.asString() << '\n'
+        << "element " << element->getNamePath() << '\n'
+        << mx::writeToXmlString(element->getDocument(), &writeOptions);
+    return key.str();
+}
+
+std::string OgsFragmentCache::_entryPath(const std::string& key) const
+{
+    // The name must be the same in all the Maya sessions sharing the cache.
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0')
+         << PXR_NS::ArchHash64(key.data(), key.size()) << ENTRY_EXTENSION;
+    return (fs::path(_directory) / name.str()).string();
+}
+
+bool OgsFragmentCache::load(const std::string& key, Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_maxSize == 0) {
+        return false;
+    }
+
+    if (!_isTrusted()) {
+        ++_missCount;
+        return false;
+    }
+
+    const std::string path = _entryPath(key);
+    bool              found = false;
+    {
+        std::ifstream stream(path, std::ios::binary);
+        found = stream && readEntry(stream, key, entry);
+    }
+
+    if (found) {
+        // Mark the entry as recently used for eviction.
+        std::error_code ec;
+        fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        ++_hitCount;
+    } else {
+        ++_missCount;
+    }
+    return found;
+}
+
+void OgsFragmentCache::store(const std::string& key, const Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_maxSize == 0) {
+        return;
+    }
+
+    std::error_code ec;
+    if (fs::create_directories(_directory, ec)) {
+        fs::permissions(_directory, fs::perms::owner_all, ec);
+        _trustChecked = false;
+    }
+    if (ec || !_isTrusted()) {
+        return;
+    }
+
+    // Write to a temporary file first, so that other Maya sessions sharing the
+    // cache never read a partial entry. The temporary file is named after the
+    // process, the mutex serializing the writes within a process.
+    const std::string path = _entryPath(key);
+    const std::string tmpPath = path + ".tmp" + std::to_string(PXR_NS::ArchGetProcessId());
+    {
+        std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            return;
+        }
+        writeEntry(stream, key, entry);
+        if (!stream) {
+            stream.close();
+            fs::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    if (!_sizeKnown) {
+        _size = _computeSize();
+        _sizeKnown = true;
+    }
+
+    const uintmax_t previousSize = fs::file_size(path, ec);
+    if (ec == std::error_code()) {
+        _size -= std::min<size_t>(_size, static_cast<size_t>(previousSize));
+    }
+
+    fs::rename(tmpPath, path, ec);
+    if (ec) {
+        fs::remove(tmpPath, ec);
+        return;
+    }
+
+    const uintmax_t size = fs::file_size(path, ec);
+    if (ec == std::error_code()) {
+        _size += static_cast<size_t>(size);
+    }
+
+    if (_size > _maxSize) {
+        _evict();
+    }
+}
+
+void OgsFragmentCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::error_code ec;
+    for (fs::directory_iterator it(_directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ENTRY_EXTENSION) {
+            std::error_code removeEc;
+            fs::remove(it->path(), removeEc);
+        }
+    }
+    _size = 0;
+    _sizeKnown = true;
+    _hitCount = 0;
+    _missCount = 0;
+}
+
+size_t OgsFragmentCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hitCount;
+}
+
+size_t OgsFragmentCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _missCount;
+}
+
+bool OgsFragmentCache::_isTrusted()
+{
+    if (!_trustChecked) {
+        _trusted = isPrivateDirectory(_directory);
+        _trustChecked = true;
+    }
+    return _trusted;
+}
+
+size_t OgsFragmentCache::_computeSize() const
+{
+    size_t          size = 0;
+    std::error_code ec;
+    for (fs::directory_iterator it(_directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ENTRY_EXTENSION) {
+            std::error_code sizeEc;
+            const uintmax_t fileSize = fs::file_size(it->path(), sizeEc);
+            if (!sizeEc) {
+                size += static_cast<size_t>(fileSize);
+            }
+        }
+    }
+    return size;
+}
+
+void OgsFragmentCache::_evict()
+{
+    struct EntryFile
+    {
+        fs::path           path;
+        fs::file_time_type lastUse;
+        size_t             size;
+    };
+
+    // Entries may also have been added or removed by other Maya sessions, so
+    // the directory is scanned again.
+    std::vector<EntryFile> files;
+    size_t                 totalSize = 0;
+    std::error_code        ec;
+    for (fs::directory_iterator it(_directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != ENTRY_EXTENSION) {
+            continue;
+        }
+        std::error_code fileEc;
+        EntryFile       file { it->path(), fs::last_write_time(it->path(), fileEc), 0 };
+        const uintmax_t fileSize = fs::file_size(it->path(), fileEc);
+        if (fileEc) {
+            continue;
+        }
+        file.size = static_cast<size_t>(fileSize);
+        totalSize += file.size;
+        files.push_back(std::move(file));
+    }
+
+    std::sort(files.begin(), files.end(), [](const EntryFile& a, const EntryFile& b) {
+        return a.lastUse < b.lastUse;
+    });
+
+    const size_t targetSize = _maxSize / EVICTION_DENOMINATOR * EVICTION_NUMERATOR;
+    for (const EntryFile& file : files) {
+        if (totalSize <= targetSize) {
+            break;
+        }
+        std::error_code removeEc;
+        if (fs::remove(file.path, removeEc)) {
+            totalSize -= file.size;
+        }
+    }
+    _size = totalSize;
+}
+
+} // namespace MaterialXMaya
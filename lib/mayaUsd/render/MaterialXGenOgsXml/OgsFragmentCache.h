@@ -0,0 +1,108 @@
+#ifndef MATERIALX_MAYA_OGSFRAGMENTCACHE_H
+#define MATERIALX_MAYA_OGSFRAGMENTCACHE_H
+
+/// @file
+/// Persistent on-disk cache of generated OGS fragments.
+
+#include <MaterialXCore/Document.h>
+#include <MaterialXFormat/File.h>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+namespace mx = MaterialX;
+namespace MaterialXMaya {
+/// @class OgsFragmentCache
+/// Stores the result of OGS fragment generation on disk, so that the GLSL and
+/// XML code generation for a MaterialX network only runs once across Maya
+/// sessions.
+///
+/// Entries are addressed by a key computed from the MaterialX document, the
+/// element to render, the MaterialX and plugin versions and the generator
+/// options. The full key is stored in each entry and compared on load, so a
+/// hash collision can never return the fragment of another network.
+///
+/// The cache directory defaults to "cache/mayaUsdMaterialXFragments" in the Maya
+/// user application directory and can be set with the
+/// MAYAUSD_MATERIALX_FRAGMENT_CACHE_DIR environment variable. Entries are only
+/// read from and written to a directory that other users cannot write to.
+/// MAYAUSD_MATERIALX_FRAGMENT_CACHE_SIZE_MB sets the size limit (256 MB by
+/// default, 0 disables the cache). The least recently used entries are evicted
+/// when the limit is exceeded.
+///
+class OgsFragmentCache
+{
+public:
+    /// The generated data stored for a fragment.
+    struct Entry
+    {
+        std::string   fragmentName;
+        std::string   fragmentSource;
+        std::string   lightRigName;
+        std::string   lightRigSource;
+        mx::StringMap pathInputMap;
+        mx::StringVec vertexInputNames;
+        bool          transparent = false;
+    };
+
+    /// Return the cache shared by all fragments, configured from the environment.
+    static OgsFragmentCache& get();
+
+    OgsFragmentCache(const std::string& directory, size_t maxSize);
+
+    OgsFragmentCache(const OgsFragmentCache&) = delete;
+    OgsFragmentCache& operator=(const OgsFragmentCache&) = delete;
+
+    /// Return whether fragments are looked up and stored.
+    bool isEnabled() const;
+
+    /// Return the directory holding the cache entries.
+    std::string getDirectory() const;
+
+    /// Set the directory holding the cache entries and its size limit in bytes.
+    /// A size of 0 disables the cache.
+    void setDirectory(const std::string& directory, size_t maxSize);
+
+    /// Compute the key of the fragment generated for an element with the given
+    /// library search path.
+    static std::string
+    computeKey(const mx::ElementPtr& element, const mx::FileSearchPath& librarySearchPath);
+
+    /// Read the entry stored for a key.
+    /// @return false if there is no such entry.
+    bool load(const std::string& key, Entry& entry);
+
+    /// Write the entry for a key, evicting old entries if the cache becomes
+    /// too large.
+    void store(const std::string& key, const Entry& entry);
+
+    /// Remove all the entries.
+    void clear();
+
+    /// Return the number of successful loads.
+    size_t getHitCount() const;
+
+    /// Return the number of failed loads.
+    size_t getMissCount() const;
+
+private:
+    std::string _entryPath(const std::string& key) const;
+    bool        _isTrusted();
+    size_t      _computeSize() const;
+    void        _evict();
+
+    mutable std::mutex _mutex;
+    std::string        _directory;       ///< Where the entries are stored.
+    size_t             _maxSize = 0;     ///< The size limit in bytes, 0 to disable.
+    size_t             _size = 0;        ///< The size of the entries, once computed.
+    bool               _sizeKnown = false;
+    bool               _trusted = false; ///< Whether only the user can write the entries.
+    bool               _trustChecked = false;
+    size_t             _hitCount = 0;
+    size_t             _missCount = 0;
+};
+
+} // namespace MaterialXMaya
+
+#endif
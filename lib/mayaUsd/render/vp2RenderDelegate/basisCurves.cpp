@@ -24,9 +24,11 @@
 #include "render_delegate.h"
 #include "tokens.h"
 
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/matrix4f.h>
 #include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 #include <pxr/imaging/hd/tokens.h>
@@ -135,6 +137,28 @@ VtArray<T> InterpolateVarying(
     return outputValues;
 }
 
+//! Number of curves from which the index arrays are built in parallel, as for groom assets.
+constexpr size_t kParallelCurveCount = 1000;
+
+//! Call fn(begin, end) over the range of curves, in parallel when there are enough of them.
+template <typename Fn> void _ForEachCurveRange(size_t numCurves, Fn&& fn)
+{
+    if (numCurves < kParallelCurveCount) {
+        fn(size_t(0), numCurves);
+    } else {
+        WorkParallelForN(numCurves, std::forward<Fn>(fn));
+    }
+}
+
+//! Map a generated vertex index with the indices of the topology, if it has any.
+inline int _MapCurveIndex(int index, const VtIntArray& curveIndices)
+{
+    if (curveIndices.empty()) {
+        return index;
+    }
+    return curveIndices[std::min(index, static_cast<int>(curveIndices.size()) - 1)];
+}
+
 VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
 {
     /*
@@ -173,118 +197,87 @@ VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
                                    [======= seg4 =======]
                                           [======= seg5 =======]
     */
-    std::vector<GfVec4i> indices;
-
-    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
-    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                vStep;
-    TfToken            basis = topology.GetCurveBasis();
-    if (basis == HdTokens->bezier) {
-        vStep = 3;
-    } else {
-        vStep = 1;
-    }
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int count = *itCounts;
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    const bool        wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int         vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+    const size_t      numCurves = vertexCounts.size();
+
+    // Offsets of the first vertex and of the first segment of each curve, so
+    // that the curves can be processed independently.
+    std::vector<int> vertexOffsets(numCurves);
+    std::vector<int> segmentOffsets(numCurves + 1);
+    int              vertexIndex = 0;
+    int              segmentIndex = 0;
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        const int count = vertexCounts[curve];
         // The first segment always eats up 4 verts, not just vstep, so to
         // compensate, we break at count - 3.
-        int numSegs;
-
         // If we're closing the curve, make sure that we have enough
         // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for (int i = 0; i < numSegs; ++i) {
+        const int numSegs = wrap ? count / vStep : ((count - 4) / vStep) + 1;
 
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int     offset = i * vStep;
-            for (int v = 0; v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
-                              : vertexIndex + std::min(offset + v, (count - 1));
-            }
-            indices.push_back(seg);
-        }
+        vertexOffsets[curve] = vertexIndex;
+        segmentOffsets[curve] = segmentIndex;
         vertexIndex += count;
+        segmentIndex += std::max(numSegs, 0);
     }
-
-    VtVec4iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec4i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
+    segmentOffsets[numCurves] = segmentIndex;
+
+    VtVec4iArray finalIndices(segmentIndex);
+    GfVec4i*     segments = finalIndices.data();
+    _ForEachCurveRange(numCurves, [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            const int count = vertexCounts[curve];
+            const int firstVertex = vertexOffsets[curve];
+            for (int s = segmentOffsets[curve]; s < segmentOffsets[curve + 1]; ++s) {
+                // Set up curve segments based on curve basis
+                const int offset = (s - segmentOffsets[curve]) * vStep;
+                GfVec4i&  seg = segments[s];
+                for (int v = 0; v < 4; ++v) {
+                    // If there are not enough verts to round out the segment
+                    // just repeat the last vert.
+                    const int index = wrap ? firstVertex + ((offset + v) % count)
+                                           : firstVertex + std::min(offset + v, (count - 1));
+                    // If have topology has indices set, map the generated indices
+                    // with the given indices.
+                    seg[v] = _MapCurveIndex(index, curveIndices);
+                }
+            }
         }
-    }
+    });
 
     return VtValue(finalIndices);
 }
 
 VtValue _BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
 {
-    std::vector<GfVec2i> indices;
-    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        for (int i = 0; i < *itCounts; i += 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-        }
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    const size_t      numCurves = vertexCounts.size();
+
+    // Each curve is made of pairs of vertices: offset of the first pair of each curve.
+    std::vector<int> lineOffsets(numCurves + 1);
+    int              lineIndex = 0;
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        lineOffsets[curve] = lineIndex;
+        lineIndex += std::max((vertexCounts[curve] + 1) / 2, 0);
     }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
+    lineOffsets[numCurves] = lineIndex;
+
+    VtVec2iArray finalIndices(lineIndex);
+    GfVec2i*     lines = finalIndices.data();
+    _ForEachCurveRange(numCurves, [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            for (int line = lineOffsets[curve]; line < lineOffsets[curve + 1]; ++line) {
+                // If have topology has indices set, map the generated indices
+                // with the given indices.
+                lines[line].Set(
+                    _MapCurveIndex(2 * line, curveIndices),
+                    _MapCurveIndex(2 * line + 1, curveIndices));
+            }
         }
-    }
+    });
 
     return VtValue(finalIndices);
 }
@@ -294,56 +287,92 @@ VtValue _BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
     const TfToken basis = topology.GetCurveBasis();
     const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
 
-    std::vector<GfVec2i> indices;
-    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
-    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                  vertexIndex = 0; // Index of next vertex to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++vertexIndex;
-        for (int i = 1; i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
-                indices.push_back(GfVec2i(v0, v1));
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    const bool        wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const size_t      numCurves = vertexCounts.size();
+
+    // Offsets of the first vertex and of the first segment of each curve, so
+    // that the curves can be processed independently. A curve always uses at
+    // least one vertex.
+    std::vector<int> vertexOffsets(numCurves);
+    std::vector<int> segmentOffsets(numCurves + 1);
+    int              vertexIndex = 0;
+    int              segmentIndex = 0;
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        const int count = vertexCounts[curve];
+        const int numSegs = skipFirstAndLastSegs ? count - 3 : count - 1;
+
+        vertexOffsets[curve] = vertexIndex;
+        segmentOffsets[curve] = segmentIndex;
+        vertexIndex += std::max(count, 1);
+        segmentIndex += std::max(numSegs, 0) + (wrap ? 1 : 0);
+    }
+    segmentOffsets[numCurves] = segmentIndex;
+
+    VtVec2iArray finalIndices(segmentIndex);
+    GfVec2i*     segments = finalIndices.data();
+    _ForEachCurveRange(numCurves, [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            const int count = vertexCounts[curve];
+            const int firstVert = vertexOffsets[curve];
+            int       s = segmentOffsets[curve];
+            for (int i = 1; i < count; ++i) {
+                if (!skipFirstAndLastSegs || (i > 1 && i < count - 1)) {
+                    // If have topology has indices set, map the generated indices
+                    // with the given indices.
+                    segments[s++].Set(
+                        _MapCurveIndex(firstVert + i - 1, curveIndices),
+                        _MapCurveIndex(firstVert + i, curveIndices));
+                }
+            }
+            if (wrap) {
+                const int lastVert = firstVert + std::max(count, 1) - 1;
+                segments[s++].Set(
+                    _MapCurveIndex(lastVert, curveIndices),
+                    _MapCurveIndex(firstVert, curveIndices));
             }
-            v0 = v1;
-        }
-        if (wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
         }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
+    });
 
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
+    return VtValue(finalIndices);
+}
 
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
+//! Return the index array of the given kind for the topology, shared with the
+//! other Rprims with the same topology through the resource registry.
+HdVP2ResourceRegistry::SharedIndexArray _GetSharedIndexArray(
+    HdVP2ResourceRegistry&                     registry,
+    const HdBasisCurvesTopology&               topology,
+    HdVP2BasisCurvesSharedData::IndexArrayKind kind)
+{
+    const int      kindValue = static_cast<int>(kind);
+    const uint64_t id = ArchHash64(
+        reinterpret_cast<const char*>(&kindValue), sizeof(kindValue), topology.ComputeHash());
 
-            finalIndices[lineNum].Set(v0, v1);
+    bool found = false;
+    {
+        auto instance = registry.FindBasisCurvesIndices(id, &found);
+        if (found) {
+            return instance.GetValue();
         }
     }
 
-    return VtValue(finalIndices);
+    // Build outside of the registry lock: the build can run parallel tasks,
+    // which could otherwise wait on the lock held by their own thread.
+    VtValue indices;
+    if (kind == HdVP2BasisCurvesSharedData::kCubicIndices) {
+        indices = _BuildCubicIndexArray(topology);
+    } else if (kind == HdVP2BasisCurvesSharedData::kLinesIndices) {
+        indices = _BuildLinesIndexArray(topology);
+    } else {
+        indices = _BuildLineSegmentIndexArray(topology);
+    }
+
+    auto instance = registry.RegisterBasisCurvesIndices(id);
+    if (instance.IsFirstInstance()) {
+        instance.SetValue(std::make_shared<const VtValue>(std::move(indices)));
+    }
+    return instance.GetValue();
 }
 
 template <typename BaseType>
@@ -455,6 +484,9 @@ void HdVP2BasisCurves::Sync(
 
     if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
         _curvesSharedData._topology = GetBasisCurvesTopology(delegate);
+        for (auto& indexArray : _curvesSharedData._indexArrays) {
+            indexArray.reset();
+        }
     }
 
     // Prepare position buffer. It is shared among all draw items so it should
@@ -560,6 +592,10 @@ void HdVP2BasisCurves::_UpdateDrawItem(
     // draw.
     const bool isBoundingBoxItem = (drawMode & MHWRender::MGeometry::kBoundingBox) != 0;
     const bool isHighlightItem = drawItem->ContainsUsage(HdVP2DrawItem::kSelectionHighlight);
+    // The authored instance colors only change with the primvars, the instance state of a
+    // highlight item keeps them in between.
+    const bool authoredColorsDirty
+        = itemDirtyBits & (HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyDisplayStyle);
     const bool inTemplateMode = _displayLayerModes._displayType == MayaUsdRPrim::kTemplate;
     const bool inReferenceMode = _displayLayerModes._displayType == MayaUsdRPrim::kReference;
 
@@ -576,15 +612,21 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
         const bool forceLines = (refineLevel <= 0) || (drawMode & MHWRender::MGeometry::kWireframe);
 
-        VtValue result;
-
+        HdVP2BasisCurvesSharedData::IndexArrayKind kind;
         if (!forceLines && type == HdTokens->cubic) {
-            result = _BuildCubicIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kCubicIndices;
         } else if (wrap == HdTokens->segmented) {
-            result = _BuildLinesIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kLinesIndices;
         } else {
-            result = _BuildLineSegmentIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kLineSegmentsIndices;
+        }
+
+        auto& indexArray = _curvesSharedData._indexArrays[kind];
+        if (!indexArray) {
+            indexArray
+                = _GetSharedIndexArray(_delegate->GetVP2ResourceRegistry(), topology, kind);
         }
+        const VtValue& result = *indexArray;
 
         const void*  indexData = nullptr;
         unsigned int numIndices = 0;
@@ -857,7 +899,7 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
                     _CommitMVertexBuffer(_curvesSharedData._colorBuffer.get(), bufferData);
                 }
-            } else if (prepareInstanceColorBuffer) {
+            } else if (prepareInstanceColorBuffer && (!isHighlightItem || authoredColorsDirty)) {
                 TF_VERIFY(
                     colorInterpolation == HdInterpolationInstance
                     || alphaInterpolation == HdInterpolationInstance);
@@ -901,7 +943,8 @@ void HdVP2BasisCurves::_UpdateDrawItem(
     // If the prim is instanced, create one new instance per transform.
     // The current instancer invalidation tracking makes it hard for
     // us to tell whether transforms will be dirty, so this code
-    // pulls them every time something changes.
+    // pulls them every time something changes, and the instance state
+    // only updates what differs from the previous sync.
     // If the mesh is instanced but has 0 instance transforms remember that
     // so the render item can be hidden.
 
@@ -913,74 +956,45 @@ void HdVP2BasisCurves::_UpdateDrawItem(
         VtMatrix4dArray transforms
             = static_cast<HdVP2Instancer*>(instancer)->ComputeInstanceTransforms(id);
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        HdVP2InstanceState& instanceState = drawItemData._instanceState;
+        if (itemDirtyBits
+            & (HdChangeTracker::DirtyInstancer | HdChangeTracker::DirtyInstanceIndex)) {
+            instanceState.Reset();
+        }
 
-        if (0 == instanceCount) {
-            instancerWithNoInstances = true;
-        } else {
-            stateToCommit._instanceTransforms->setLength(instanceCount);
-            for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
-                (*stateToCommit._instanceTransforms)[i] = worldMatrix * instanceMatrix;
-                stateToCommit._ufeIdentifiers.append(
-                    drawScene.GetScenePrimPath(GetId(), i).GetString().c_str());
-            }
+        auto identifierFn = [&drawScene, &id](unsigned int i) {
+            return MString(drawScene.GetScenePrimPath(id, i).GetString().c_str());
+        };
+        if (instanceState.UpdateTransforms(worldMatrix, transforms, identifierFn)) {
+            stateToCommit._ufeIdentifiers = instanceState.GetUfeIdentifiers();
+        }
+        stateToCommit._instanceTransforms = instanceState.GetTransforms();
+        stateToCommit._instanceTransformsVersion = instanceState.GetTransformsVersion();
 
+        if (transforms.empty()) {
+            instancerWithNoInstances = true;
+        } else if (isHighlightItem) {
             // If the item is used for both regular draw and selection highlight,
             // it needs to display both wireframe color and selection highlight
             // with one color vertex buffer.
-            if (isHighlightItem) {
-                const MColor colors[]
-                    = { drawScene.GetWireframeColor(),
-                        drawScene.GetSelectionHighlightColor(HdPrimTypeTokens->basisCurves),
-                        drawScene.GetSelectionHighlightColor() };
-
-                // Store the indices to colors.
-                std::vector<unsigned char> colorIndices;
-
-                // Assign with the index to the dormant wireframe color by default.
-                bool         hasAuthoredColor = stateToCommit._instanceColors->length() > 0;
-                const size_t authoredColorIndex = sizeof(colors) / sizeof(MColor);
-                colorIndices.resize(instanceCount, hasAuthoredColor ? authoredColorIndex : 0);
-
-                // Assign with the index to the active selection highlight color.
-                if (auto state = drawScene.GetActiveSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 1;
-                        }
-                    }
-                }
-
-                // Assign with the index to the lead selection highlight color.
-                if (auto state = drawScene.GetLeadSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 2;
-                        }
-                    }
-                }
-
-                // Fill per-instance colors.
-                stateToCommit._instanceColors->setLength(instanceCount * kNumColorChannels);
-                unsigned int offset = 0;
-
-                for (unsigned int i = 0; i < instanceCount; ++i) {
-                    unsigned char colorIndex = colorIndices[i];
-                    if (colorIndex == authoredColorIndex) {
-                        offset += kNumColorChannels;
-                        continue;
-                    }
-                    const MColor& color = colors[colorIndex];
-                    for (unsigned int j = 0; j < kNumColorChannels; j++) {
-                        (*stateToCommit._instanceColors)[offset++] = color[j];
-                    }
-                }
+            const MColor colors[]
+                = { drawScene.GetWireframeColor(),
+                    drawScene.GetSelectionHighlightColor(HdPrimTypeTokens->basisCurves),
+                    drawScene.GetSelectionHighlightColor() };
+
+            // The dormant instances keep their authored color, if any.
+            if (authoredColorsDirty) {
+                instanceState.SetAuthoredColors(*stateToCommit._instanceColors);
             }
+            instanceState.UpdateColors(
+                colors, drawScene.GetActiveSelectionState(id), drawScene.GetLeadSelectionState(id));
+            stateToCommit._instanceColors = instanceState.GetColors();
+            stateToCommit._instanceColorsVersion = instanceState.GetColorsVersion();
         }
     } else {
         // Non-instanced Rprims.
+        drawItemData._instanceState.Reset();
+
         if (itemDirtyBits & (DirtySelectionHighlight | HdChangeTracker::DirtyDisplayStyle)) {
             if (drawItem->ContainsUsage(HdVP2DrawItem::kRegular) && isHighlightItem) {
                 MHWRender::MShaderInstance* shader = nullptr;
@@ -1181,21 +1195,34 @@ void HdVP2BasisCurves::_UpdateDrawItem(
             extraColorChannelName = kSolidColorStr;
         }
 
+        // The arrays of the instance state are only uploaded when their version changed,
+        // the other ones are new at each commit.
+        auto& committedTransformsVersion
+            = stateToCommit._renderItemData._committedInstanceTransformsVersion;
+        auto& committedColorsVersion
+            = stateToCommit._renderItemData._committedInstanceColorsVersion;
+        const bool transformsChanged = stateToCommit._instanceTransformsVersion == 0
+            || stateToCommit._instanceTransformsVersion != committedTransformsVersion;
+        const bool colorsChanged = transformsChanged || stateToCommit._instanceColorsVersion == 0
+            || stateToCommit._instanceColorsVersion != committedColorsVersion;
+
         // GPU instancing has been enabled. We cannot switch to consolidation
         // without recreating render item, so we keep using GPU instancing.
         if (stateToCommit._renderItemData._usingInstancedDraw) {
-            if (oldInstanceCount == newInstanceCount) {
+            if (oldInstanceCount != newInstanceCount) {
+                drawScene.setInstanceTransformArray(
+                    *renderItem, *stateToCommit._instanceTransforms);
+            } else if (transformsChanged) {
                 for (unsigned int i = 0; i < newInstanceCount; i++) {
                     // VP2 defines instance ID of the first instance to be 1.
                     drawScene.updateInstanceTransform(
                         *renderItem, i + 1, (*stateToCommit._instanceTransforms)[i]);
                 }
-            } else {
-                drawScene.setInstanceTransformArray(
-                    *renderItem, *stateToCommit._instanceTransforms);
             }
 
-            if (stateToCommit._instanceColors->length() == newInstanceCount * kNumColorChannels) {
+            if (colorsChanged
+                && stateToCommit._instanceColors->length()
+                    == newInstanceCount * kNumColorChannels) {
                 drawScene.setExtraInstanceData(
                     *renderItem, extraColorChannelName, *stateToCommit._instanceColors);
             }
@@ -1227,6 +1254,8 @@ void HdVP2BasisCurves::_UpdateDrawItem(
         }
 
         oldInstanceCount = newInstanceCount;
+        committedTransformsVersion = stateToCommit._instanceTransformsVersion;
+        committedColorsVersion = stateToCommit._instanceColorsVersion;
 #ifdef MAYA_MRENDERITEM_UFE_IDENTIFIER_SUPPORT
         if (stateToCommit._ufeIdentifiers.length() > 0) {
             drawScene.setUfeIdentifiers(*renderItem, stateToCommit._ufeIdentifiers);
@@ -54,6 +54,19 @@ struct HdVP2BasisCurvesSharedData
     //! copy.
     HdBasisCurvesTopology _topology;
 
+    //! Kinds of index arrays built from the topology, depending on the draw items.
+    enum IndexArrayKind
+    {
+        kCubicIndices,
+        kLinesIndices,
+        kLineSegmentsIndices,
+        kIndexArrayKindCount
+    };
+
+    //! Index arrays built from the topology. They are shared with the other
+    //! Rprims that have the same topology, and reset when the topology changes.
+    std::shared_ptr<const VtValue> _indexArrays[kIndexArrayKindCount];
+
     //! A local cache of primvar scene data. "data" is a copy-on-write handle to
     //! the actual primvar buffer, and "interpolation" is the interpolation mode
     //! to be used.
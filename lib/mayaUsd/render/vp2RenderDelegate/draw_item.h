@@ -16,6 +16,8 @@
 #ifndef HD_VP2_DRAW_ITEM
 #define HD_VP2_DRAW_ITEM
 
+#include "instanceState.h"
+
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/imaging/hd/drawItem.h>
@@ -68,6 +70,13 @@ public:
         //! Instance colors for the render item
         std::shared_ptr<MFloatArray> _instanceColors;
 
+        //! Instances of the render item, updated incrementally by the non-mesh rprims
+        HdVP2InstanceState _instanceState;
+
+        //! Versions of the instance state arrays last set on the render item
+        uint64_t _committedInstanceTransformsVersion { 0 };
+        uint64_t _committedInstanceColorsVersion { 0 };
+
         //! Shader instance assigned to the render item. No ownership is held.
         MHWRender::MShaderInstance* _shader { nullptr };
 
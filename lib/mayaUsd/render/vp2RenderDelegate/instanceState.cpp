@@ -0,0 +1,203 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "instanceState.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Call fn with the index of each selected instance, ignoring the invalid ones.
+template <typename Fn>
+void _ForEachSelectedInstance(
+    const HdSelection::PrimSelectionState* state,
+    unsigned int                           instanceCount,
+    Fn                                     fn)
+{
+    if (!state) {
+        return;
+    }
+
+    for (const VtIntArray& indexArray : state->instanceIndices) {
+        for (const int index : indexArray) {
+            if (index >= 0 && static_cast<unsigned int>(index) < instanceCount) {
+                fn(static_cast<unsigned int>(index));
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool HdVP2InstanceState::UpdateTransforms(
+    const MMatrix&         worldMatrix,
+    const VtMatrix4dArray& transforms,
+    const IdentifierFn&    identifierFn)
+{
+    const bool instancerTransformsChanged = !_transforms || transforms != _instancerTransforms;
+    if (!instancerTransformsChanged && worldMatrix == _worldMatrix) {
+        return false;
+    }
+
+    // Always a new array: the previous one can still be used by a commit.
+    const unsigned int instanceCount = transforms.size();
+    auto               newTransforms = std::make_shared<MMatrixArray>();
+    newTransforms->setLength(instanceCount);
+
+    MMatrix instanceMatrix;
+    for (unsigned int i = 0; i < instanceCount; ++i) {
+        transforms[i].Get(instanceMatrix.matrix);
+        (*newTransforms)[i] = worldMatrix * instanceMatrix;
+    }
+    _transforms = std::move(newTransforms);
+    _worldMatrix = worldMatrix;
+    ++_transformsVersion;
+
+    if (instancerTransformsChanged) {
+        _instancerTransforms = transforms;
+        _ufeIdentifiers.clear();
+        for (unsigned int i = 0; i < instanceCount; ++i) {
+            _ufeIdentifiers.append(identifierFn(i));
+        }
+    }
+
+    return true;
+}
+
+bool HdVP2InstanceState::SetAuthoredColors(const MFloatArray& authoredColors)
+{
+    const unsigned int length = authoredColors.length();
+    bool               changed = (length != _authoredColors.length());
+    for (unsigned int i = 0; i < length && !changed; ++i) {
+        changed = (authoredColors[i] != _authoredColors[i]);
+    }
+
+    if (changed) {
+        _authoredColors = authoredColors;
+        _authoredColorsChanged = true;
+    }
+    return changed;
+}
+
+bool HdVP2InstanceState::UpdateColors(
+    const MColor                           colors[kNumHighlightColors],
+    const HdSelection::PrimSelectionState* activeState,
+    const HdSelection::PrimSelectionState* leadState)
+{
+    const unsigned int instanceCount = GetInstanceCount();
+
+    bool rebuild = !_colors || _states.size() != instanceCount || _authoredColorsChanged;
+    for (unsigned int i = 0; i < kNumHighlightColors && !rebuild; ++i) {
+        rebuild = (colors[i] != _colorsUsed[i]);
+    }
+
+    if (rebuild) {
+        for (unsigned int i = 0; i < kNumHighlightColors; ++i) {
+            _colorsUsed[i] = colors[i];
+        }
+        _authoredColorsChanged = false;
+
+        _states.assign(instanceCount, _DormantState());
+        _pendingStates.resize(instanceCount);
+        _highlightedIndices.clear();
+        _ForEachSelectedInstance(activeState, instanceCount, [this](unsigned int index) {
+            _states[index] = kActive;
+            _highlightedIndices.push_back(index);
+        });
+        _ForEachSelectedInstance(leadState, instanceCount, [this](unsigned int index) {
+            _states[index] = kLead;
+            _highlightedIndices.push_back(index);
+        });
+
+        _colors = std::make_shared<MFloatArray>(instanceCount * kNumColorChannels);
+        for (unsigned int i = 0; i < instanceCount; ++i) {
+            _WriteColor(i);
+        }
+        ++_colorsVersion;
+        return true;
+    }
+
+    // Only the instances highlighted before or now can change: compute their
+    // new state, then update the ones that differ.
+    std::vector<unsigned int> highlightedIndices;
+    const unsigned char       dormantState = _DormantState();
+    for (const unsigned int index : _highlightedIndices) {
+        _pendingStates[index] = dormantState;
+    }
+    _ForEachSelectedInstance(activeState, instanceCount, [&](unsigned int index) {
+        _pendingStates[index] = kActive;
+        highlightedIndices.push_back(index);
+    });
+    _ForEachSelectedInstance(leadState, instanceCount, [&](unsigned int index) {
+        _pendingStates[index] = kLead;
+        highlightedIndices.push_back(index);
+    });
+
+    bool changed = false;
+    auto updateState = [&](unsigned int index) {
+        if (_states[index] == _pendingStates[index]) {
+            return;
+        }
+        // Copy the colors on first write if a commit still uses them.
+        if (!changed && _colors.use_count() > 1) {
+            _colors = std::make_shared<MFloatArray>(*_colors);
+        }
+        changed = true;
+        _states[index] = _pendingStates[index];
+        _WriteColor(index);
+    };
+    for (const unsigned int index : _highlightedIndices) {
+        updateState(index);
+    }
+    for (const unsigned int index : highlightedIndices) {
+        updateState(index);
+    }
+    _highlightedIndices = std::move(highlightedIndices);
+
+    if (changed) {
+        ++_colorsVersion;
+    }
+    return changed;
+}
+
+void HdVP2InstanceState::Reset()
+{
+    _worldMatrix = MMatrix();
+    _instancerTransforms = VtMatrix4dArray();
+    _transforms.reset();
+    _ufeIdentifiers.clear();
+
+    _authoredColors.clear();
+    _authoredColorsChanged = false;
+    _states.clear();
+    _pendingStates.clear();
+    _highlightedIndices.clear();
+    _colors.reset();
+}
+
+void HdVP2InstanceState::_WriteColor(unsigned int index)
+{
+    const unsigned int  offset = index * kNumColorChannels;
+    const unsigned char state = _states[index];
+    for (unsigned int j = 0; j < kNumColorChannels; ++j) {
+        if (state != kAuthored) {
+            (*_colors)[offset + j] = _colorsUsed[state][j];
+        } else if (offset + j < _authoredColors.length()) {
+            (*_colors)[offset + j] = _authoredColors[offset + j];
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
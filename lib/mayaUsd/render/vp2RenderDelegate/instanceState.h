@@ -0,0 +1,144 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_INSTANCE_STATE_H
+#define HD_VP2_INSTANCE_STATE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/selection.h>
+#include <pxr/pxr.h>
+
+#include <maya/MColor.h>
+#include <maya/MFloatArray.h>
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MString.h>
+#include <maya/MStringArray.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Transforms and selection highlight colors of the instances of a render
+            item, updated incrementally from one sync to the next.
+    \class  HdVP2InstanceState
+
+    Used by the instanced rprims other than meshes. The transforms are recomputed
+    only when the world matrix or the instance transforms change, and the colors
+    only for the instances whose selection state changed, so that a selection
+    change does not cost time proportional to the number of instances. All the
+    colors are only rewritten when the authored colors or the highlight colors
+    change.
+
+    The arrays are shared with the commits of the render item: they are copied
+    before being modified while a commit holds them. Their versions change with
+    them, for the commits to only upload the arrays that changed without keeping
+    a reference to the ones uploaded.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2InstanceState
+{
+public:
+    //! Returns the UFE identifier of the instance at the given index.
+    using IdentifierFn = std::function<MString(unsigned int)>;
+
+    //! The number of channels of the instance colors.
+    static const unsigned int kNumColorChannels = 4;
+
+    //! The number of highlight colors: dormant, active and lead.
+    static const unsigned int kNumHighlightColors = 3;
+
+    /*! \brief  Update the instance transforms, the world matrix applied to the
+                transforms of the instancer.
+        \return true if the transforms changed. The UFE identifiers are then
+                recomputed too, unless only the world matrix changed.
+    */
+    bool UpdateTransforms(
+        const MMatrix&         worldMatrix,
+        const VtMatrix4dArray& transforms,
+        const IdentifierFn&    identifierFn);
+
+    /*! \brief  Set the authored instance colors, kept by the dormant instances, or an
+                empty array if there are none. Only needed when the primvars change: the
+                colors are kept until the next call or reset.
+        \return true if the authored colors changed. All the instance colors are then
+                rewritten by the next update.
+    */
+    bool SetAuthoredColors(const MFloatArray& authoredColors);
+
+    /*! \brief  Update the instance colors from the selection state of the instances.
+        \param  colors the dormant, active and lead highlight colors.
+        \return true if the colors changed.
+    */
+    bool UpdateColors(
+        const MColor                           colors[kNumHighlightColors],
+        const HdSelection::PrimSelectionState* activeState,
+        const HdSelection::PrimSelectionState* leadState);
+
+    //! Forget the instances and the authored colors.
+    void Reset();
+
+    unsigned int GetInstanceCount() const { return _transforms ? _transforms->length() : 0; }
+
+    const std::shared_ptr<MMatrixArray>& GetTransforms() const { return _transforms; }
+    const std::shared_ptr<MFloatArray>&  GetColors() const { return _colors; }
+    const MStringArray&                  GetUfeIdentifiers() const { return _ufeIdentifiers; }
+
+    //! The versions of the arrays, incremented each time they change. Never 0 once
+    //! the arrays are computed.
+    uint64_t GetTransformsVersion() const { return _transformsVersion; }
+    uint64_t GetColorsVersion() const { return _colorsVersion; }
+
+private:
+    //! The states of the instances, the first ones indexing the highlight colors.
+    enum : unsigned char
+    {
+        kDormant = 0,
+        kActive,
+        kLead,
+        kAuthored
+    };
+
+    //! The state of the instances that are not selected.
+    unsigned char _DormantState() const
+    {
+        return _authoredColors.length() > 0 ? kAuthored : kDormant;
+    }
+
+    void _WriteColor(unsigned int index);
+
+    MMatrix                       _worldMatrix;
+    VtMatrix4dArray               _instancerTransforms;
+    std::shared_ptr<MMatrixArray> _transforms;
+    MStringArray                  _ufeIdentifiers;
+    uint64_t                      _transformsVersion { 0 };
+
+    MColor                       _colorsUsed[kNumHighlightColors];
+    MFloatArray                  _authoredColors;
+    bool                         _authoredColorsChanged { false };
+    std::vector<unsigned char>   _states;
+    std::vector<unsigned char>   _pendingStates;
+    std::vector<unsigned int>    _highlightedIndices;
+    std::shared_ptr<MFloatArray> _colors;
+    uint64_t                     _colorsVersion { 0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_INSTANCE_STATE_H
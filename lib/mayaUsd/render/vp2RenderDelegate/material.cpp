@@ -2788,14 +2788,10 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
         MaterialXMaya::OgsFragment ogsFragment(materialNode, crLibrarySearchPath);
 
         // Explore the fragment for primvars:
-        mx::ShaderPtr            shader = ogsFragment.getShader();
-        const mx::VariableBlock& vertexInputs
-            = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
-        for (size_t i = 0; i < vertexInputs.size(); ++i) {
-            const mx::ShaderPort* variable = vertexInputs[i];
+        for (const std::string& vertexInput : ogsFragment.getVertexInputNames()) {
             // Position is always assumed.
             // Tangent will be generated in the vertex shader using a utility fragment
-            if (variable->getName() == mx::HW::T_IN_NORMAL) {
+            if (vertexInput == mx::HW::T_IN_NORMAL) {
                 _requiredPrimvars.push_back(HdTokens->normals);
             }
         }
@@ -106,6 +106,11 @@ struct MayaUsdCommitState
     //! Color array to support per-instance color and selection highlight.
     std::shared_ptr<MFloatArray> _instanceColors;
 
+    //! Versions of the instance arrays taken from an HdVP2InstanceState, or 0 if the
+    //! arrays were computed for this commit only.
+    uint64_t _instanceTransformsVersion { 0 };
+    uint64_t _instanceColorsVersion { 0 };
+
     //! List of runtime paths that a render item represents
     MStringArray _ufeIdentifiers;
 
@@ -30,9 +30,7 @@
 #include <pxr/imaging/hd/extComputation.h>
 #include <pxr/imaging/hd/meshUtil.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
-#include <pxr/imaging/hd/smoothNormals.h>
 #include <pxr/imaging/hd/version.h>
-#include <pxr/imaging/hd/vertexAdjacency.h>
 #include <pxr/pxr.h>
 #include <pxr/usdImaging/usdImaging/version.h>
 #if !defined(USD_IMAGING_API_VERSION) || USD_IMAGING_API_VERSION < 18
@@ -428,24 +426,39 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
             if (computeCPUNormals) {
                 // note: normals gets dirty when points are marked as dirty,
                 // at change tracker.
-                if (!_meshSharedData->_adjacency) {
+                const HdMeshTopology& topology = _meshSharedData->_topology;
+                if (!_meshSharedData->_smoothNormals) {
                     MProfilingScope profilingScope(
                         HdVP2RenderDelegate::sProfilerCategory,
                         MProfiler::kColorC_L2,
                         _rprimId.asChar(),
                         "HdVP2Mesh::computeAdjacency");
 
-                    _meshSharedData->_adjacency.reset(new Hd_VertexAdjacency());
-
-                    _meshSharedData->_adjacency->BuildAdjacencyTable(&_meshSharedData->_topology);
+                    const VtIntArray& faceVertexCounts = topology.GetFaceVertexCounts();
+                    const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
+                    _meshSharedData->_smoothNormals = std::make_unique<MayaUsdUtils::SmoothNormals>(
+                        faceVertexCounts.cdata(),
+                        faceVertexCounts.size(),
+                        faceVertexIndices.cdata(),
+                        faceVertexIndices.size(),
+                        topology.GetOrientation() != HdTokens->rightHanded);
                 }
 
+                MProfilingScope normalsProfilingScope(
+                    HdVP2RenderDelegate::sProfilerCategory,
+                    MProfiler::kColorC_L2,
+                    _rprimId.asChar(),
+                    "HdVP2Mesh::computeSmoothNormals");
+
                 // Only the points referenced by the topology are used to compute
                 // smooth normals.
-                VtValue normals(Hd_SmoothNormals::ComputeSmoothNormals(
-                    _meshSharedData->_adjacency.get(),
-                    _points(_meshSharedData->_primvarInfo).size(),
-                    _points(_meshSharedData->_primvarInfo).cdata()));
+                const VtVec3fArray points = _points(_meshSharedData->_primvarInfo);
+                VtVec3fArray       normalsArray(points.size());
+                if (!_meshSharedData->_smoothNormals->compute(
+                        normalsArray.data(), points.cdata(), points.size())) {
+                    normalsArray = VtVec3fArray();
+                }
+                VtValue normals(normalsArray);
 
                 if (!normalsInfo) {
                     _meshSharedData->_primvarInfo[HdTokens->normals]
@@ -830,7 +843,7 @@ void HdVP2Mesh::Sync(
             // using the _indexBufferValid flag on render item data.
             if (!(newTopology == _meshSharedData->_topology)) {
                 _meshSharedData->_topology = newTopology;
-                _meshSharedData->_adjacency.reset();
+                _meshSharedData->_smoothNormals.reset();
                 _ResetRenderingTopology();
             }
         }
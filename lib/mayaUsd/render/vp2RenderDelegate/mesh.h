@@ -23,12 +23,15 @@
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
+#include <mayaUsdUtils/SmoothNormals.h>
+
 #include <pxr/imaging/hd/mesh.h>
-#include <pxr/imaging/hd/vertexAdjacency.h>
 #include <pxr/pxr.h>
 
 #include <maya/MHWGeometry.h>
 
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdSceneDelegate;
@@ -49,8 +52,8 @@ struct HdVP2MeshSharedData
     //! copy.
     HdMeshTopology _topology;
 
-    //! Adjacency based off of _topology
-    Hd_VertexAdjacencySharedPtr _adjacency;
+    //! Smooth normals computation, with the adjacency of _topology
+    std::unique_ptr<MayaUsdUtils::SmoothNormals> _smoothNormals;
 
     //! The rendering topology is to create unshared or sorted vertice layout
     //! for efficient GPU rendering.
@@ -285,6 +285,10 @@ void HdVP2Points::_UpdateDrawItem(
     // draw.
     const bool isBoundingBoxItem = (drawMode & MHWRender::MGeometry::kBoundingBox) != 0;
     const bool isHighlightItem = drawItem->ContainsUsage(HdVP2DrawItem::kSelectionHighlight);
+    // The authored instance colors only change with the primvars, the instance state of a
+    // highlight item keeps them in between.
+    const bool authoredColorsDirty
+        = itemDirtyBits & (HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyDisplayStyle);
     const bool inTemplateMode = _displayLayerModes._displayType == MayaUsdRPrim::kTemplate;
     const bool inReferenceMode = _displayLayerModes._displayType == MayaUsdRPrim::kReference;
 
@@ -545,7 +549,7 @@ void HdVP2Points::_UpdateDrawItem(
 
                     _CommitMVertexBuffer(_pointsSharedData._colorBuffer.get(), bufferData);
                 }
-            } else if (prepareInstanceColorBuffer) {
+            } else if (prepareInstanceColorBuffer && (!isHighlightItem || authoredColorsDirty)) {
                 TF_VERIFY(
                     colorInterpolation == HdInterpolationInstance
                     || alphaInterpolation == HdInterpolationInstance);
@@ -589,7 +593,8 @@ void HdVP2Points::_UpdateDrawItem(
     // If the prim is instanced, create one new instance per transform.
     // The current instancer invalidation tracking makes it hard for
     // us to tell whether transforms will be dirty, so this code
-    // pulls them every time something changes.
+    // pulls them every time something changes, and the instance state
+    // only updates what differs from the previous sync.
     // If the mesh is instanced but has 0 instance transforms remember that
     // so the render item can be hidden.
 
@@ -601,74 +606,45 @@ void HdVP2Points::_UpdateDrawItem(
         VtMatrix4dArray transforms
             = static_cast<HdVP2Instancer*>(instancer)->ComputeInstanceTransforms(id);
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        HdVP2InstanceState& instanceState = drawItemData._instanceState;
+        if (itemDirtyBits
+            & (HdChangeTracker::DirtyInstancer | HdChangeTracker::DirtyInstanceIndex)) {
+            instanceState.Reset();
+        }
 
-        if (0 == instanceCount) {
-            instancerWithNoInstances = true;
-        } else {
-            stateToCommit._instanceTransforms->setLength(instanceCount);
-            for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
-                (*stateToCommit._instanceTransforms)[i] = worldMatrix * instanceMatrix;
-                stateToCommit._ufeIdentifiers.append(
-                    drawScene.GetScenePrimPath(GetId(), i).GetString().c_str());
-            }
+        auto identifierFn = [&drawScene, &id](unsigned int i) {
+            return MString(drawScene.GetScenePrimPath(id, i).GetString().c_str());
+        };
+        if (instanceState.UpdateTransforms(worldMatrix, transforms, identifierFn)) {
+            stateToCommit._ufeIdentifiers = instanceState.GetUfeIdentifiers();
+        }
+        stateToCommit._instanceTransforms = instanceState.GetTransforms();
+        stateToCommit._instanceTransformsVersion = instanceState.GetTransformsVersion();
 
+        if (transforms.empty()) {
+            instancerWithNoInstances = true;
+        } else if (isHighlightItem) {
             // If the item is used for both regular draw and selection highlight,
             // it needs to display both wireframe color and selection highlight
             // with one color vertex buffer.
-            if (isHighlightItem) {
-                const MColor colors[]
-                    = { drawScene.GetWireframeColor(),
-                        drawScene.GetSelectionHighlightColor(HdPrimTypeTokens->points),
-                        drawScene.GetSelectionHighlightColor() };
-
-                // Store the indices to colors.
-                std::vector<unsigned char> colorIndices;
-
-                // Assign with the index to the dormant wireframe color by default.
-                bool         hasAuthoredColor = stateToCommit._instanceColors->length() > 0;
-                const size_t authoredColorIndex = sizeof(colors) / sizeof(MColor);
-                colorIndices.resize(instanceCount, hasAuthoredColor ? authoredColorIndex : 0);
-
-                // Assign with the index to the active selection highlight color.
-                if (auto state = drawScene.GetActiveSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 1;
-                        }
-                    }
-                }
-
-                // Assign with the index to the lead selection highlight color.
-                if (auto state = drawScene.GetLeadSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 2;
-                        }
-                    }
-                }
-
-                // Fill per-instance colors.
-                stateToCommit._instanceColors->setLength(instanceCount * kNumColorChannels);
-                unsigned int offset = 0;
-
-                for (unsigned int i = 0; i < instanceCount; ++i) {
-                    unsigned char colorIndex = colorIndices[i];
-                    if (colorIndex == authoredColorIndex) {
-                        offset += kNumColorChannels;
-                        continue;
-                    }
-                    const MColor& color = colors[colorIndex];
-                    for (unsigned int j = 0; j < kNumColorChannels; j++) {
-                        (*stateToCommit._instanceColors)[offset++] = color[j];
-                    }
-                }
+            const MColor colors[]
+                = { drawScene.GetWireframeColor(),
+                    drawScene.GetSelectionHighlightColor(HdPrimTypeTokens->points),
+                    drawScene.GetSelectionHighlightColor() };
+
+            // The dormant instances keep their authored color, if any.
+            if (authoredColorsDirty) {
+                instanceState.SetAuthoredColors(*stateToCommit._instanceColors);
             }
+            instanceState.UpdateColors(
+                colors, drawScene.GetActiveSelectionState(id), drawScene.GetLeadSelectionState(id));
+            stateToCommit._instanceColors = instanceState.GetColors();
+            stateToCommit._instanceColorsVersion = instanceState.GetColorsVersion();
         }
     } else {
         // Non-instanced Rprims.
+        drawItemData._instanceState.Reset();
+
         if (itemDirtyBits & (DirtySelectionHighlight | HdChangeTracker::DirtyDisplayStyle)) {
             if (drawItem->ContainsUsage(HdVP2DrawItem::kRegular) && isHighlightItem) {
                 MHWRender::MShaderInstance* shader = nullptr;
@@ -848,21 +824,34 @@ void HdVP2Points::_UpdateDrawItem(
             extraColorChannelName = kSolidColorStr;
         }
 
+        // The arrays of the instance state are only uploaded when their version changed,
+        // the other ones are new at each commit.
+        auto& committedTransformsVersion
+            = stateToCommit._renderItemData._committedInstanceTransformsVersion;
+        auto& committedColorsVersion
+            = stateToCommit._renderItemData._committedInstanceColorsVersion;
+        const bool transformsChanged = stateToCommit._instanceTransformsVersion == 0
+            || stateToCommit._instanceTransformsVersion != committedTransformsVersion;
+        const bool colorsChanged = transformsChanged || stateToCommit._instanceColorsVersion == 0
+            || stateToCommit._instanceColorsVersion != committedColorsVersion;
+
         // GPU instancing has been enabled. We cannot switch to consolidation
         // without recreating render item, so we keep using GPU instancing.
         if (stateToCommit._renderItemData._usingInstancedDraw) {
-            if (oldInstanceCount == newInstanceCount) {
+            if (oldInstanceCount != newInstanceCount) {
+                drawScene.setInstanceTransformArray(
+                    *renderItem, *stateToCommit._instanceTransforms);
+            } else if (transformsChanged) {
                 for (unsigned int i = 0; i < newInstanceCount; i++) {
                     // VP2 defines instance ID of the first instance to be 1.
                     drawScene.updateInstanceTransform(
                         *renderItem, i + 1, (*stateToCommit._instanceTransforms)[i]);
                 }
-            } else {
-                drawScene.setInstanceTransformArray(
-                    *renderItem, *stateToCommit._instanceTransforms);
             }
 
-            if (stateToCommit._instanceColors->length() == newInstanceCount * kNumColorChannels) {
+            if (colorsChanged
+                && stateToCommit._instanceColors->length()
+                    == newInstanceCount * kNumColorChannels) {
                 drawScene.setExtraInstanceData(
                     *renderItem, extraColorChannelName, *stateToCommit._instanceColors);
             }
@@ -894,6 +883,8 @@ void HdVP2Points::_UpdateDrawItem(
         }
 
         oldInstanceCount = newInstanceCount;
+        committedTransformsVersion = stateToCommit._instanceTransformsVersion;
+        committedColorsVersion = stateToCommit._instanceColorsVersion;
 #ifdef MAYA_MRENDERITEM_UFE_IDENTIFIER_SUPPORT
         if (stateToCommit._ufeIdentifiers.length() > 0) {
             drawScene.setUfeIdentifiers(*renderItem, stateToCommit._ufeIdentifiers);
@@ -96,6 +96,9 @@
 #include <mayaUsd/render/mayaToHydra/utils.h>
 #endif
 
+#include <algorithm>
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -234,24 +237,26 @@ void PopulateSelection(
 }
 #endif // defined(WANT_UFE_BUILD)
 
-//! \brief  Append the selected prim paths to the result list.
-void AppendSelectedPrimPaths(const HdSelectionSharedPtr& selection, SdfPathVector& result)
+//! \brief  Merge the selection state of an Rprim contributed by a selected item.
+void MergeSelectionState(
+    HdSelection::PrimSelectionState&       result,
+    const HdSelection::PrimSelectionState& state)
 {
-    if (!selection) {
-        return;
-    }
-
-    SdfPathVector paths = selection->GetSelectedPrimPaths(HdSelection::HighlightModeSelect);
-    if (paths.empty()) {
-        return;
-    }
+    result.fullySelected |= state.fullySelected;
+    result.instanceIndices.insert(
+        result.instanceIndices.end(), state.instanceIndices.begin(), state.instanceIndices.end());
+}
 
-    if (result.empty()) {
-        result.swap(paths);
-    } else {
-        result.reserve(result.size() + paths.size());
-        result.insert(result.end(), paths.begin(), paths.end());
+//! \brief  Returns true if two selection states of an Rprim are the same.
+bool SameSelectionState(
+    const HdSelection::PrimSelectionState* state0,
+    const HdSelection::PrimSelectionState* state1)
+{
+    if (!state0 || !state1) {
+        return state0 == state1;
     }
+    return state0->fullySelected == state1->fullySelected
+        && state0->instanceIndices == state1->instanceIndices;
 }
 
 //! \brief  Configure repr descriptions
@@ -375,6 +380,19 @@ public:
             return;
         }
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+        // Appending and removing single items, e.g. with shift-click, are
+        // handled as deltas.
+        if (auto appended = dynamic_cast<const Ufe::SelectionItemAppended*>(&notification)) {
+            _proxyRenderDelegate.SelectionItemAppended(appended->item());
+            return;
+        }
+        if (auto removed = dynamic_cast<const Ufe::SelectionItemRemoved*>(&notification)) {
+            _proxyRenderDelegate.SelectionItemRemoved(removed->item()->path());
+            return;
+        }
+#endif
+
         if (dynamic_cast<const Ufe::SelectionChanged*>(&notification)
             || dynamic_cast<const Ufe::ObjectAdd*>(&notification)) {
             _proxyRenderDelegate.SelectionChanged();
@@ -1126,6 +1144,13 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
     HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
     bool             forcePopulateSelection = !_changeVersions.instanceIndexValid(changeTracker);
     _changeVersions.sync(changeTracker);
+#if defined(WANT_UFE_BUILD)
+    if (forcePopulateSelection) {
+        // The Rprims and instances of the selected items must be looked up
+        // again, the selection deltas are not enough.
+        _fullSelectionUpdate = true;
+    }
+#endif
 
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
     if (_selectionModeChanged || (_selectionChanged && !inSelectionPass)
@@ -1574,7 +1599,32 @@ bool ProxyRenderDelegate::updateUfeIdentifiers(
 #endif
 
 //! \brief  Notify of selection change.
-void ProxyRenderDelegate::SelectionChanged() { _selectionChanged = true; }
+void ProxyRenderDelegate::SelectionChanged()
+{
+    _selectionChanged = true;
+#if defined(WANT_UFE_BUILD)
+    _fullSelectionUpdate = true;
+    _selectionItemChanges.clear();
+#endif
+}
+
+#if defined(WANT_UFE_BUILD)
+void ProxyRenderDelegate::SelectionItemAppended(const Ufe::SceneItem::Ptr& item)
+{
+    _selectionChanged = true;
+    if (!_fullSelectionUpdate && item) {
+        _selectionItemChanges.push_back({ item->path(), item });
+    }
+}
+
+void ProxyRenderDelegate::SelectionItemRemoved(const Ufe::Path& path)
+{
+    _selectionChanged = true;
+    if (!_fullSelectionUpdate) {
+        _selectionItemChanges.push_back({ path, nullptr });
+    }
+}
+#endif
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
 void ProxyRenderDelegate::DisplayLayerAdded(MObject& node, void* clientData)
@@ -1769,89 +1819,244 @@ void ProxyRenderDelegate::ColorPrefsChanged()
     _RequestRefresh();
 }
 
-//! \brief  Populate lead and active selection for Rprims under the proxy shape.
-void ProxyRenderDelegate::_PopulateSelection()
+//! \brief  Update the selected items under the proxy shape from the UFE global selection.
+//! \param  changedRprims  Rprims whose lead or active selection state may have changed.
+void ProxyRenderDelegate::_PopulateSelection(
+    std::unordered_set<SdfPath, SdfPath::Hash>& changedRprims)
 {
 #if defined(WANT_UFE_BUILD)
     if (_proxyShapeData->ProxyShape() == nullptr) {
         return;
     }
 
-    _leadSelection.reset(new HdSelection);
-    _activeSelection.reset(new HdSelection);
-
     const auto proxyPath = _proxyShapeData->ProxyShape()->ufePath();
     const auto globalSelection = Ufe::GlobalSelection::get();
 
-    // Populate lead selection from the last item in UFE global selection.
-    auto it = globalSelection->crbegin();
-    if (it != globalSelection->crend()) {
-        PopulateSelection(*it, proxyPath, *_sceneDelegate, _leadSelection);
+    auto addItem = [&](const Ufe::SceneItem::Ptr& item) {
+        const Ufe::Path& path = item->path();
+        if (!path.startsWith(proxyPath) || _selectedItems.count(path) > 0) {
+            return;
+        }
+
+        auto selection = std::make_shared<HdSelection>();
+        PopulateSelection(item, proxyPath, *_sceneDelegate, selection);
+
+        _SelectionContributions& contributions = _selectedItems[path];
+        for (const SdfPath& rprimId :
+             selection->GetSelectedPrimPaths(HdSelection::HighlightModeSelect)) {
+            _rprimSelectedItems[rprimId].emplace_back(path, contributions.size());
+            contributions.emplace_back(
+                rprimId,
+                *selection->GetPrimSelectionState(HdSelection::HighlightModeSelect, rprimId));
+            changedRprims.insert(rprimId);
+        }
+    };
+
+    auto removeItem = [&](const Ufe::Path& path) {
+        auto it = _selectedItems.find(path);
+        if (it == _selectedItems.end()) {
+            return;
+        }
+
+        for (const auto& contribution : it->second) {
+            const SdfPath& rprimId = contribution.first;
+            auto&          items = _rprimSelectedItems[rprimId];
+            items.erase(
+                std::remove_if(
+                    items.begin(),
+                    items.end(),
+                    [&path](const std::pair<Ufe::Path, size_t>& item) {
+                        return item.first == path;
+                    }),
+                items.end());
+            if (items.empty()) {
+                _rprimSelectedItems.erase(rprimId);
+            }
+            changedRprims.insert(rprimId);
+        }
+        _selectedItems.erase(it);
+    };
+
+    if (_fullSelectionUpdate) {
+        // The Rprims of the items which stay selected are looked up again, as
+        // they may have changed, e.g. when prims were added.
+        std::vector<Ufe::Path> previousItems;
+        previousItems.reserve(_selectedItems.size());
+        for (const auto& selectedItem : _selectedItems) {
+            previousItems.push_back(selectedItem.first);
+        }
+        for (const auto& path : previousItems) {
+            removeItem(path);
+        }
+        for (const auto& item : *globalSelection) {
+            addItem(item);
+        }
+    } else {
+        for (const auto& change : _selectionItemChanges) {
+            if (change.item) {
+                addItem(change.item);
+            } else {
+                removeItem(change.path);
+            }
+        }
+    }
+    _selectionItemChanges.clear();
+    _fullSelectionUpdate = false;
 
-        // Start reverse iteration from the second last item in UFE global
-        // selection and populate active selection.
-        for (it++; it != globalSelection->crend(); it++) {
-            PopulateSelection(*it, proxyPath, *_sceneDelegate, _activeSelection);
+    // The lead selection is the last item in UFE global selection, all other
+    // items are the active selection.
+    Ufe::Path leadItem;
+    if (!globalSelection->empty()) {
+        const Ufe::Path& lastPath = globalSelection->back()->path();
+        if (_selectedItems.count(lastPath) > 0) {
+            leadItem = lastPath;
         }
     }
+    if (leadItem != _leadItem) {
+        for (const Ufe::Path* path : { &_leadItem, &leadItem }) {
+            auto it = _selectedItems.find(*path);
+            if (it != _selectedItems.end()) {
+                for (const auto& contribution : it->second) {
+                    changedRprims.insert(contribution.first);
+                }
+            }
+        }
+        _leadItem = leadItem;
+    }
+#endif
+}
+
+//! \brief  Recompute the lead and active selection states of an Rprim from the selected items.
+void ProxyRenderDelegate::_UpdateRprimSelectionState(const SdfPath& rprimId)
+{
+    _leadSelection.erase(rprimId);
+    _activeSelection.erase(rprimId);
+
+#if defined(WANT_UFE_BUILD)
+    auto it = _rprimSelectedItems.find(rprimId);
+    if (it == _rprimSelectedItems.end()) {
+        return;
+    }
+
+    for (const auto& item : it->second) {
+        const auto& state = _selectedItems[item.first][item.second].second;
+        MergeSelectionState(
+            item.first == _leadItem ? _leadSelection[rprimId] : _activeSelection[rprimId], state);
+    }
 #endif
 }
 
 /*! \brief  Notify selection change to rprims.
+
+    Only the Rprims whose selection status or selection state changed are
+    updated, so that adding an item to a large selection is cheap.
  */
 void ProxyRenderDelegate::_UpdateSelectionStates()
 {
     const MHWRender::DisplayStatus previousStatus = _displayStatus;
     _displayStatus = MHWRender::MGeometryUtilities::displayStatus(_proxyShapeData->ProxyDagPath());
 
-    SdfPathVector        rootPaths;
-    const SdfPathVector* dirtyPaths = nullptr;
-
-    if (_displayStatus == MHWRender::kLead || _displayStatus == MHWRender::kActive) {
-        if (_displayStatus != previousStatus) {
-            rootPaths.push_back(SdfPath::AbsoluteRootPath());
-            dirtyPaths = &_renderIndex->GetRprimIds();
-        }
-    } else if (previousStatus == MHWRender::kLead || previousStatus == MHWRender::kActive) {
-        rootPaths.push_back(SdfPath::AbsoluteRootPath());
-        dirtyPaths = &_renderIndex->GetRprimIds();
-        _PopulateSelection();
-    } else {
-        // Append pre-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+    const auto isFullySelected = [](MHWRender::DisplayStatus status) {
+        return status == MHWRender::kLead || status == MHWRender::kActive;
+    };
+    const bool displayStatusChanged = (_displayStatus != previousStatus)
+        && (isFullySelected(_displayStatus) || isFullySelected(previousStatus));
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+    const bool selectionModeChanged = _selectionModeChanged;
+#else
+    constexpr bool selectionModeChanged = false;
+#endif
 
-        // Update lead and active selection.
-        _PopulateSelection();
+    std::unordered_set<SdfPath, SdfPath::Hash> changedRprims;
+    _PopulateSelection(changedRprims);
 
-        // Append post-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+    // Record the state of the Rprims before the update.
+    struct RprimState
+    {
+        HdVP2SelectionStatus                           status;
+        std::unique_ptr<HdSelection::PrimSelectionState> lead;
+        std::unique_ptr<HdSelection::PrimSelectionState> active;
+    };
+    auto copyState = [](const HdSelection::PrimSelectionState* state) {
+        return state ? std::make_unique<HdSelection::PrimSelectionState>(*state)
+                     : std::unique_ptr<HdSelection::PrimSelectionState>();
+    };
+    std::unordered_map<SdfPath, RprimState, SdfPath::Hash> previousStates;
+    previousStates.reserve(changedRprims.size());
+    for (const SdfPath& rprimId : changedRprims) {
+        previousStates[rprimId] = { _GetSelectionStatus(previousStatus, rprimId),
+                                    copyState(GetLeadSelectionState(rprimId)),
+                                    copyState(GetActiveSelectionState(rprimId)) };
+        _UpdateRprimSelectionState(rprimId);
+    }
+
+    // When the proxy shape itself gets selected or unselected, the status of
+    // every Rprim may change. Otherwise only the status of the Rprims with
+    // changed selection states may.
+    SdfPathVector dirtyPaths;
+    auto          checkRprim = [&](const SdfPath& rprimId) {
+        const HdVP2SelectionStatus newStatus = GetSelectionStatus(rprimId);
+
+        auto                       previous = previousStates.find(rprimId);
+        const bool                 stateChanged = previous != previousStates.end();
+        const HdVP2SelectionStatus oldStatus
+            = stateChanged ? previous->second.status : _GetSelectionStatus(previousStatus, rprimId);
+
+        bool dirty = (oldStatus != newStatus);
+        if (!dirty && stateChanged && newStatus == kPartiallySelected) {
+            // Partially selected Rprims also depend on the selected instances.
+            dirty = !SameSelectionState(previous->second.lead.get(), GetLeadSelectionState(rprimId))
+                || !SameSelectionState(
+                        previous->second.active.get(), GetActiveSelectionState(rprimId));
+        }
+        if (!dirty && selectionModeChanged && newStatus != kUnselected) {
+            dirty = true;
+        }
+        if (dirty && _renderIndex->HasRprim(rprimId)) {
+            dirtyPaths.push_back(rprimId);
+        }
+    };
 
-        dirtyPaths = &rootPaths;
+    if (displayStatusChanged) {
+        for (const SdfPath& rprimId : _renderIndex->GetRprimIds()) {
+            checkRprim(rprimId);
+        }
+    } else {
+        for (const SdfPath& rprimId : changedRprims) {
+            checkRprim(rprimId);
+        }
+        if (selectionModeChanged) {
+            // Selected Rprims also need to update with the selection mode.
+            for (const auto* selection : { &_leadSelection, &_activeSelection }) {
+                for (const auto& selected : *selection) {
+                    if (!changedRprims.count(selected.first)) {
+                        checkRprim(selected.first);
+                    }
+                }
+            }
+        }
     }
 
-    if (!rootPaths.empty()) {
+    if (!dirtyPaths.empty()) {
         // When the selection changes then we have to update all the selected render
         // items. Set a dirty flag on each of the rprims so they know what to update.
-        // Avoid trying to set dirty the absolute root as it is not a Rprim.
         HdDirtyBits dirtySelectionBits = MayaUsdRPrim::DirtySelectionHighlight;
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
         // If the selection mode changes, for example into or out of point snapping,
         // then we need to do a little extra work.
-        if (_selectionModeChanged)
+        if (selectionModeChanged)
             dirtySelectionBits |= MayaUsdRPrim::DirtySelectionMode;
 #endif
         HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
-        for (auto path : *dirtyPaths) {
-            if (_renderIndex->HasRprim(path))
-                changeTracker.MarkRprimDirty(path, dirtySelectionBits);
+        for (const auto& path : dirtyPaths) {
+            changeTracker.MarkRprimDirty(path, dirtySelectionBits);
         }
 
         // now that the appropriate prims have been marked dirty trigger
         // a sync so that they all update.
         HdRprimCollection collection(HdTokens->geometry, _defaultCollection->GetReprSelector());
-        collection.SetRootPaths(rootPaths);
+        collection.SetRootPaths(
+            displayStatusChanged ? SdfPathVector { SdfPath::AbsoluteRootPath() } : dirtyPaths);
         _taskController->SetCollection(collection);
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
         _taskController->SetCollection(*_defaultCollection);
@@ -2008,28 +2213,34 @@ SdfPathVector ProxyRenderDelegate::_GetFilteredRprims(
 const HdSelection::PrimSelectionState*
 ProxyRenderDelegate::GetLeadSelectionState(const SdfPath& path) const
 {
-    return (_leadSelection == nullptr)
-        ? nullptr
-        : _leadSelection->GetPrimSelectionState(HdSelection::HighlightModeSelect, path);
+    auto it = _leadSelection.find(path);
+    return it == _leadSelection.end() ? nullptr : &it->second;
 }
 
 //! \brief  Qeury the selection state of a given prim from the active selection.
 const HdSelection::PrimSelectionState*
 ProxyRenderDelegate::GetActiveSelectionState(const SdfPath& path) const
 {
-    return (_activeSelection == nullptr)
-        ? nullptr
-        : _activeSelection->GetPrimSelectionState(HdSelection::HighlightModeSelect, path);
+    auto it = _activeSelection.find(path);
+    return it == _activeSelection.end() ? nullptr : &it->second;
 }
 
 //! \brief  Query the selection status of a given prim.
 HdVP2SelectionStatus ProxyRenderDelegate::GetSelectionStatus(const SdfPath& path) const
 {
-    if (_displayStatus == MHWRender::kLead) {
+    return _GetSelectionStatus(_displayStatus, path);
+}
+
+//! \brief  Query the selection status of a given prim, for a display status of the proxy shape.
+HdVP2SelectionStatus ProxyRenderDelegate::_GetSelectionStatus(
+    MHWRender::DisplayStatus displayStatus,
+    const SdfPath&           path) const
+{
+    if (displayStatus == MHWRender::kLead) {
         return kFullyLead;
     }
 
-    if (_displayStatus == MHWRender::kActive) {
+    if (displayStatus == MHWRender::kActive) {
         return kFullyActive;
     }
 
@@ -38,9 +38,13 @@
 #include <maya/MPxSubSceneOverride.h>
 
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #if defined(WANT_UFE_BUILD)
 #include <ufe/observer.h>
 #include <ufe/path.h>
+#include <ufe/sceneItem.h>
 #endif
 
 // Conditional compilation due to Maya API gap.
@@ -184,6 +188,16 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SelectionChanged();
 
+#if defined(WANT_UFE_BUILD)
+    //! \brief Record that an item was appended to the UFE global selection.
+    MAYAUSD_CORE_PUBLIC
+    void SelectionItemAppended(const Ufe::SceneItem::Ptr& item);
+
+    //! \brief Record that an item was removed from the UFE global selection.
+    MAYAUSD_CORE_PUBLIC
+    void SelectionItemRemoved(const Ufe::Path& path);
+#endif
+
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
     MAYAUSD_CORE_PUBLIC
     static void DisplayLayerAdded(MObject& node, void* clientData);
@@ -290,8 +304,11 @@ private:
     typedef std::pair<GfVec3f, std::atomic<uint64_t>> GfVec3fCache;
 
     bool   _isInitialized();
-    void   _PopulateSelection();
+    void   _PopulateSelection(std::unordered_set<SdfPath, SdfPath::Hash>& changedRprims);
     void   _UpdateSelectionStates();
+    void   _UpdateRprimSelectionState(const SdfPath& rprimId);
+    HdVP2SelectionStatus
+    _GetSelectionStatus(MHWRender::DisplayStatus displayStatus, const SdfPath& path) const;
     void   _UpdateRenderTags();
     void   _ClearRenderDelegate();
     MColor _GetDisplayColor(
@@ -475,8 +492,40 @@ private:
     MHWRender::DisplayStatus _displayStatus {
         MHWRender::kNoStatus
     };                                     //!< The display status of the proxy shape
-    HdSelectionSharedPtr _leadSelection;   //!< A collection of Rprims being lead selection
-    HdSelectionSharedPtr _activeSelection; //!< A collection of Rprims being active selection
+
+    //! Selection state of each selected Rprim
+    using _PrimSelectionStates
+        = std::unordered_map<SdfPath, HdSelection::PrimSelectionState, SdfPath::Hash>;
+    _PrimSelectionStates _leadSelection;   //!< Rprims being lead selection
+    _PrimSelectionStates _activeSelection; //!< Rprims being active selection
+
+#if defined(WANT_UFE_BUILD)
+    //! The Rprim selection states contributed by a selected UFE item.
+    using _SelectionContributions
+        = std::vector<std::pair<SdfPath, HdSelection::PrimSelectionState>>;
+
+    //! Selected UFE items under the proxy shape, with their contributions.
+    std::unordered_map<Ufe::Path, _SelectionContributions> _selectedItems;
+    //! Selected UFE items contributing to each selected Rprim, with the index
+    //! of the contribution.
+    std::unordered_map<SdfPath, std::vector<std::pair<Ufe::Path, size_t>>, SdfPath::Hash>
+        _rprimSelectedItems;
+    //! The selected UFE item providing the lead selection, if it is under the
+    //! proxy shape.
+    Ufe::Path _leadItem;
+
+    //! A change to the UFE global selection: the appended item, or the path
+    //! of the removed item with a null item.
+    struct _SelectionItemChange
+    {
+        Ufe::Path           path;
+        Ufe::SceneItem::Ptr item;
+    };
+    //! Selection changes received since the last update. A full update
+    //! compares the whole UFE global selection with _selectedItems instead.
+    std::vector<_SelectionItemChange> _selectionItemChanges;
+    bool                              _fullSelectionUpdate { true };
+#endif
 
 #if defined(WANT_UFE_BUILD)
     //! Observer to listen to UFE changes
@@ -657,6 +657,7 @@ void HdVP2RenderDelegate::CommitResources(HdChangeTracker* tracker)
     //     3) Update any scene-level acceleration structures.
 
     _resourceRegistryVP2.Commit();
+    _resourceRegistryVP2.GarbageCollect();
 }
 
 /*! \brief  Return a list of which Rprim types can be created by this class's.
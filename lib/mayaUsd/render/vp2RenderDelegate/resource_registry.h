@@ -18,9 +18,14 @@
 
 #include "task_commit.h"
 
+#include <pxr/base/vt/value.h>
+#include <pxr/imaging/hd/instanceRegistry.h>
+
 #include <tbb/concurrent_queue.h>
 #include <tbb/tbb_allocator.h>
 
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Central place to manage GPU resources commits and any resources not managed by VP2
@@ -29,6 +34,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 class HdVP2ResourceRegistry
 {
 public:
+    //! Index arrays built from a topology, shared by the Rprims with the same topology.
+    using SharedIndexArray = std::shared_ptr<const VtValue>;
+    using SharedIndexArrayInstance = HdInstance<SharedIndexArray>;
+
     //! \brief  Default constructor
     HdVP2ResourceRegistry() = default;
     //! \brief  Default destructor
@@ -50,9 +59,27 @@ public:
         _commitTasks.push(HdVP2TaskCommitBody<Body>::construct(taskBody));
     }
 
+    //! \brief  Find the index array registered for the given topology id. Call is thread safe.
+    SharedIndexArrayInstance FindBasisCurvesIndices(SharedIndexArrayInstance::ID id, bool* found)
+    {
+        return _basisCurvesIndices.FindInstance(id, found);
+    }
+
+    //! \brief  Register the index array of the given topology id. Call is thread safe.
+    SharedIndexArrayInstance RegisterBasisCurvesIndices(SharedIndexArrayInstance::ID id)
+    {
+        return _basisCurvesIndices.GetInstance(id);
+    }
+
+    //! \brief  Release the shared resources no longer used by any Rprim
+    void GarbageCollect() { _basisCurvesIndices.GarbageCollect(); }
+
 private:
     //! Concurrent queue for commit tasks
     tbb::concurrent_queue<HdVP2TaskCommit*, tbb::tbb_allocator<HdVP2TaskCommit*>> _commitTasks;
+
+    //! Index arrays of the basis curves, keyed by topology and kind of index array
+    HdInstanceRegistry<SharedIndexArray> _basisCurvesIndices;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
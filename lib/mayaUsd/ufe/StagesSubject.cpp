@@ -490,10 +490,14 @@ StagesSubject::StagesSubject()
     TfWeakPtr<StagesSubject> me(this);
     TfNotice::Register(me, &StagesSubject::onStageSet);
     TfNotice::Register(me, &StagesSubject::onStageInvalidate);
+
+    // Keep the stage to proxy shape UFE path (and reverse) mapping up to date.
+    g_StageMap.startTracking();
 }
 
 StagesSubject::~StagesSubject()
 {
+    g_StageMap.stopTracking();
     MMessage::removeCallbacks(fCbIds);
     fCbIds.clear();
 }
@@ -514,6 +518,10 @@ void StagesSubject::beforeNewCallback(void* clientData)
 {
     StagesSubject* ss = static_cast<StagesSubject*>(clientData);
     ss->beforeNewCallback(true);
+
+    // The proxy shapes of the new scene will be added to the stage map as
+    // they are created.
+    g_StageMap.clear();
 }
 
 /*static*/
@@ -562,14 +570,6 @@ void StagesSubject::afterOpen()
             }
         });
     fStageListeners.clear();
-
-    // Set up our stage to proxy shape UFE path (and reverse)
-    // mapping.  We do this with the following steps:
-    // - get all proxyShape nodes in the scene.
-    // - get their Dag paths.
-    // - convert the Dag paths to UFE paths.
-    // - get their stage.
-    g_StageMap.setDirty();
 }
 
 void StagesSubject::stageChanged(
@@ -826,6 +826,10 @@ void StagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
     }
 #endif
 
+    // The stage map is updated even from a re-entrant compute, since it is where the stage of
+    // the proxy shape is looked up from.
+    g_StageMap.setStage(notice.GetProxyShape().thisMObject(), notice.GetStage());
+
     // Handle re-entrant MayaUsdProxyShapeBase::compute; allow update only on first compute call.
     if (MayaUsdProxyShapeBase::in_compute > 1)
         return;
@@ -833,8 +837,7 @@ void StagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
     // Handle re-entrant onStageSet
     bool expectedState = false;
     if (stageSetGuardCount.compare_exchange_strong(expectedState, true)) {
-        // We should have no listeners and stage map is dirty.
-        TF_VERIFY(g_StageMap.isDirty());
+        // We should have no listeners.
         TF_VERIFY(fStageListeners.empty());
 
         StagesSubject::Ptr me(this);
@@ -865,6 +868,7 @@ void StagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
 void StagesSubject::onStageInvalidate(const MayaUsdProxyStageInvalidateNotice& notice)
 {
     afterOpen();
+    g_StageMap.invalidateStage(notice.GetProxyShape().thisMObject());
 
     auto p = notice.GetProxyShape().ufePath();
     if (!p.empty()) {
@@ -21,7 +21,10 @@
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsd/utils/util.h>
 
+#include <maya/MDGMessage.h>
+#include <maya/MDagMessage.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MNodeMessage.h>
 #ifdef UFE_V2_FEATURES_AVAILABLE
 #include <ufe/pathString.h>
 #endif
@@ -32,48 +35,55 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {
 
-MObjectHandle nameLookup(const Ufe::Path& path)
+// Assuming proxy shape nodes cannot be instanced, simply return the first path.
+// Returns an empty path if the node is not (yet) in the Dag, e.g. when it has
+// just been created and has not been parented.
+Ufe::Path firstPath(const MObject& object)
 {
-    // Get the MObjectHandle from the tail of the MDagPath.  Remove the leading
-    // '|world' component.
-    auto          noWorld = path.popHead().string();
-    auto          dagPath = UsdMayaUtil::nameToDagPath(noWorld);
-    MObjectHandle handle(dagPath.node());
-    if (!handle.isValid()) {
-        TF_CODING_ERROR("'%s' is not a path to a proxy shape node.", noWorld.c_str());
+    MDagPath dagPath;
+    if (MDagPath::getAPathTo(object, dagPath) != MS::kSuccess || !dagPath.isValid()) {
+        return Ufe::Path();
     }
-    return handle;
+    return MayaUsd::ufe::dagPathToUfe(dagPath);
 }
 
-Ufe::Path firstPath(const MObject& object)
+// Return whether the Dag node is an ancestor of the object, along its first path.
+bool isAncestor(const MObject& dagNode, const MObject& object)
 {
     MDagPath dagPath;
-    auto     status = MFnDagNode(object).getPath(dagPath);
-    CHECK_MSTATUS(status);
-    return MayaUsd::ufe::dagPathToUfe(dagPath);
+    if (MDagPath::getAPathTo(object, dagPath) != MS::kSuccess) {
+        return false;
+    }
+    while (dagPath.length() > 0) {
+        dagPath.pop();
+        if (dagPath.node() == dagNode) {
+            return true;
+        }
+    }
+    return false;
 }
 
-// Assuming proxy shape nodes cannot be instanced, simply return the first path.
-Ufe::Path firstPath(const MObjectHandle& handle)
+MayaUsdProxyShapeBase* objToProxyShape(const MObject& obj)
 {
-    if (!handle.isValid()) {
-        return Ufe::Path();
+    if (obj.isNull()) {
+        return nullptr;
     }
-    return firstPath(handle.object());
+
+    MFnDependencyNode fn(obj);
+    return dynamic_cast<MayaUsdProxyShapeBase*>(fn.userNode());
 }
 
-UsdStageWeakPtr objToStage(MObject& obj)
+UsdStageWeakPtr objToStage(const MObject& obj)
 {
     if (obj.isNull()) {
         return nullptr;
     }
 
     // Get the stage from the proxy shape.
-    MFnDependencyNode fn(obj);
-    auto              ps = dynamic_cast<MayaUsdProxyShapeBase*>(fn.userNode());
+    auto ps = objToProxyShape(obj);
     TF_VERIFY(ps);
 
-    return ps->getUsdStage();
+    return ps ? ps->getUsdStage() : nullptr;
 }
 
 inline Ufe::Path::Segments::size_type nbPathSegments(const Ufe::Path& path)
@@ -86,10 +96,30 @@ inline Ufe::Path::Segments::size_type nbPathSegments(const Ufe::Path& path)
 #endif
 }
 
-inline Ufe::Path toPath(const std::string& mayaPathString)
+//------------------------------------------------------------------------------
+// Maya callbacks
+//------------------------------------------------------------------------------
+
+void nodeAddedCallback(MObject& node, void* clientData)
+{
+    static_cast<MayaUsd::ufe::UsdStageMap*>(clientData)->addProxyShape(node);
+}
+
+void nodeRemovedCallback(MObject& node, void* clientData)
+{
+    static_cast<MayaUsd::ufe::UsdStageMap*>(clientData)->removeProxyShape(node);
+}
+
+void nameChangedCallback(MObject& node, const MString& /* prevName */, void* clientData)
 {
-    return Ufe::Path(
-        Ufe::PathSegment("|world" + mayaPathString, MayaUsd::ufe::getMayaRunTimeId(), '|'));
+    if (node.hasFn(MFn::kDagNode)) {
+        static_cast<MayaUsd::ufe::UsdStageMap*>(clientData)->dagNodeChanged(node);
+    }
+}
+
+void parentAddedCallback(MDagPath& child, MDagPath& /* parent */, void* clientData)
+{
+    static_cast<MayaUsd::ufe::UsdStageMap*>(clientData)->dagNodeChanged(child.node());
 }
 
 } // namespace
@@ -107,199 +137,232 @@ UsdStageMap g_StageMap;
 // UsdStageMap
 //------------------------------------------------------------------------------
 
-void UsdStageMap::addItem(const Ufe::Path& path)
+void UsdStageMap::startTracking()
 {
-    // We expect a path to the proxy shape node, therefore a single segment.
-    auto nbSegments = nbPathSegments(path);
-    if (nbSegments != 1) {
-        TF_CODING_ERROR(
-            "A proxy shape node path can have only one segment, path '%s' has %lu",
-            path.string().c_str(),
-            nbSegments);
+    if (fCbIds.length() > 0) {
         return;
     }
 
-    // Convert the UFE path to an MObjectHandle.
-    auto proxyShape = nameLookup(path);
-    if (!proxyShape.isValid()) {
+    MStatus     res;
+    const char* nodeType = ProxyShapeHandler::gatewayNodeType().c_str();
+    fCbIds.append(MDGMessage::addNodeAddedCallback(nodeAddedCallback, nodeType, this, &res));
+    CHECK_MSTATUS(res);
+    fCbIds.append(MDGMessage::addNodeRemovedCallback(nodeRemovedCallback, nodeType, this, &res));
+    CHECK_MSTATUS(res);
+    fCbIds.append(
+        MNodeMessage::addNameChangedCallback(MObject::kNullObj, nameChangedCallback, this, &res));
+    CHECK_MSTATUS(res);
+    fCbIds.append(MDagMessage::addParentAddedCallback(parentAddedCallback, this, &res));
+    CHECK_MSTATUS(res);
+
+    // Populate the map with the proxy shapes already in the scene.  This is
+    // the only time the scene is scanned.
+    clear();
+    for (const auto& psn : ProxyShapeHandler::getAllNames()) {
+        auto dagPath = UsdMayaUtil::nameToDagPath(psn);
+        if (dagPath.isValid()) {
+            addProxyShape(dagPath.node());
+        }
+    }
+}
+
+void UsdStageMap::stopTracking()
+{
+    MMessage::removeCallbacks(fCbIds);
+    fCbIds.clear();
+    clear();
+}
+
+void UsdStageMap::clear()
+{
+    fPathToObject.clear();
+    fStageToObject.clear();
+    fObjectToEntry.clear();
+}
+
+void UsdStageMap::addProxyShape(const MObject& proxyShape)
+{
+    if (!objToProxyShape(proxyShape)) {
         return;
     }
 
-    // If a proxy shape doesn't yet have a stage, don't add it.
-    // We will add it later, when the stage is initialized
-    auto obj = proxyShape.object();
-    auto stage = objToStage(obj);
-    if (!stage) {
+    MObjectHandle   handle(proxyShape);
+    Entry&          entry = fObjectToEntry[handle];
+    const Ufe::Path path = firstPath(proxyShape);
+    setPath(handle, entry, path);
+
+    // A node just created is not in the Dag yet, and its stage is recorded
+    // when it is set.  A node already in the Dag, e.g. when tracking starts or
+    // when the deletion of the node is undone, already has its stage, and no
+    // stage set notice will be sent for it.
+    if (!path.empty()) {
+        setStage(proxyShape, objToStage(proxyShape));
+    }
+}
+
+void UsdStageMap::removeProxyShape(const MObject& proxyShape)
+{
+    auto iter = fObjectToEntry.find(MObjectHandle(proxyShape));
+    if (iter == std::end(fObjectToEntry)) {
         return;
     }
 
-    fPathToObject[path] = proxyShape;
-    fStageToObject[stage] = proxyShape;
+    setPath(iter->first, iter->second, Ufe::Path());
+    if (iter->second.stage) {
+        fStageToObject.erase(iter->second.stage);
+    }
+    fObjectToEntry.erase(iter);
 }
 
-UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path)
+void UsdStageMap::setStage(const MObject& proxyShape, UsdStageWeakPtr stage)
 {
-    // Non-const MObject& requires an lvalue.
-    auto obj = proxyShape(path);
-    return objToStage(obj);
+    MObjectHandle handle(proxyShape);
+    auto          iter = fObjectToEntry.find(handle);
+    if (iter == std::end(fObjectToEntry)) {
+        // The stage may be set before the node has been seen, e.g. if
+        // tracking started during its creation.
+        addProxyShape(proxyShape);
+        iter = fObjectToEntry.find(handle);
+        if (iter == std::end(fObjectToEntry)) {
+            return;
+        }
+    }
+
+    Entry& entry = iter->second;
+    if (entry.stage == stage) {
+        return;
+    }
+    if (entry.stage) {
+        auto stageIter = fStageToObject.find(entry.stage);
+        if (stageIter != std::end(fStageToObject) && stageIter->second == handle) {
+            fStageToObject.erase(stageIter);
+        }
+    }
+    entry.stage = stage;
+    if (stage) {
+        fStageToObject[stage] = handle;
+    }
 }
 
-MObject UsdStageMap::proxyShape(const Ufe::Path& path)
+void UsdStageMap::invalidateStage(const MObject& proxyShape)
 {
-    rebuildIfDirty();
-
-    // In additional to the explicit dirty system it is possible that
-    // the cache is in an invalid state and needs to be refreshed. See
-    // the class comment in UsdStageMap.h for details.
-    // There are two scenarios which signal a cache refresh is required:
-    // 1. A path is searched for which cannot be found. This indicates that
-    //    the stage has been reparented and the new path has been used to search
-    //    for the stage and the stage is not present in the cache.
-    // 2. The DAG path of a cached MObject doesn't match the key path used to
-    //    find that MObject. This indicates that the stage has been reparented
-    //    and the old path has been used to search for the stage. In this case
-    //    there is a cache hit when there should not be.
+    if (fObjectToEntry.count(MObjectHandle(proxyShape))) {
+        setStage(proxyShape, nullptr);
+    }
+}
+
+void UsdStageMap::dagNodeChanged(const MObject& dagNode)
+{
+    if (fObjectToEntry.empty()) {
+        return;
+    }
+
+    auto iter = fObjectToEntry.find(MObjectHandle(dagNode));
+    if (iter != std::end(fObjectToEntry)) {
+        setPath(iter->first, iter->second, firstPath(dagNode));
+        return;
+    }
 
+    // Only a change to an ancestor can change the path of a proxy shape.
+    // Leaf nodes are the vast majority of renamed and reparented nodes (and
+    // of the nodes created when a file is read), so they are skipped without
+    // looking at the proxy shapes.
+    if (MFnDagNode(dagNode).childCount() == 0) {
+        return;
+    }
+
+    for (auto& entry : fObjectToEntry) {
+        if (entry.first.isValid() && isAncestor(dagNode, entry.first.object())) {
+            setPath(entry.first, entry.second, firstPath(entry.first.object()));
+        }
+    }
+}
+
+void UsdStageMap::setPath(const MObjectHandle& proxyShape, Entry& entry, const Ufe::Path& path)
+{
+    if (entry.path == path) {
+        return;
+    }
+
+    if (!entry.path.empty()) {
+        auto pathIter = fPathToObject.find(entry.path);
+        if (pathIter != std::end(fPathToObject) && pathIter->second == proxyShape) {
+            fPathToObject.erase(pathIter);
+        }
+    }
+    entry.path = path;
+    if (!path.empty()) {
+        fPathToObject[path] = proxyShape;
+    }
+}
+
+MObjectHandle UsdStageMap::lookup(const Ufe::Path& path)
+{
+    // We expect a path to the proxy shape node, therefore only the first
+    // segment is used.
     const auto& singleSegmentPath
         = nbPathSegments(path) == 1 ? path : Ufe::Path(path.getSegments()[0]);
 
     auto iter = fPathToObject.find(singleSegmentPath);
-
     if (iter == std::end(fPathToObject)) {
-        // When we don't find an entry in the cache then we are in scenario 1.
-        // MObjects stay valid even when re-parented or re-named, so we can
-        // scan through all the entries in the cache and validate that the current
-        // DAG path to the MObject matches the key Ufe::Path for the MObject in
-        // the cache. When the don't match, update fPathToObject so that the key and
-        // the MObject are in sync again.
-        auto pathToObject = fPathToObject;
-        for (const auto& entry : pathToObject) {
-            const auto& cachedPath = entry.first;
-            const auto& cachedObject = entry.second;
-            // If the cached object itself is invalid then remove it from the map.
-            if (!cachedObject.isValid()) {
-                fPathToObject.erase(cachedPath);
-                continue;
-            }
-            // Get the UFE path from the map value.
-            auto newPath = firstPath(cachedObject);
-            if (newPath != cachedPath) {
-                // Key is stale.  Remove it from our cache, and add the new entry.
-                auto count = fPathToObject.erase(cachedPath);
-                TF_AXIOM(count);
-                if (!newPath.empty())
-                    fPathToObject[newPath] = cachedObject;
-            }
-        }
-
-        // Now that the cache is in a better state, attempt to find the searched for
-        // proxyShape again.
-        iter = fPathToObject.find(singleSegmentPath);
-
-        if (iter == std::end(fPathToObject)) {
-            // Still not found, must have re-appeared through undo of delete.
-            // Add it back to the cache.
-            for (const auto& psn : ProxyShapeHandler::getAllNames()) {
-                auto psPath = toPath(psn);
-                if (fPathToObject.find(psPath) == std::end(fPathToObject)) {
-                    addItem(psPath);
-                }
-            }
+        return MObjectHandle();
+    }
 
-            iter = fPathToObject.find(singleSegmentPath);
-            if (iter == std::end(fPathToObject)) {
-                // Since our cache is fresh, path not found means it's not a
-                // proxy shape.
-                return MObject();
+    MObjectHandle handle = iter->second;
+    if (!handle.isValid()) {
+        // The node was deleted without a node removed callback, e.g. when the
+        // scene was cleared.  Forget about it.
+        auto entryIter = fObjectToEntry.find(handle);
+        if (entryIter != std::end(fObjectToEntry)) {
+            if (entryIter->second.stage) {
+                fStageToObject.erase(entryIter->second.stage);
             }
+            fObjectToEntry.erase(entryIter);
         }
-    } else {
-        auto object = iter->second;
-        // If the cached object itself is invalid then remove it from the map.
-        if (!object.isValid()) {
-            fPathToObject.erase(singleSegmentPath);
-            return MObject();
-        }
-        auto objectPath = firstPath(object);
-        if (objectPath != iter->first) {
-            // When we hit the cache and the key path doesn't match the current object path
-            // we are in scenario 2. Update the entry in fPathToObject so that the key path
-            // is the current object path.
-            fPathToObject.erase(singleSegmentPath);
-            if (!objectPath.empty())
-                fPathToObject[objectPath] = object;
-            TF_VERIFY(std::end(fPathToObject) == fPathToObject.find(singleSegmentPath));
-            return MObject();
-        }
+        fPathToObject.erase(iter);
+        return MObjectHandle();
     }
+    return handle;
+}
 
-    // At this point the cache is rebuilt, so lookup failure means the object
-    // doesn't exist.
-    return iter == std::end(fPathToObject) ? MObject() : iter->second.object();
+UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path) { return objToStage(proxyShape(path)); }
+
+MObject UsdStageMap::proxyShape(const Ufe::Path& path)
+{
+    auto handle = lookup(path);
+    return handle.isValid() ? handle.object() : MObject();
 }
 
 MayaUsdProxyShapeBase* UsdStageMap::proxyShapeNode(const Ufe::Path& path)
 {
-    auto obj = proxyShape(path);
-    if (obj.isNull()) {
-        return nullptr;
-    }
-
-    MFnDependencyNode fn(obj);
-    return dynamic_cast<MayaUsdProxyShapeBase*>(fn.userNode());
+    return objToProxyShape(proxyShape(path));
 }
 
 Ufe::Path UsdStageMap::path(UsdStageWeakPtr stage)
 {
-    rebuildIfDirty();
-
     // A stage is bound to a single Dag proxy shape.
     auto iter = fStageToObject.find(stage);
-    if (iter != std::end(fStageToObject))
-        return firstPath(iter->second);
-    return Ufe::Path();
+    if (iter == std::end(fStageToObject) || !iter->second.isValid())
+        return Ufe::Path();
+
+    auto entryIter = fObjectToEntry.find(iter->second);
+    return entryIter == std::end(fObjectToEntry) ? Ufe::Path() : entryIter->second.path;
 }
 
 UsdStageMap::StageSet UsdStageMap::allStages()
 {
-    rebuildIfDirty();
-
     StageSet stages;
-    for (auto it = fPathToObject.begin(); it != fPathToObject.end();
-         /* no ++it here, we manually move it in the loop */) {
-        const auto&      pair = *it;
-        const Ufe::Path& path = pair.first;
-        // Calling UsdStageMap::stage may erase the entry in fPathToObject at path.
-        // Advance the iterator so that the iterator stays valid if erasure occurs.
-        it++;
-        // Now handle path.
-        PXR_NS::UsdStageWeakPtr matchingStage = stage(path);
-        // After this point pair and path cannot be safely used, they may have been erased.
-        // If the object cached in fPathToObject was invalid we'll get back a nullptr.
-        // Don't add nullptr to the returned StageSet.
+    for (const auto& entry : fObjectToEntry) {
+        // If the object is invalid we'll get back a nullptr.  Don't add
+        // nullptr to the returned StageSet.
+        if (!entry.first.isValid() || entry.second.path.empty())
+            continue;
+        PXR_NS::UsdStageWeakPtr matchingStage = objToStage(entry.first.object());
         if (matchingStage)
             stages.insert(matchingStage);
     }
     return stages;
 }
 
-void UsdStageMap::setDirty()
-{
-    fPathToObject.clear();
-    fStageToObject.clear();
-    fDirty = true;
-}
-
-void UsdStageMap::rebuildIfDirty()
-{
-    if (!fDirty)
-        return;
-
-    for (const auto& psn : ProxyShapeHandler::getAllNames()) {
-        addItem(toPath(psn));
-    }
-    fDirty = false;
-}
-
 } // namespace ufe
 } // namespace MAYAUSD_NS_DEF
@@ -16,12 +16,14 @@
 #pragma once
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/hashset.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <maya/MCallbackIdArray.h>
 #include <maya/MObjectHandle.h>
 #include <ufe/path.h>
 
@@ -44,14 +46,15 @@ namespace ufe {
     nothing in the data model prevents it).  To generalized access to the
     underlying node, we store an MObjectHandle in the maps.
 
-    The cache is refreshed on access to a stage given a path which cannot be
-    found.  In this way, the cache does not need to observe the Maya data
-    model, and we avoid order of notification problems where one observer would
-    need to access the cache before it is refreshed, since there is no
-    guarantee on the order of notification of Ufe observers.  An earlier
-    implementation with rename observation had the Maya Outliner (which
-    observes rename) access the UsdStageMap on rename before the UsdStageMap
-    had been updated.
+    The map is kept up to date incrementally: once tracking has started, Maya
+    node added, node removed, rename and reparent callbacks add, remove and
+    re-key the proxy shape entries, and the stage set / invalidate notices
+    update the stage entries.  Lookups are therefore hashed lookups, and never
+    scan the scene.  Since there is no guarantee on the order of notification
+    of Ufe observers, the callbacks are Maya callbacks, which are called
+    before the Ufe notifications are sent.  An earlier implementation with
+    Ufe rename observation had the Maya Outliner (which observes rename)
+    access the UsdStageMap on rename before the UsdStageMap had been updated.
 */
 class MAYAUSD_CORE_PUBLIC UsdStageMap
 {
@@ -84,24 +87,55 @@ public:
     //! Return all the USD stages.
     StageSet allStages();
 
-    //! Set the stage map as dirty. It will be cleared immediately, but
-    //! only repopulated when stage info is requested.
-    void setDirty();
+    //! Start observing the Maya scene to keep the map up to date.  The proxy
+    //! shapes already in the scene are added to the map.
+    void startTracking();
 
-    //! Returns true if the stage map is dirty (meaning it needs to be filled in).
-    bool isDirty() const { return fDirty; }
+    //! Stop observing the Maya scene, and clear the map.
+    void stopTracking();
+
+    //! Remove all entries, e.g. before a new scene is created or opened.  The
+    //! proxy shapes of the new scene are added as they are created.
+    void clear();
+
+    //! Add a proxy shape node to the map.  If the node is already in the Dag,
+    //! its stage is recorded too, otherwise it is recorded once it is set, see
+    //! setStage().
+    void addProxyShape(const MObject& proxyShape);
+
+    //! Remove a proxy shape node, and its stage, from the map.
+    void removeProxyShape(const MObject& proxyShape);
+
+    //! Record the stage of a proxy shape node.
+    void setStage(const MObject& proxyShape, PXR_NS::UsdStageWeakPtr stage);
+
+    //! Forget the stage of a proxy shape node, until it is set again.
+    void invalidateStage(const MObject& proxyShape);
+
+    //! Update the paths of the proxy shapes at or below the argument Dag node,
+    //! after it has been renamed or reparented.
+    void dagNodeChanged(const MObject& dagNode);
 
 private:
-    void addItem(const Ufe::Path& path);
-    void rebuildIfDirty();
+    struct Entry
+    {
+        Ufe::Path               path;
+        PXR_NS::UsdStageWeakPtr stage;
+    };
+
+    MObjectHandle lookup(const Ufe::Path& path);
+    void          setPath(const MObjectHandle& proxyShape, Entry& entry, const Ufe::Path& path);
 
 private:
-    // We keep two maps for fast lookup when there are many proxy shapes.
+    // Hashed indexes, in both directions, for fast lookup when there are many
+    // proxy shapes.
     using PathToObject = std::unordered_map<Ufe::Path, MObjectHandle>;
     using StageToObject = PXR_NS::TfHashMap<PXR_NS::UsdStageWeakPtr, MObjectHandle, PXR_NS::TfHash>;
-    PathToObject  fPathToObject;
-    StageToObject fStageToObject;
-    bool          fDirty { true };
+    using ObjectToEntry = PXR_NS::UsdMayaUtil::MObjectHandleUnorderedMap<Entry>;
+    PathToObject     fPathToObject;
+    StageToObject    fStageToObject;
+    ObjectToEntry    fObjectToEntry;
+    MCallbackIdArray fCbIds;
 
 }; // UsdStageMap
 
@@ -16,22 +16,24 @@
 #include "editability.h"
 
 #include <mayaUsd/base/tokens.h>
+#include <mayaUsd/utils/metadataCache.h>
 
 namespace MAYAUSD_NS_DEF {
 namespace Editability {
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
-/*! \brief  Verify if a property is locked.
- */
-bool isLocked(PXR_NS::UsdProperty property)
+namespace {
+// Lock cache of the properties of each stage, invalidated when the lock metadata
+// or the hierarchy changes.
+MetadataCache& getCache()
 {
-    // The reason we treat invalid property as editable is because we don't want
-    // to influence editability of things that are not property that are being
-    // tested by accident.
-    if (!property.IsValid())
-        return false;
+    static MetadataCache cache(MayaUsdMetadata->Lock, /* inherited = */ false);
+    return cache;
+}
 
+bool isLockedUncached(const PXR_NS::UsdProperty& property)
+{
     PXR_NS::TfToken lock;
     if (!property.GetMetadata(MayaUsdMetadata->Lock, &lock))
         return false;
@@ -45,6 +47,41 @@ bool isLocked(PXR_NS::UsdProperty property)
         return false;
     }
 }
+} // namespace
+
+/*! \brief  Verify if a property is locked.
+ */
+bool isLocked(PXR_NS::UsdProperty property)
+{
+    // The reason we treat invalid property as editable is because we don't want
+    // to influence editability of things that are not property that are being
+    // tested by accident.
+    if (!property.IsValid())
+        return false;
+
+    auto&             cache = getCache();
+    const UsdStagePtr stage = property.GetStage();
+    const SdfPath&    path = property.GetPath();
+    bool              locked = false;
+    if (cache.find(stage, path, locked))
+        return locked;
+
+    locked = isLockedUncached(property);
+    cache.insert(stage, path, locked);
+    return locked;
+}
+
+/*! \brief  Retrieve the statistics of the lock cache.
+ */
+const MetadataCache::Statistics& getCacheStatistics() { return getCache().statistics(); }
+
+/*! \brief  Clear the lock cache and its statistics.
+ */
+void clearCache()
+{
+    getCache().clear();
+    getCache().resetStatistics();
+}
 
 } // namespace Editability
 } // namespace MAYAUSD_NS_DEF
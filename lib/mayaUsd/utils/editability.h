@@ -16,6 +16,9 @@
 #ifndef MAYA_USD_EDITABILITY_H
 #define MAYA_USD_EDITABILITY_H
 
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/metadataCache.h>
+
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/usd/property.h>
 
@@ -26,8 +29,21 @@ namespace MAYAUSD_NS_DEF {
 
 namespace Editability {
 /*! \brief  Verify if a property is locked.
+ *
+ *  The lock state is cached per stage, until the stage reports a change of it.
  */
+MAYAUSD_CORE_PUBLIC
 bool isLocked(PXR_NS::UsdProperty property);
+
+/*! \brief  Retrieve the statistics of the lock cache.
+ */
+MAYAUSD_CORE_PUBLIC
+const MetadataCache::Statistics& getCacheStatistics();
+
+/*! \brief  Clear the lock cache and its statistics.
+ */
+MAYAUSD_CORE_PUBLIC
+void clearCache();
 } // namespace Editability
 
 } // namespace MAYAUSD_NS_DEF
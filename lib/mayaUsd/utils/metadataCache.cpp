@@ -0,0 +1,136 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "metadataCache.h"
+
+#include <algorithm>
+
+namespace MAYAUSD_NS_DEF {
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+MetadataCache::MetadataCache(const TfToken& field, bool inherited)
+    : _field(field)
+    , _inherited(inherited)
+{
+}
+
+MetadataCache::~MetadataCache() { clear(); }
+
+bool MetadataCache::find(const UsdStagePtr& stage, const SdfPath& path, bool& state)
+{
+    StageStates* stageStates = _stageStates(stage, false);
+    if (stageStates) {
+        const auto found = stageStates->states.find(path);
+        if (found != stageStates->states.end() && found->second != kUnknown) {
+            ++_statistics.hits;
+            state = (found->second == kTrue);
+            return true;
+        }
+    }
+
+    ++_statistics.misses;
+    return false;
+}
+
+void MetadataCache::insert(const UsdStagePtr& stage, const SdfPath& path, bool state)
+{
+    StageStates* stageStates = _stageStates(stage, true);
+    if (!stageStates)
+        return;
+
+    stageStates->states[path] = state ? kTrue : kFalse;
+}
+
+void MetadataCache::clear()
+{
+    for (auto& entry : _stages)
+        TfNotice::Revoke(entry.second.noticeKey);
+    _stages.clear();
+}
+
+void MetadataCache::purgeExpiredStages()
+{
+    for (auto iter = _stages.begin(); iter != _stages.end();) {
+        if (iter->second.stage) {
+            ++iter;
+        } else {
+            TfNotice::Revoke(iter->second.noticeKey);
+            iter = _stages.erase(iter);
+        }
+    }
+}
+
+MetadataCache::StageStates* MetadataCache::_stageStates(const UsdStagePtr& stage, bool create)
+{
+    if (!stage)
+        return nullptr;
+
+    // A stage allocated where a deleted one was must not see its states.
+    auto found = _stages.find(get_pointer(stage));
+    if (found != _stages.end() && found->second.stage != stage) {
+        TfNotice::Revoke(found->second.noticeKey);
+        _stages.erase(found);
+        found = _stages.end();
+    }
+
+    if (found != _stages.end())
+        return &found->second;
+
+    if (!create)
+        return nullptr;
+
+    StageStates& stageStates = _stages[get_pointer(stage)];
+    stageStates.stage = stage;
+    stageStates.noticeKey
+        = TfNotice::Register(TfCreateWeakPtr(this), &MetadataCache::_onObjectsChanged, stage);
+    return &stageStates;
+}
+
+void MetadataCache::_onObjectsChanged(
+    const UsdNotice::ObjectsChanged& notice,
+    const UsdStageWeakPtr&           sender)
+{
+    StageStates* stageStates = _stageStates(sender, false);
+    if (!stageStates || stageStates->states.empty())
+        return;
+
+    for (const SdfPath& path : notice.GetResyncedPaths())
+        _invalidate(*stageStates, path, true);
+
+    const auto changedInfoOnlyPaths = notice.GetChangedInfoOnlyPaths();
+    for (auto iter = changedInfoOnlyPaths.begin(); iter != changedInfoOnlyPaths.end(); ++iter) {
+        const TfTokenVector& fields = iter.GetChangedFields();
+        if (std::find(fields.begin(), fields.end(), _field) != fields.end())
+            _invalidate(*stageStates, *iter, _inherited);
+    }
+}
+
+void MetadataCache::_invalidate(StageStates& stageStates, const SdfPath& path, bool descendants)
+{
+    ++_statistics.invalidations;
+
+    if (path.IsAbsoluteRootPath() && descendants) {
+        stageStates.states.clear();
+    } else if (descendants) {
+        stageStates.states.erase(path);
+    } else {
+        const auto found = stageStates.states.find(path);
+        if (found != stageStates.states.end())
+            found->second = kUnknown;
+    }
+}
+
+} // namespace MAYAUSD_NS_DEF
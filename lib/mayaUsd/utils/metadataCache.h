@@ -0,0 +1,120 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_METADATA_CACHE_H
+#define MAYAUSD_METADATA_CACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/pathTable.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <unordered_map>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief  Per-stage cache of boolean states computed from a metadata field, for
+ *          example the inherited selectability of prims or the lock of properties.
+ *
+ *  The cached states are kept until the stage reports a change that affects them
+ *  in a UsdNotice::ObjectsChanged:
+ *
+ *  - a resync of a path drops the states of the path and its descendants.
+ *  - a change of the metadata field on a path drops the state of the path and,
+ *    when the states are inherited, the ones of its descendants.
+ *
+ *  Other changes, for example of attribute values, keep the cache intact.
+ */
+class MAYAUSD_CORE_PUBLIC MetadataCache : public PXR_NS::TfWeakBase
+{
+public:
+    /*! \brief  Counters of the cache use, for tests and profiling.
+     */
+    struct Statistics
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t invalidations = 0;
+    };
+
+    /*! \brief  Create a cache of the states computed from the given metadata field.
+     *  \param  inherited true if the state of a path depends on the ones of its ancestors.
+     */
+    MetadataCache(const PXR_NS::TfToken& field, bool inherited);
+    ~MetadataCache();
+
+    MetadataCache(const MetadataCache&) = delete;
+    MetadataCache& operator=(const MetadataCache&) = delete;
+
+    /*! \brief  Retrieve the cached state of a path of the stage.
+     *  \return true if the state was cached.
+     */
+    bool find(const PXR_NS::UsdStagePtr& stage, const PXR_NS::SdfPath& path, bool& state);
+
+    /*! \brief  Cache the state of a path of the stage.
+     */
+    void insert(const PXR_NS::UsdStagePtr& stage, const PXR_NS::SdfPath& path, bool state);
+
+    /*! \brief  Forget the states of all stages, and those of the stages that no longer exist.
+     */
+    void clear();
+
+    /*! \brief  Forget the stages that no longer exist.
+     */
+    void purgeExpiredStages();
+
+    const Statistics& statistics() const { return _statistics; }
+    void              resetStatistics() { _statistics = Statistics(); }
+
+private:
+    // The states are stored as a char, with the default value for the ancestors
+    // that SdfPathTable implicitly adds.
+    enum : char
+    {
+        kUnknown = 0,
+        kFalse,
+        kTrue
+    };
+
+    struct StageStates
+    {
+        PXR_NS::UsdStageWeakPtr    stage;
+        PXR_NS::TfNotice::Key      noticeKey;
+        PXR_NS::SdfPathTable<char> states;
+    };
+
+    StageStates* _stageStates(const PXR_NS::UsdStagePtr& stage, bool create);
+
+    void _onObjectsChanged(
+        const PXR_NS::UsdNotice::ObjectsChanged& notice,
+        const PXR_NS::UsdStageWeakPtr&           sender);
+
+    void _invalidate(StageStates& stageStates, const PXR_NS::SdfPath& path, bool descendants);
+
+    PXR_NS::TfToken _field;
+    bool            _inherited;
+    Statistics      _statistics;
+
+    std::unordered_map<const PXR_NS::UsdStage*, StageStates> _stages;
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_METADATA_CACHE_H
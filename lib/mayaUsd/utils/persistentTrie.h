@@ -0,0 +1,224 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_UTILS_PERSISTENT_TRIE_H
+#define MAYAUSD_UTILS_PERSISTENT_TRIE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <ufe/pathComponent.h>
+#include <ufe/pathSegment.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace MAYAUSD_NS_DEF {
+
+/// \class PersistentTrie
+///
+/// \brief Prefix tree keyed by UFE path components, whose copies share their nodes.
+///
+/// Nodes are immutable once they are part of a trie. Modifying a trie copies
+/// only the nodes from the root down to the modified node, every other subtree
+/// is shared with the previous versions of the trie. Copying a trie is O(1),
+/// which makes it cheap to keep a previous version, e.g. for undo.
+///
+/// A key is any sequence of Ufe::PathComponent, such as a Ufe::Path or a
+/// Ufe::PathSegment::Components. Nodes that have neither data nor children
+/// are removed from the trie.
+template <typename T> class PersistentTrie
+{
+public:
+    class Node;
+    using NodePtr = std::shared_ptr<const Node>;
+    using Children = std::map<std::string, NodePtr>;
+
+    class Node
+    {
+    public:
+        explicit Node(const Ufe::PathComponent& component)
+            : _component(component)
+        {
+        }
+
+        const Ufe::PathComponent& component() const { return _component; }
+
+        bool     hasData() const { return static_cast<bool>(_data); }
+        const T& data() const { return *_data; }
+
+        bool            empty() const { return _children.empty(); }
+        const Children& children() const { return _children; }
+
+        NodePtr child(const Ufe::PathComponent& component) const
+        {
+            const auto found = _children.find(component.string());
+            return (found == _children.end()) ? nullptr : found->second;
+        }
+
+    private:
+        friend class PersistentTrie;
+
+        Ufe::PathComponent       _component;
+        std::shared_ptr<const T> _data;
+        Children                 _children;
+    };
+
+    PersistentTrie()
+        : _root(emptyRoot())
+    {
+    }
+
+    // Convert a key to the components that address the trie.
+    template <typename Key> static Ufe::PathSegment::Components components(const Key& key)
+    {
+        Ufe::PathSegment::Components result;
+        for (const auto& component : key) {
+            result.push_back(component);
+        }
+        return result;
+    }
+
+    const NodePtr& root() const { return _root; }
+
+    bool empty() const { return _root->empty(); }
+
+    void clear() { _root = emptyRoot(); }
+
+    // Return the node at the key, with or without data, or null if not in the trie.
+    template <typename Key> NodePtr node(const Key& key) const
+    {
+        NodePtr current = _root;
+        for (const auto& component : key) {
+            current = current->child(component);
+            if (!current) {
+                return nullptr;
+            }
+        }
+        return current;
+    }
+
+    // Return the node at the key if it has data, otherwise null.
+    template <typename Key> NodePtr find(const Key& key) const
+    {
+        NodePtr found = node(key);
+        return (found && found->hasData()) ? found : nullptr;
+    }
+
+    // Return true if there is data strictly below the key.
+    template <typename Key> bool containsDescendant(const Key& key) const
+    {
+        const NodePtr found = node(key);
+        return found && !found->empty();
+    }
+
+    // Return true if there is data at or below the key.
+    template <typename Key> bool containsDescendantInclusive(const Key& key) const
+    {
+        const NodePtr found = node(key);
+        return found && (found->hasData() || !found->empty());
+    }
+
+    // Set the data at the key, creating the node and its ancestors as needed.
+    template <typename Key> void add(const Key& key, T data)
+    {
+        auto value = std::make_shared<const T>(std::move(data));
+        update(components(key), [&value](const NodePtr& current, const Ufe::PathComponent& c) {
+            auto replacement
+                = current ? std::make_shared<Node>(*current) : std::make_shared<Node>(c);
+            replacement->_data = std::move(value);
+            return NodePtr(std::move(replacement));
+        });
+    }
+
+    // Remove the node at the key and all its descendants. Return the removed
+    // node, or null if the key was not in the trie.
+    template <typename Key> NodePtr remove(const Key& key)
+    {
+        NodePtr removed;
+        update(components(key), [&removed](const NodePtr& current, const Ufe::PathComponent&) {
+            removed = current;
+            return NodePtr();
+        });
+        return removed;
+    }
+
+    // Move the node at the old key and all its descendants to the new key,
+    // replacing whatever was there.
+    template <typename OldKey, typename NewKey>
+    void move(const OldKey& oldKey, const NewKey& newKey)
+    {
+        const NodePtr moved = remove(oldKey);
+        if (!moved) {
+            return;
+        }
+        update(components(newKey), [&moved](const NodePtr&, const Ufe::PathComponent& c) {
+            auto replacement = std::make_shared<Node>(*moved);
+            replacement->_component = c;
+            return NodePtr(std::move(replacement));
+        });
+    }
+
+private:
+    static NodePtr emptyRoot() { return std::make_shared<const Node>(Ufe::PathComponent("")); }
+
+    // Replace the node at the key by the result of fn, copying its ancestors.
+    template <typename Fn> void update(const Ufe::PathSegment::Components& key, Fn&& fn)
+    {
+        NodePtr newRoot = update(_root, _root->component(), key, 0, fn);
+        _root = newRoot ? newRoot : emptyRoot();
+    }
+
+    // Return the new version of the node at key[0, depth), null if it must be
+    // pruned, or the node itself if nothing changed below it.
+    template <typename Fn>
+    static NodePtr update(
+        const NodePtr&                      current,
+        const Ufe::PathComponent&           component,
+        const Ufe::PathSegment::Components& key,
+        size_t                              depth,
+        Fn&                                 fn)
+    {
+        if (depth == key.size()) {
+            return fn(current, component);
+        }
+
+        const Ufe::PathComponent& childComponent = key[depth];
+        const NodePtr             child = current ? current->child(childComponent) : nullptr;
+        const NodePtr             newChild = update(child, childComponent, key, depth + 1, fn);
+        if (newChild == child) {
+            return current;
+        }
+
+        auto replacement
+            = current ? std::make_shared<Node>(*current) : std::make_shared<Node>(component);
+        if (newChild) {
+            replacement->_children[childComponent.string()] = newChild;
+        } else {
+            replacement->_children.erase(childComponent.string());
+        }
+        if (!replacement->hasData() && replacement->empty()) {
+            return nullptr;
+        }
+        return replacement;
+    }
+
+    NodePtr _root;
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_UTILS_PERSISTENT_TRIE_H
@@ -17,8 +17,10 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/layer.h>
-#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/prim.h>
 
 namespace MAYAUSD_NS_DEF {
@@ -28,41 +30,61 @@ PXR_NAMESPACE_USING_DIRECTIVE
 namespace {
 
 void activate(
-    const UsdStagePtr& stage,
-    const SdfPath&     path,
-    SdfPathSet&        previouslyInactive,
-    SdfPathSet&        forcedActive)
+    const UsdStagePtr&   stage,
+    const SdfPathVector& paths,
+    SdfPathSet&          previouslyInactive,
+    SdfPathSet&          forcedActive)
 {
     if (!stage)
         return;
 
     SdfLayerHandle sessionLayer = stage->GetSessionLayer();
-    UsdEditContext editContext(stage, sessionLayer);
-
-    // The last prefix is the path itself and we don't need to activate
-    // it, so skip processing if there is only one prefix, otherwise
-    // remove the last prefix since it is the path and we don't want
-    // to explicitly activate it.
-    SdfPathVector prefixes = path.GetPrefixes();
-    if (prefixes.size() < 2)
-        return;
-    prefixes.pop_back();
-
-    for (const SdfPath& prefixPath : prefixes) {
-        UsdPrim prim = stage->GetPrimAtPath(prefixPath);
-        if (prim.IsActive())
-            continue;
-
-        // If the prim at the path has a "active" field in the session
-        // layer, then we must remember to set the opinion back to deactivated.
-        // Otherwise, we must remember to clear the opinion we are authoring.
-        if (sessionLayer->HasField(prefixPath, TfToken("active"))) {
-            previouslyInactive.insert(prefixPath);
-        } else {
-            forcedActive.insert(prefixPath);
+
+    // Collect the ancestors of all the paths. The paths themselves are not
+    // included since we don't want to explicitly activate them.
+    SdfPathSet ancestors;
+    for (const SdfPath& path : paths) {
+        for (SdfPath parent = path.GetParentPath(); parent.IsPrimPath();
+             parent = parent.GetParentPath()) {
+            ancestors.insert(parent);
+        }
+    }
+
+    // Activating an ancestor reveals its descendants, which may themselves be
+    // inactive, so the activation is done one level of inactive ancestors at a
+    // time. The activations of each level are done in a single change block.
+    while (!ancestors.empty()) {
+        SdfPathVector toActivate;
+        for (auto iter = ancestors.begin(); iter != ancestors.end();) {
+            UsdPrim prim = stage->GetPrimAtPath(*iter);
+            if (!prim) {
+                // Below an inactive ancestor, retry once the ancestor is active.
+                ++iter;
+                continue;
+            }
+            if (!prim.IsActive())
+                toActivate.push_back(*iter);
+            iter = ancestors.erase(iter);
         }
 
-        prim.SetActive(true);
+        if (toActivate.empty())
+            break;
+
+        SdfChangeBlock changeBlock;
+        for (const SdfPath& path : toActivate) {
+            // If the prim at the path has a "active" field in the session
+            // layer, then we must remember to set the opinion back to deactivated.
+            // Otherwise, we must remember to clear the opinion we are authoring.
+            if (sessionLayer->HasField(path, SdfFieldKeys->Active)) {
+                previouslyInactive.insert(path);
+            } else {
+                forcedActive.insert(path);
+            }
+
+            SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(sessionLayer, path);
+            if (primSpec)
+                primSpec->SetActive(true);
+        }
     }
 }
 
@@ -71,19 +93,24 @@ void deactivate(const UsdStagePtr& stage, SdfPathSet& previouslyInactive, SdfPat
     if (!stage)
         return;
 
+    if (previouslyInactive.empty() && forcedActive.empty())
+        return;
+
     SdfLayerHandle sessionLayer = stage->GetSessionLayer();
-    UsdEditContext editContext(stage, sessionLayer);
+    SdfChangeBlock changeBlock;
 
     for (const SdfPath& path : previouslyInactive) {
-        UsdPrim prim = stage->GetPrimAtPath(path);
-        prim.SetActive(false);
+        SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(sessionLayer, path);
+        if (primSpec)
+            primSpec->SetActive(false);
     }
 
     previouslyInactive.clear();
 
     for (const SdfPath& path : forcedActive) {
-        UsdPrim prim = stage->GetPrimAtPath(path);
-        prim.ClearActive();
+        SdfPrimSpecHandle primSpec = sessionLayer->GetPrimAtPath(path);
+        if (primSpec)
+            primSpec->ClearActive();
     }
 
     forcedActive.clear();
@@ -97,7 +124,7 @@ PrimActivation::PrimActivation(const UsdStagePtr& stage, const SdfPath& path)
     if (!_stage)
         throw std::runtime_error("Cannot find stage to activate prims.");
 
-    activate(stage, path, _previouslyInactive, _forcedActive);
+    activate(stage, { path }, _previouslyInactive, _forcedActive);
 }
 
 PrimActivation::PrimActivation(const Ufe::Path& path)
@@ -108,7 +135,16 @@ PrimActivation::PrimActivation(const Ufe::Path& path)
 
     const auto    segments = path.getSegments();
     const SdfPath usdPath = (segments.size() < 2) ? SdfPath("/") : SdfPath(segments[1].string());
-    activate(_stage, usdPath, _previouslyInactive, _forcedActive);
+    activate(_stage, { usdPath }, _previouslyInactive, _forcedActive);
+}
+
+PrimActivation::PrimActivation(const UsdStagePtr& stage, const SdfPathVector& paths)
+    : _stage(stage)
+{
+    if (!_stage)
+        throw std::runtime_error("Cannot find stage to activate prims.");
+
+    activate(stage, paths, _previouslyInactive, _forcedActive);
 }
 
 PrimActivation::~PrimActivation() { restore(); }
@@ -34,6 +34,11 @@ namespace MAYAUSD_NS_DEF {
 // activation state.
 //
 // The temporary activations are done in the session layer.
+//
+// Many prims can be made accessible at once: the activations of their
+// ancestors are then authored with one change block per nesting level of
+// inactive ancestors, so that the stage is recomposed once per level instead
+// of once per ancestor.
 
 class MAYAUSD_CORE_PUBLIC PrimActivation
 {
@@ -48,6 +53,9 @@ public:
     //! \brief make the prim at the given path accessible.
     PrimActivation(const Ufe::Path& path);
 
+    //! \brief make the prims at the given paths accessible.
+    PrimActivation(const PXR_NS::UsdStagePtr& stage, const PXR_NS::SdfPathVector& paths);
+
     //! \brief restore the previous activation status of ancestors.
     ~PrimActivation();
 
@@ -17,28 +17,23 @@
 
 #include <mayaUsd/base/tokens.h>
 
-#include <pxr/base/tf/hashmap.h>
-
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  The tokens used in the selectability metadata.
  */
 
 namespace {
-// Very simple selectability cache for prims to avoid rechecking the metadata.
-using Data = bool;
-using SelectabilityCache = TfHashMap<UsdPrim, Data, boost::hash<UsdPrim>>;
-
+// Selectability cache of the prims of each stage, kept across selections and
+// invalidated when the selectability metadata or the hierarchy changes.
+//
 // Use a function to retrieve the cache, as this exploits the C++ guaranteed
 // initialization of static in funtions.
-SelectabilityCache& getCache()
+MayaUsd::MetadataCache& getCache()
 {
-    static SelectabilityCache cache;
+    static MayaUsd::MetadataCache cache(MayaUsdMetadata->Selectability, /* inherited = */ true);
     return cache;
 }
 
-void clearCache() { getCache().clear(); }
-
 // Check selectability for a prim and recurse to parent if inheriting.
 bool isSelectableUncached(UsdPrim prim)
 {
@@ -56,7 +51,7 @@ bool isSelectableUncached(UsdPrim prim)
 
 /*! \brief  Do any internal preparation for selection needed.
  */
-void Selectability::prepareForSelection() { clearCache(); }
+void Selectability::prepareForSelection() { getCache().purgeExpiredStages(); }
 
 /*! \brief  Compute the selectability of a prim, considering inheritance.
  */
@@ -71,16 +66,33 @@ bool Selectability::isSelectable(UsdPrim prim)
     if (!prim.IsValid())
         return true;
 
-    auto&      cache = getCache();
-    const auto pos = cache.find(prim);
-    if (pos != cache.end())
-        return pos->second;
+    auto&             cache = getCache();
+    const UsdStagePtr stage = prim.GetStage();
+    const SdfPath&    path = prim.GetPath();
+    bool              selectable = true;
+    if (cache.find(stage, path, selectable))
+        return selectable;
 
-    const bool selectable = isSelectableUncached(prim);
-    cache[prim] = selectable;
+    selectable = isSelectableUncached(prim);
+    cache.insert(stage, path, selectable);
     return selectable;
 }
 
+/*! \brief  Retrieve the statistics of the selectability cache.
+ */
+const MayaUsd::MetadataCache::Statistics& Selectability::getCacheStatistics()
+{
+    return getCache().statistics();
+}
+
+/*! \brief  Clear the selectability cache and its statistics.
+ */
+void Selectability::clearCache()
+{
+    getCache().clear();
+    getCache().resetStatistics();
+}
+
 /*! \brief  Retrieve the local selectability state of a prim, without any inheritance.
  */
 Selectability::State Selectability::getLocalState(const UsdPrim& prim)
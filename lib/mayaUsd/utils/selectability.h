@@ -16,6 +16,9 @@
 #ifndef MAYAUSD_SELECTABILITY_H
 #define MAYAUSD_SELECTABILITY_H
 
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/metadataCache.h>
+
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/usd/prim.h>
 
@@ -37,16 +40,32 @@ public:
     };
 
     /*! \brief  Prepare any internal data needed for selection prior to selection queries.
+     *
+     *  The computed selectability is cached per stage across selections, and only
+     *  invalidated when the stage changes, so this only forgets the deleted stages.
      */
+    MAYAUSD_CORE_PUBLIC
     static void prepareForSelection();
 
     /*! \brief  Compute the selectability of a prim, considering inheritance.
      */
+    MAYAUSD_CORE_PUBLIC
     static bool isSelectable(UsdPrim prim);
 
     /*! \brief  Retrieve the local selectability state of a prim, without any inheritance.
      */
+    MAYAUSD_CORE_PUBLIC
     static State getLocalState(const UsdPrim& prim);
+
+    /*! \brief  Retrieve the statistics of the selectability cache.
+     */
+    MAYAUSD_CORE_PUBLIC
+    static const MayaUsd::MetadataCache::Statistics& getCacheStatistics();
+
+    /*! \brief  Clear the selectability cache and its statistics.
+     */
+    MAYAUSD_CORE_PUBLIC
+    static void clearCache();
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -83,6 +83,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/tokens.h>
 #include <pxr/usd/sdr/registry.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdGeom/camera.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
@@ -2526,6 +2527,58 @@ void UsdMayaUtil::AddMayaExtents(GfBBox3d& bbox, const UsdPrim& root, const UsdT
     }
 }
 
+bool UsdMayaUtil::HasMayaExtents(const UsdPrim& prim)
+{
+    GfRange3d localExtents;
+    return GetMayaExtent(prim, localExtents);
+}
+
+void UsdMayaUtil::CollectMayaExtentsPrims(const UsdPrim& root, SdfPathSet& paths)
+{
+    if (!root) {
+        return;
+    }
+
+    for (const UsdPrim& prim : UsdPrimRange(root)) {
+        if (HasMayaExtents(prim)) {
+            paths.insert(prim.GetPath());
+        }
+    }
+}
+
+void UsdMayaUtil::AddMayaExtents(
+    GfBBox3d&          bbox,
+    const UsdPrim&     root,
+    const SdfPathSet&  mayaExtentsPrims,
+    UsdGeomXformCache& xformCache)
+{
+    if (!root || mayaExtentsPrims.empty()) {
+        return;
+    }
+
+    const UsdStagePtr stage = root.GetStage();
+    const SdfPath&    rootPath = root.GetPath();
+    GfRange3d         localExtents;
+    for (const SdfPath& path : mayaExtentsPrims) {
+        if (!path.HasPrefix(rootPath)) {
+            continue;
+        }
+
+        const UsdPrim prim = stage->GetPrimAtPath(path);
+        if (!prim || !GetMayaExtent(prim, localExtents)) {
+            continue;
+        }
+
+        if (path == rootPath) {
+            bbox = GfBBox3d::Combine(bbox, GfBBox3d(localExtents));
+        } else {
+            bool resetXformStack;
+            auto xform = xformCache.ComputeRelativeTransform(prim, root, &resetXformStack);
+            bbox = GfBBox3d::Combine(bbox, GfBBox3d(localExtents, xform));
+        }
+    }
+}
+
 SdrShaderNodePtrVec UsdMayaUtil::GetSurfaceShaderNodeDefs()
 {
     // TODO: Replace hard-coded materials with dynamically generated list.
@@ -36,6 +36,7 @@
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 
 #include <maya/MArgDatabase.h>
 #include <maya/MBoundingBox.h>
@@ -688,6 +689,26 @@ void AddMayaExtents(
     const PXR_NS::UsdPrim&    root,
     const PXR_NS::UsdTimeCode time);
 
+/// Returns true if the supplied prim carries Maya-specific extents
+MAYAUSD_CORE_PUBLIC
+bool HasMayaExtents(const PXR_NS::UsdPrim& prim);
+
+/// Collects the paths of the prims at or below the supplied root node that
+/// carry Maya-specific extents
+MAYAUSD_CORE_PUBLIC
+void CollectMayaExtentsPrims(const PXR_NS::UsdPrim& root, PXR_NS::SdfPathSet& paths);
+
+/// Takes the supplied bounding box and adds to it Maya-specific extents of
+/// the given prims, as previously collected by CollectMayaExtentsPrims().
+/// Transforms relative to the root node are computed with the supplied
+/// cache, so that it can be reused between calls.
+MAYAUSD_CORE_PUBLIC
+void AddMayaExtents(
+    PXR_NS::GfBBox3d&          bbox,
+    const PXR_NS::UsdPrim&     root,
+    const PXR_NS::SdfPathSet&  mayaExtentsPrims,
+    PXR_NS::UsdGeomXformCache& xformCache);
+
 /// Access to materials associated with available renderers
 MAYAUSD_CORE_PUBLIC
 SdrShaderNodePtrVec GetSurfaceShaderNodeDefs();
@@ -23,8 +23,10 @@
 #include <mayaUsd/fileio/utils/writeUtil.h>
 
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usdGeom/pointBased.h>
 #include <pxr/usd/usdSkel/bindingAPI.h>
@@ -37,6 +39,7 @@
 #include <maya/MFnAttribute.h>
 #include <maya/MFnBlendShapeDeformer.h>
 #include <maya/MFnComponentListData.h>
+#include <maya/MFnDependencyNode.h>
 #include <maya/MFnGeometryFilter.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnPointArrayData.h>
@@ -48,6 +51,7 @@
 #include <maya/MStatus.h>
 
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <string>
 #include <unordered_map>
@@ -121,67 +125,217 @@ float mayaGetBlendShapeTargetWeightFromIndex(const unsigned int index)
     return targetWeight;
 }
 
-MStatus mayaFindPtAndNormalOffsetsBetweenMeshes(
-    const MObject&    a,
-    const MObject&    b,
-    VtVec3fArray&     ptOffsets,
-    VtVec3fArray&     nrmOffsets,
-    const VtIntArray& indices)
+/// The raw Maya mesh data needed to compute the offsets of a single target. It is gathered on the
+/// main thread once the blendshape deformer has been walked, so that the offsets themselves can
+/// then be computed in parallel without calling into Maya.
+struct MayaBlendShapeOffsetsJob
 {
-    MStatus status;
-    TF_VERIFY(MObjectHandle(a).isAlive() && MObjectHandle(b).isAlive());
-    if (!a.hasFn(MFn::kMesh) || !b.hasFn(MFn::kMesh)) {
-        return MStatus::kInvalidParameter;
-    }
+    MObject        targetMesh; // Null if the offsets were read from the deformer.
+    const GfVec3f* basePoints = nullptr;
+    const GfVec3f* baseNormals = nullptr;
+    const GfVec3f* targetPoints = nullptr;
+    const GfVec3f* targetNormals = nullptr;
+    size_t         weightDataIndex = 0;
+    size_t         targetIndex = 0;
+};
 
-    size_t numIndices = indices.size();
-    if (numIndices == 0) {
+MStatus
+mayaGetRawPointsAndNormals(const MObject& mesh, const GfVec3f*& points, const GfVec3f*& normals)
+{
+    MStatus status;
+    TF_VERIFY(MObjectHandle(mesh).isAlive());
+    if (!mesh.hasFn(MFn::kMesh)) {
         return MStatus::kInvalidParameter;
     }
 
-    ptOffsets.resize(numIndices);
-    nrmOffsets.resize(numIndices);
-
-    MFnMesh fnMesh(a, &status);
+    MFnMesh fnMesh(mesh, &status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const float* nrmsA = fnMesh.getRawNormals(&status);
+    const float* nrms = fnMesh.getRawNormals(&status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const GfVec3f* pVtNrmsA = reinterpret_cast<const GfVec3f*>(nrmsA);
-
     // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsA = fnMesh.getRawPoints(&status);
+    const float* pts = fnMesh.getRawPoints(&status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const GfVec3f* pVtPtsA = reinterpret_cast<const GfVec3f*>(ptsA);
+    normals = reinterpret_cast<const GfVec3f*>(nrms);
+    points = reinterpret_cast<const GfVec3f*>(pts);
+    return status;
+}
 
-    status = fnMesh.setObject(b);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+/// Computes the point and normal offsets of the given components between two meshes. This does
+/// not call into Maya, so it is safe to call from worker threads.
+void findPtAndNormalOffsetsBetweenMeshes(
+    const GfVec3f*    ptsA,
+    const GfVec3f*    nrmsA,
+    const GfVec3f*    ptsB,
+    const GfVec3f*    nrmsB,
+    VtVec3fArray&     ptOffsets,
+    VtVec3fArray&     nrmOffsets,
+    const VtIntArray& indices)
+{
+    const size_t numIndices = indices.size();
+    ptOffsets.resize(numIndices);
+    nrmOffsets.resize(numIndices);
 
-    const float* nrmsB = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    // NOTE: Work on the raw storage so that the loop body stays free of any copy-on-write checks
+    // and can be auto-vectorized.
+    const int* pIndices = indices.cdata();
+    GfVec3f*   pPtOffsets = ptOffsets.data();
+    GfVec3f*   pNrmOffsets = nrmOffsets.data();
+    for (size_t i = 0; i < numIndices; ++i) {
+        const int componentIdx = pIndices[i];
+        pPtOffsets[i] = ptsB[componentIdx] - ptsA[componentIdx];
+        pNrmOffsets[i] = nrmsB[componentIdx] - nrmsA[componentIdx];
+    }
+}
 
-    const GfVec3f* pVtNrmsB = reinterpret_cast<const GfVec3f*>(nrmsB);
+/// Removes the components whose point and normal offsets are all within `epsilon`, so that only
+/// the components actually affected by the target are written out.
+void pruneNegligibleOffsets(
+    const float   epsilon,
+    VtIntArray&   indices,
+    VtVec3fArray& ptOffsets,
+    VtVec3fArray& nrmOffsets)
+{
+    const size_t numIndices = indices.size();
+    if (ptOffsets.size() != numIndices || nrmOffsets.size() != numIndices) {
+        return;
+    }
 
-    // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsB = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    auto isNegligible = [epsilon](const GfVec3f& v) {
+        return std::abs(v[0]) <= epsilon && std::abs(v[1]) <= epsilon && std::abs(v[2]) <= epsilon;
+    };
 
-    const GfVec3f* pVtPtsB = reinterpret_cast<const GfVec3f*>(ptsB);
+    int*     pIndices = indices.data();
+    GfVec3f* pPtOffsets = ptOffsets.data();
+    GfVec3f* pNrmOffsets = nrmOffsets.data();
+    size_t   numKept = 0;
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (isNegligible(pPtOffsets[i]) && isNegligible(pNrmOffsets[i])) {
+            continue;
+        }
+        pIndices[numKept] = pIndices[i];
+        pPtOffsets[numKept] = pPtOffsets[i];
+        pNrmOffsets[numKept] = pNrmOffsets[i];
+        ++numKept;
+    }
 
-    for (unsigned int i = 0; i < numIndices; ++i) {
-        const int     componentIdx = indices[i];
-        const GfVec3f ptA = pVtPtsA[componentIdx];
-        const GfVec3f ptB = pVtPtsB[componentIdx];
-        ptOffsets[i] = ptB - ptA;
+    if (numKept != numIndices) {
+        indices.resize(numKept);
+        ptOffsets.resize(numKept);
+        nrmOffsets.resize(numKept);
+    }
+}
+
+/// Makes targets with identical components and offsets share the same array storage, so that they
+/// are only held once in memory and are cheap to deduplicate when the layer is written.
+void deduplicateTargets(std::vector<MayaBlendShapeTargetDatum*>& targets)
+{
+    std::unordered_multimap<size_t, const MayaBlendShapeTargetDatum*> uniqueTargets;
+    for (MayaBlendShapeTargetDatum* target : targets) {
+        if (target->indices.empty()) {
+            continue;
+        }
 
-        const GfVec3f nrmA = pVtNrmsA[componentIdx];
-        const GfVec3f nrmB = pVtNrmsB[componentIdx];
-        nrmOffsets[i] = nrmB - nrmA;
+        // NOTE: Hashing the point offsets is enough to bucket the targets, the full comparison
+        // below takes care of the collisions.
+        const size_t hash = TfHash()(target->ptOffsets);
+        bool found = false;
+        auto range = uniqueTargets.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const MayaBlendShapeTargetDatum* other = it->second;
+            if (other->indices == target->indices && other->ptOffsets == target->ptOffsets
+                && other->normalOffsets == target->normalOffsets) {
+                target->indices = other->indices;
+                target->ptOffsets = other->ptOffsets;
+                target->normalOffsets = other->normalOffsets;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            uniqueTargets.emplace(hash, target);
+        }
     }
+}
 
-    return status;
+/// Gets the raw mesh data of the jobs computing their offsets from a target mesh. This is done
+/// right before the offsets are computed, since evaluating the plugs of the deformer can
+/// invalidate the raw data of the meshes. The targets whose mesh data cannot be read are dropped,
+/// leaving them without any effect.
+void mayaGetBlendShapeOffsetsData(
+    const MObject&                          baseMesh,
+    std::vector<MayaBlendShapeOffsetsJob>&  jobs,
+    std::vector<MayaBlendShapeWeightDatum>& weightDatas)
+{
+    const GfVec3f* basePoints = nullptr;
+    const GfVec3f* baseNormals = nullptr;
+    const bool     hasBaseData
+        = mayaGetRawPointsAndNormals(baseMesh, basePoints, baseNormals) == MStatus::kSuccess;
+
+    size_t numKept = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        MayaBlendShapeOffsetsJob& job = jobs[i];
+        if (!job.targetMesh.isNull()) {
+            job.basePoints = basePoints;
+            job.baseNormals = baseNormals;
+            if (!hasBaseData
+                || mayaGetRawPointsAndNormals(job.targetMesh, job.targetPoints, job.targetNormals)
+                    != MStatus::kSuccess) {
+                MayaBlendShapeTargetDatum& target
+                    = weightDatas[job.weightDataIndex].targets[job.targetIndex];
+                TF_RUNTIME_ERROR(
+                    "Could not read the points and normals of the blendshape target mesh: %s",
+                    MFnDependencyNode(job.targetMesh).name().asChar());
+                target.indices.clear();
+                target.ptOffsets.clear();
+                target.normalOffsets.clear();
+                continue;
+            }
+        }
+        jobs[numKept++] = job;
+    }
+    jobs.resize(numKept);
+}
+
+/// Computes the offsets of all the targets of a blendshape deformer in parallel, then prunes and
+/// deduplicates them.
+void computeBlendShapeTargetOffsets(
+    const std::vector<MayaBlendShapeOffsetsJob>& jobs,
+    std::vector<MayaBlendShapeWeightDatum>&      weightDatas,
+    const float                                  epsilon)
+{
+    WorkParallelForN(jobs.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const MayaBlendShapeOffsetsJob& job = jobs[i];
+            MayaBlendShapeTargetDatum&      target
+                = weightDatas[job.weightDataIndex].targets[job.targetIndex];
+            if (job.targetPoints) {
+                findPtAndNormalOffsetsBetweenMeshes(
+                    job.basePoints,
+                    job.baseNormals,
+                    job.targetPoints,
+                    job.targetNormals,
+                    target.ptOffsets,
+                    target.normalOffsets,
+                    target.indices);
+            }
+            if (epsilon > 0.0f) {
+                pruneNegligibleOffsets(
+                    epsilon, target.indices, target.ptOffsets, target.normalOffsets);
+            }
+        }
+    });
+
+    if (epsilon > 0.0f) {
+        std::vector<MayaBlendShapeTargetDatum*> targets;
+        targets.reserve(jobs.size());
+        for (const MayaBlendShapeOffsetsJob& job : jobs) {
+            targets.push_back(&weightDatas[job.weightDataIndex].targets[job.targetIndex]);
+        }
+        deduplicateTargets(targets);
+    }
 }
 
 #if MAYA_BLENDSHAPE_EVAL_HOTFIX
@@ -264,12 +418,17 @@ MStatus mayaBlendShapeTriggerAllTargets(MObject& blendShape)
  *                               and retrieve them. If not, empty targets will be skipped in the
  *                               final result.
  *
+ * @param offsetEpsilon          If greater than zero, components whose offsets are all within this
+ *                               tolerance are dropped from the targets, and identical targets share
+ *                               their data.
+ *
  * @return                       A status code.
  */
 MStatus mayaGetBlendShapeInfosForMesh(
     const MObject&                    deformedMesh,
     std::vector<MayaBlendShapeDatum>& outInfos,
-    const bool                        getEmptyBlendShapes)
+    const bool                        getEmptyBlendShapes,
+    const float                       offsetEpsilon)
 {
     // TODO: (yliangsiew) Eh, find a way to avoid incremental allocations like these and just
     // allocate upfront. But hard to do with the iterative search functions of the DG...
@@ -374,6 +533,10 @@ MStatus mayaGetBlendShapeInfosForMesh(
         mayaBlendShapeTriggerAllTargets(curBlendShape);
 #endif
 
+        // NOTE: The offsets are computed in a single parallel pass once all the targets of the
+        // deformer have been found, since this does not require calling into Maya.
+        std::vector<MayaBlendShapeOffsetsJob> offsetsJobs;
+
         for (unsigned int i = 0; i < weightIndices.length(); ++i) {
             MayaBlendShapeWeightDatum weightInfo = {};
             weightInfo.weightIndex = weightIndices[i];
@@ -458,12 +621,12 @@ MStatus mayaGetBlendShapeInfosForMesh(
                     TF_VERIFY(meshInGeomTgt.hasFn(MFn::kMesh));
 
                     meshTargetDatum.targetMesh = meshInGeomTgt;
-                    mayaFindPtAndNormalOffsetsBetweenMeshes(
-                        inputGeo,
-                        meshInGeomTgt,
-                        meshTargetDatum.ptOffsets,
-                        meshTargetDatum.normalOffsets,
-                        meshTargetDatum.indices);
+
+                    MayaBlendShapeOffsetsJob offsetsJob;
+                    offsetsJob.targetMesh = meshInGeomTgt;
+                    offsetsJob.weightDataIndex = info.weightDatas.size();
+                    offsetsJob.targetIndex = weightInfo.targets.size();
+                    offsetsJobs.push_back(offsetsJob);
                 } else {
                     // NOTE: (yliangsiew) If there is no geometry target, then we have to assume
                     // the target has already been "baked" into the blendshape deformer. In this
@@ -479,10 +642,16 @@ MStatus mayaGetBlendShapeInfosForMesh(
                     CHECK_MSTATUS_AND_RETURN_IT(stat);
 
                     MPointArray ptDeltas = fnPtArrayData.array();
+                    meshTargetDatum.ptOffsets.resize(numComponentIndices);
                     for (unsigned int m = 0; m < numComponentIndices; ++m) {
                         MPoint pt = ptDeltas[m];
-                        meshTargetDatum.ptOffsets.push_back(GfVec3f(pt.x, pt.y, pt.z));
+                        meshTargetDatum.ptOffsets[m] = GfVec3f(pt.x, pt.y, pt.z);
                     }
+
+                    MayaBlendShapeOffsetsJob offsetsJob;
+                    offsetsJob.weightDataIndex = info.weightDatas.size();
+                    offsetsJob.targetIndex = weightInfo.targets.size();
+                    offsetsJobs.push_back(offsetsJob);
                 }
                 weightInfo.targets.push_back(meshTargetDatum);
             }
@@ -499,6 +668,9 @@ MStatus mayaGetBlendShapeInfosForMesh(
 
             info.weightDatas.push_back(weightInfo);
         }
+
+        mayaGetBlendShapeOffsetsData(inputGeo, offsetsJobs, info.weightDatas);
+        computeBlendShapeTargetOffsets(offsetsJobs, info.weightDatas, offsetEpsilon);
         outInfos.push_back(info);
     }
     return stat;
@@ -609,10 +781,13 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
     // TODO: (yliangsiew) Figure out if this can be isolated. It's kind of hard
     // because we want to avoid repeated walks through the DG.
     std::vector<MayaBlendShapeDatum> blendShapeDeformerInfos;
+    const float offsetEpsilon = static_cast<float>(exportArgs.blendShapeOffsetEpsilon);
     if (exportArgs.ignoreWarnings) {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, true);
+        stat = mayaGetBlendShapeInfosForMesh(
+            deformedMesh, blendShapeDeformerInfos, true, offsetEpsilon);
     } else {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, false);
+        stat = mayaGetBlendShapeInfosForMesh(
+            deformedMesh, blendShapeDeformerInfos, false, offsetEpsilon);
     }
     if (stat != MStatus::kSuccess) {
         TF_WARN(
@@ -739,7 +914,11 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
                         return MObject::kNullObj;
                     }
 
-                    usdBlendShape.CreatePointIndicesAttr(VtValue(targetDatum.indices));
+                    // NOTE: The components of a target can all be pruned by the sparse export,
+                    // in which case an empty pointIndices is not authored.
+                    if (!targetDatum.indices.empty()) {
+                        usdBlendShape.CreatePointIndicesAttr(VtValue(targetDatum.indices));
+                    }
                     usdBlendShape.CreateOffsetsAttr(VtValue(targetDatum.ptOffsets));
                     usdBlendShape.CreateNormalOffsetsAttr(VtValue(targetDatum.normalOffsets));
 
@@ -930,7 +1109,9 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
                     unsigned int targetWeightIndex = weightInfo.targetItemIndices[k];
                     if (targetWeightIndex == 6000) { // NOTE: (yliangsiew) For default fullweight,
                                                      // we don't append the weight name.
-                        usdBlendShape.CreatePointIndicesAttr(VtValue(unionIndices));
+                        if (!unionIndices.empty()) {
+                            usdBlendShape.CreatePointIndicesAttr(VtValue(unionIndices));
+                        }
                         usdBlendShape.CreateOffsetsAttr(VtValue(processedOffsetsArrays[k]));
                         usdBlendShape.CreateNormalOffsetsAttr(
                             VtValue(processedNormalsOffsetsArrays[k]));
@@ -25,6 +25,8 @@
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -38,10 +40,10 @@
 #include <maya/MIntArray.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
+#include <maya/MVector.h>
 #include <maya/MVectorArray.h>
 
 #include <limits>
-#include <memory>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -66,39 +68,53 @@ template <typename T> inline void _convertVector(T& t, const MVector& v)
     t[2] = static_cast<_t>(v.z);
 }
 
-template <typename T> using _sharedVtArray = std::shared_ptr<VtArray<T>>;
+// Particle systems can hold millions of particles, so the per-particle arrays are converted in
+// parallel chunks, directly into pre-sized VtArrays. The Maya array accessors are only called on
+// the calling thread, to get the pointer to the contiguous data that the workers read.
+constexpr size_t _conversionGrainSize = 16384;
 
-template <typename T> _sharedVtArray<T> _convertVectorArray(const MVectorArray& a)
+template <typename T> void _convertVectorArray(MVectorArray& a, VtArray<T>& ret)
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        _convertVector<T>(ret->operator[](i), a[i]);
+    const size_t count = a.length();
+    ret = VtArray<T>(count);
+    if (count == 0) {
+        return;
     }
-    return _sharedVtArray<T>(ret);
-}
 
-template <typename T> _sharedVtArray<T> _convertArray(const MDoubleArray& a)
-{
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
-    }
-    return _sharedVtArray<T>(ret);
+    T*             dst = ret.data();
+    const MVector* src = &a[0];
+    WorkParallelForN(
+        count,
+        [src, dst](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _convertVector<T>(dst[i], src[i]);
+            }
+        },
+        _conversionGrainSize);
 }
 
-template <typename T> _sharedVtArray<T> _convertArray(const MIntArray& a)
+template <typename T, typename A> void _convertArray(A& a, VtArray<T>& ret, T scale = T(1))
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
+    const size_t count = a.length();
+    ret = VtArray<T>(count);
+    if (count == 0) {
+        return;
     }
-    return _sharedVtArray<T>(ret);
+
+    using B = typename std::remove_reference<decltype(a[0])>::type;
+    T*       dst = ret.data();
+    const B* src = &a[0];
+    WorkParallelForN(
+        count,
+        [src, dst, scale](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] = static_cast<T>(src[i]) * scale;
+            }
+        },
+        _conversionGrainSize);
 }
 
-template <typename T> using _strVecPair = std::pair<TfToken, _sharedVtArray<T>>;
+template <typename T> using _strVecPair = std::pair<TfToken, VtArray<T>>;
 
 template <typename T> using _strVecPairVec = std::vector<_strVecPair<T>>;
 
@@ -106,7 +122,7 @@ template <typename T> size_t _minCount(const _strVecPairVec<T>& a)
 {
     auto mn = std::numeric_limits<size_t>::max();
     for (const auto& v : a) {
-        mn = std::min(mn, v.second->size());
+        mn = std::min(mn, v.second.size());
     }
 
     return mn;
@@ -114,8 +130,8 @@ template <typename T> size_t _minCount(const _strVecPairVec<T>& a)
 
 template <typename T> void _resizeVectors(_strVecPairVec<T>& a, size_t size)
 {
-    for (const auto& v : a) {
-        v.second->resize(size);
+    for (auto& v : a) {
+        v.second.resize(size);
     }
 }
 
@@ -148,7 +164,7 @@ void _addAttrVec(
     UsdUtilsSparseValueWriter* valueWriter)
 {
     for (const auto& v : a) {
-        _addAttr(points, v.first, typeName, *v.second, usdTime, valueWriter);
+        _addAttr(points, v.first, typeName, v.second, usdTime, valueWriter);
     }
 }
 
@@ -300,35 +316,46 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
     MDoubleArray mayaDoubles;
     MIntArray    mayaInts;
 
+    VtVec3fArray positions;
+    VtVec3fArray velocities;
+    VtInt64Array ids;
+    VtFloatArray widths;
+    VtFloatArray masses;
+
     deformedParticleSys.position(mayaVectors);
-    auto positions = _convertVectorArray<GfVec3f>(mayaVectors);
+    _convertVectorArray<GfVec3f>(mayaVectors, positions);
     particleSys.velocity(mayaVectors);
-    auto velocities = _convertVectorArray<GfVec3f>(mayaVectors);
+    _convertVectorArray<GfVec3f>(mayaVectors, velocities);
     particleSys.particleIds(mayaInts);
-    auto ids = _convertArray<int64_t>(mayaInts);
+    _convertArray<int64_t>(mayaInts, ids);
     particleSys.radius(mayaDoubles);
-    auto radii = _convertArray<float>(mayaDoubles);
+    // radius -> width conversion
+    _convertArray<float>(mayaDoubles, widths, 2.0f);
     particleSys.mass(mayaDoubles);
-    auto masses = _convertArray<float>(mayaDoubles);
+    _convertArray<float>(mayaDoubles, masses);
 
     if (particleSys.hasRgb()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_rgbName, _convertVectorArray<GfVec3f>(mayaVectors));
+        vectors.emplace_back(_rgbName, VtVec3fArray());
+        _convertVectorArray<GfVec3f>(mayaVectors, vectors.back().second);
     }
 
     if (particleSys.hasEmission()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_emissionName, _convertVectorArray<GfVec3f>(mayaVectors));
+        vectors.emplace_back(_emissionName, VtVec3fArray());
+        _convertVectorArray<GfVec3f>(mayaVectors, vectors.back().second);
     }
 
     if (particleSys.hasOpacity()) {
         particleSys.opacity(mayaDoubles);
-        floats.emplace_back(_opacityName, _convertArray<float>(mayaDoubles));
+        floats.emplace_back(_opacityName, VtFloatArray());
+        _convertArray<float>(mayaDoubles, floats.back().second);
     }
 
     if (particleSys.hasLifespan()) {
         particleSys.lifespan(mayaDoubles);
-        floats.emplace_back(_lifespanName, _convertArray<float>(mayaDoubles));
+        floats.emplace_back(_lifespanName, VtFloatArray());
+        _convertArray<float>(mayaDoubles, floats.back().second);
     }
 
     for (const auto& attr : mUserAttributes) {
@@ -337,19 +364,22 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
         case PER_PARTICLE_INT:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaInts, &status);
             if (status) {
-                ints.emplace_back(std::get<0>(attr), _convertArray<int>(mayaInts));
+                ints.emplace_back(std::get<0>(attr), VtIntArray());
+                _convertArray<int>(mayaInts, ints.back().second);
             }
             break;
         case PER_PARTICLE_DOUBLE:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaDoubles, &status);
             if (status) {
-                floats.emplace_back(std::get<0>(attr), _convertArray<float>(mayaDoubles));
+                floats.emplace_back(std::get<0>(attr), VtFloatArray());
+                _convertArray<float>(mayaDoubles, floats.back().second);
             }
             break;
         case PER_PARTICLE_VECTOR:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaVectors, &status);
             if (status) {
-                vectors.emplace_back(std::get<0>(attr), _convertVectorArray<GfVec3f>(mayaVectors));
+                vectors.emplace_back(std::get<0>(attr), VtVec3fArray());
+                _convertVectorArray<GfVec3f>(mayaVectors, vectors.back().second);
             }
             break;
         }
@@ -358,11 +388,11 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
     const auto minSize = std::min({ _minCount(vectors),
                                     _minCount(floats),
                                     _minCount(ints),
-                                    positions->size(),
-                                    velocities->size(),
-                                    ids->size(),
-                                    radii->size(),
-                                    masses->size() });
+                                    positions.size(),
+                                    velocities.size(),
+                                    ids.size(),
+                                    widths.size(),
+                                    masses.size() });
 
     if (minSize == 0) {
         return;
@@ -371,32 +401,25 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
     _resizeVectors(vectors, minSize);
     _resizeVectors(floats, minSize);
     _resizeVectors(ints, minSize);
-    positions->resize(minSize);
-    velocities->resize(minSize);
-    ids->resize(minSize);
-    radii->resize(minSize);
-    masses->resize(minSize);
+    positions.resize(minSize);
+    velocities.resize(minSize);
+    ids.resize(minSize);
+    widths.resize(minSize);
+    masses.resize(minSize);
 
     UsdMayaWriteUtil::SetAttribute(
-        points.GetPointsAttr(), positions.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetVelocitiesAttr(), velocities.get(), usdTime, _GetSparseValueWriter());
+        points.GetPointsAttr(), &positions, usdTime, _GetSparseValueWriter());
     UsdMayaWriteUtil::SetAttribute(
-        points.GetIdsAttr(), ids.get(), usdTime, _GetSparseValueWriter());
-
-    // radius -> width conversion
-    for (auto& r : *radii) {
-        r = r * 2.0f;
-    }
-
+        points.GetVelocitiesAttr(), &velocities, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(points.GetIdsAttr(), &ids, usdTime, _GetSparseValueWriter());
     UsdMayaWriteUtil::SetAttribute(
-        points.GetWidthsAttr(), radii.get(), usdTime, _GetSparseValueWriter());
+        points.GetWidthsAttr(), &widths, usdTime, _GetSparseValueWriter());
 
     _addAttr(
         points,
         _massName,
         SdfValueTypeNames->FloatArray,
-        *masses,
+        masses,
         usdTime,
         _GetSparseValueWriter());
     // TODO: check if we need the array suffix!!
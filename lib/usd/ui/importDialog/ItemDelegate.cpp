@@ -46,28 +46,10 @@ QWidget* ItemDelegate::createEditor(
         TreeItem* treeItem = getTreeItemForIndex(index);
         assert(treeItem != nullptr);
         if (nullptr != treeItem) {
-            // Look in the import data (from the tree model) to see if it has a prim variant
-            // selection matching the prim from this item. If found we send that variant selection
-            // to the editor so that it will set that value rather (in the combobox) rather than the
-            // one from prim.
-            SdfVariantSelectionMap varSelMap;
-            TreeModel*             treeModel = qobject_cast<TreeModel*>(treeItem->model());
-            if ((treeModel != nullptr) && (treeModel->importData() != nullptr)) {
-                const ImportData::PrimVariantSelections& primVarSel
-                    = treeModel->importData()->primVariantSelections();
-                ImportData::PrimVariantSelections::const_iterator iter
-                    = primVarSel.find(treeItem->prim().GetPath());
-                if (iter != std::end(primVarSel)) {
-                    varSelMap = iter->second;
-                }
-            }
-
-            VariantsEditorWidget* editor
-                = new VariantsEditorWidget(parent, this, treeItem->prim(), varSelMap);
-            if (!varSelMap.empty()) {
-                setModelData(editor, treeItem->model(), treeItem->model()->indexFromItem(treeItem));
-            }
-            return editor;
+            // The variant selections of the import data are restored on the items by the
+            // tree model, and the editor is set from the item by setEditorData().
+            return new VariantsEditorWidget(
+                parent, this, treeItem->prim(), SdfVariantSelectionMap());
         }
     }
 
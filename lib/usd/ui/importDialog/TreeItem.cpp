@@ -36,6 +36,7 @@ TreeItem::TreeItem(const UsdPrim& prim, Type t) noexcept
     , fType(t)
     , fCheckState(CheckState::kChecked_Disabled)
     , fVariantSelectionModified(false)
+    , fChildrenFetched(false)
 {
     initializeItem();
 }
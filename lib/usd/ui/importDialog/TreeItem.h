@@ -101,6 +101,14 @@ public:
     //! Only valid for kVariants type.
     void resetVariantSelectionModified() { fVariantSelectionModified = false; }
 
+    //! Returns true once the rows of the children of the prim were created.
+    //! Only valid for kLoad type, which holds the children.
+    bool childrenFetched() const { return fChildrenFetched; }
+
+    //! Flag the rows of the children of the prim as created.
+    //! Only valid for kLoad type.
+    void setChildrenFetched() { fChildrenFetched = true; }
+
 private:
     void initializeItem();
 
@@ -117,6 +125,9 @@ protected:
     // Special flag set when the variant selection was modified.
     bool fVariantSelectionModified;
 
+    // For the LOAD column, true once the rows of the children were created.
+    bool fChildrenFetched;
+
     static QPixmap* fsCheckBoxOn;
     static QPixmap* fsCheckBoxOnDisabled;
     static QPixmap* fsCheckBoxOff;
@@ -18,13 +18,16 @@
 #include <mayaUsdUI/ui/IMayaMQtUtil.h>
 #include <mayaUsdUI/ui/ItemDelegate.h>
 #include <mayaUsdUI/ui/TreeItem.h>
+#include <mayaUsdUI/ui/TreeModelFactory.h>
 
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/variantSets.h>
 
 #include <QtCore/QSortFilterProxyModel>
 #include <QtWidgets/QTreeView>
 
 #include <functional>
+#include <iterator>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -129,6 +132,88 @@ Qt::ItemFlags TreeModel::flags(const QModelIndex& index) const
     return flags;
 }
 
+TreeItem* TreeModel::loadItem(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return nullptr;
+
+    // Note: only the load column (0) has children, so it is the one tracking their creation.
+    return static_cast<TreeItem*>(itemFromIndex(index.sibling(index.row(), kTreeColumn_Load)));
+}
+
+bool TreeModel::hasChildren(const QModelIndex& parent /*= QModelIndex()*/) const
+{
+    if (parent.column() == kTreeColumn_Load) {
+        // Answer from the stage until the rows of the children are created.
+        TreeItem* item = loadItem(parent);
+        if (item != nullptr && !item->childrenFetched())
+            return !item->prim().GetAllChildren().empty();
+    }
+    return ParentClass::hasChildren(parent);
+}
+
+bool TreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    TreeItem* item = loadItem(parent);
+    return item != nullptr && !item->childrenFetched();
+}
+
+void TreeModel::fetchMore(const QModelIndex& parent)
+{
+    TreeItem* item = loadItem(parent);
+    if (item == nullptr || item->childrenFetched())
+        return;
+    item->setChildrenFetched();
+
+    // The children have the check state they would have received when the state of their
+    // parent was set: checked-disabled under a checked item, otherwise the one of the parent.
+    TreeItem::CheckState childState = item->checkState();
+    if (childState == TreeItem::CheckState::kChecked)
+        childState = TreeItem::CheckState::kChecked_Disabled;
+
+    for (const auto& childPrim : item->prim().GetAllChildren()) {
+        QList<QStandardItem*> primDataCells = TreeModelFactory::createPrimRow(childPrim);
+        static_cast<TreeItem*>(primDataCells.front())->setCheckState(childState);
+        item->appendRow(primDataCells);
+    }
+
+    // The new rows in scope are now counted.
+    if (childState == TreeItem::CheckState::kChecked_Disabled)
+        updateCheckedItemCount();
+}
+
+TreeItem* TreeModel::fetchItem(const SdfPath& path)
+{
+    // The pseudo-root is the single top-level row.
+    TreeItem* item = static_cast<TreeItem*>(itemFromIndex(index(0, kTreeColumn_Load)));
+    if (item == nullptr || path.IsEmpty())
+        return nullptr;
+
+    // Create the rows down to the prim.
+    for (const SdfPath& prefix : path.GetPrefixes()) {
+        if (prefix.IsAbsoluteRootPath())
+            continue;
+
+        fetchMore(item->index());
+        TreeItem* child = nullptr;
+        for (int r = 0; r < item->rowCount() && child == nullptr; ++r) {
+            TreeItem* childItem = static_cast<TreeItem*>(item->child(r, kTreeColumn_Load));
+            if (childItem->prim().GetPath() == prefix)
+                child = childItem;
+        }
+        if (child == nullptr)
+            return nullptr;
+        item = child;
+    }
+    return item;
+}
+
+int TreeModel::countDescendants(const UsdPrim& prim) const
+{
+    UsdPrimRange range(prim, UsdPrimAllPrimsPredicate);
+    return static_cast<int>(std::distance(range.begin(), range.end())) - 1;
+}
+
 void TreeModel::setParentsCheckState(const QModelIndex& child, TreeItem::CheckState state)
 {
     QModelIndex parentIndex = this->parent(child);
@@ -243,9 +328,14 @@ void TreeModel::fillPrimVariantSelections(
     }
 }
 
-void TreeModel::openPersistentEditors(QTreeView* tv, const QModelIndex& parent)
+void TreeModel::openPersistentEditors(
+    QTreeView*         tv,
+    const QModelIndex& parent,
+    int                firstRow /*= 0*/,
+    int                lastRow /*= -1*/)
 {
-    for (int r = 0; r < rowCount(parent); ++r) {
+    const int endRow = (lastRow < 0) ? rowCount(parent) : lastRow + 1;
+    for (int r = firstRow; r < endRow; ++r) {
         QModelIndex varSelIndex = this->index(r, kTreeColumn_Variants, parent);
         int         type = varSelIndex.data(ItemDelegate::kTypeRole).toInt();
         if (type == ItemDelegate::kVariants) {
@@ -264,19 +354,53 @@ void TreeModel::openPersistentEditors(QTreeView* tv, const QModelIndex& parent)
 void TreeModel::setRootPrimPath(const std::string& path)
 {
     // Find the prim matching the root prim path from the import data and
-    // check-enable it.
-    SdfPath rootPrimPath(path);
-    auto    fnFindRoot = [rootPrimPath](TreeItem* item) -> bool {
-        if (item->prim().GetPath() == rootPrimPath)
-            return true;
-        return false;
-    };
-    TreeItem* item = findTreeItem(this, QModelIndex(), fnFindRoot);
+    // check-enable it. Its rows and the ones of its ancestors are created if needed.
+    TreeItem* item = fetchItem(SdfPath(path));
     if (item != nullptr) {
         checkEnableItem(item);
     }
 }
 
+void TreeModel::restoreVariantSelections()
+{
+    if (fImportData == nullptr)
+        return;
+
+    // Set the variant selections of the import data on the prims, creating their rows and
+    // the ones of their ancestors if needed, so that they are kept even if the rows of the
+    // prims are never displayed.
+    for (const auto& primVarSel : fImportData->primVariantSelections()) {
+        TreeItem* item = fetchItem(primVarSel.first);
+        if (item == nullptr)
+            continue;
+
+        QModelIndex variantIndex = item->index().sibling(item->row(), kTreeColumn_Variants);
+        if (variantIndex.data(ItemDelegate::kTypeRole).toInt() != ItemDelegate::kVariants)
+            continue;
+        TreeItem* variantItem = static_cast<TreeItem*>(itemFromIndex(variantIndex));
+
+        // Note: the variant set names are returned in reverse order, as in the editor.
+        UsdVariantSets           varSets = item->prim().GetVariantSets();
+        std::vector<std::string> usdVarSetNames;
+        varSets.GetNames(&usdVarSetNames);
+
+        QStringList qtVarNames, qtVarSelections;
+        for (auto it = usdVarSetNames.crbegin(); it != usdVarSetNames.crend(); it++) {
+            auto iter = primVarSel.second.find(*it);
+            qtVarNames.push_back(QString::fromStdString(*it));
+            qtVarSelections.push_back(QString::fromStdString(
+                iter != std::end(primVarSel.second) ? iter->second
+                                                    : varSets.GetVariantSelection(*it)));
+        }
+
+        variantItem->setData(qtVarNames, ItemDelegate::kVariantNameRole);
+        variantItem->setData(qtVarSelections, ItemDelegate::kVariantSelectionRole);
+        variantItem->setVariantSelectionModified();
+    }
+
+    updateModifiedVariantCount();
+}
+
 void TreeModel::uncheckEnableTree()
 {
     // When unchecking any item we uncheck-enable the entire tree.
@@ -310,19 +434,32 @@ void TreeModel::checkEnableItem(TreeItem* item)
 
 void TreeModel::updateCheckedItemCount() const
 {
-    int nbChecked = 0, nbVariantsModified = 0;
-    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified);
+    int                  nbChecked = 0, nbVariantsModified = 0;
+    std::vector<UsdPrim> unfetchedPrims;
+    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified, &unfetchedPrims);
 
     // When the checked items change we will count, and emit signals for, the number of
-    // checked items as well as the number of in-scope modified variants.
-    Q_EMIT checkedStateChanged(nbChecked);
+    // checked items as well as the number of in-scope modified variants. The prims without
+    // rows are not counted here, as a click must not walk the whole stage.
+    Q_EMIT checkedStateChanged(nbChecked, unfetchedPrims.empty());
     Q_EMIT modifiedVariantCountChanged(nbVariantsModified);
 }
 
+int TreeModel::primsInScopeCount() const
+{
+    int                  nbChecked = 0, nbVariantsModified = 0;
+    std::vector<UsdPrim> unfetchedPrims;
+    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified, &unfetchedPrims);
+    for (const UsdPrim& prim : unfetchedPrims)
+        nbChecked += countDescendants(prim);
+    return nbChecked;
+}
+
 void TreeModel::countCheckedItems(
-    const QModelIndex& parent,
-    int&               nbChecked,
-    int&               nbVariantsModified) const
+    const QModelIndex&    parent,
+    int&                  nbChecked,
+    int&                  nbVariantsModified,
+    std::vector<UsdPrim>* unfetchedPrims) const
 {
     for (int r = 0; r < rowCount(parent); ++r) {
         TreeItem* item;
@@ -335,6 +472,11 @@ void TreeModel::countCheckedItems(
             || TreeItem::CheckState::kChecked_Disabled == state) {
             nbChecked++;
 
+            // The descendants without rows yet are in scope too.
+            if (unfetchedPrims && !item->childrenFetched()
+                && !item->prim().GetAllChildren().empty())
+                unfetchedPrims->push_back(item->prim());
+
             // We are only counting modified variants of in-scope prims
             QModelIndex variantChildIndex = this->index(r, kTreeColumn_Variants, parent);
             item = static_cast<TreeItem*>(itemFromIndex(variantChildIndex));
@@ -345,7 +487,7 @@ void TreeModel::countCheckedItems(
         }
 
         if (hasChildren(checkedChildIndex))
-            countCheckedItems(checkedChildIndex, nbChecked, nbVariantsModified);
+            countCheckedItems(checkedChildIndex, nbChecked, nbVariantsModified, unfetchedPrims);
     }
 }
 
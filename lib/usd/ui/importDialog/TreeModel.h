@@ -22,10 +22,13 @@
 #include <mayaUsdUI/ui/TreeItem.h>
 #include <mayaUsdUI/ui/api.h>
 
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/stagePopulationMask.h>
 
 #include <QtGui/QStandardItemModel>
 
+#include <vector>
+
 class QTreeView;
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -59,6 +62,12 @@ public:
     QVariant      data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
     Qt::ItemFlags flags(const QModelIndex& index) const override;
 
+    // The rows of the children of a prim are only created when the view needs them,
+    // so that opening the dialog on a large stage only pays for what is displayed.
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
     /**
      * \brief Order of the columns as they appear in the Tree.
      * \remarks The order of the enumeration is important.
@@ -73,33 +82,51 @@ public:
     };
 
     void setRootPrimPath(const std::string& path);
+    void restoreVariantSelections();
     void getRootPrimPath(std::string&, const QModelIndex& parent);
     void fillStagePopulationMask(UsdStagePopulationMask& popMask, const QModelIndex& parent);
     void fillPrimVariantSelections(
         ImportData::PrimVariantSelections& primVariantSelections,
         const QModelIndex&                 parent);
-    void openPersistentEditors(QTreeView* tv, const QModelIndex& parent);
+    void openPersistentEditors(
+        QTreeView*         tv,
+        const QModelIndex& parent,
+        int                firstRow = 0,
+        int                lastRow = -1);
 
     const ImportData*   importData() const { return fImportData; }
     const IMayaMQtUtil& mayaQtUtil() const { return fMayaQtUtil; }
 
     void onItemClicked(TreeItem* item);
 
+    // Number of prims in scope, including the descendants of the checked prims whose
+    // rows were not created yet, which are counted from the stage.
+    int primsInScopeCount() const;
+
     void resetVariants();
 
 private:
+    TreeItem* loadItem(const QModelIndex& index) const;
+    TreeItem* fetchItem(const SdfPath& path);
+    int       countDescendants(const UsdPrim& prim) const;
+
     void uncheckEnableTree();
     void checkEnableItem(TreeItem* item);
 
     void updateCheckedItemCount() const;
-    void
-    countCheckedItems(const QModelIndex& parent, int& nbChecked, int& nbVariantsModified) const;
+    void countCheckedItems(
+        const QModelIndex&    parent,
+        int&                  nbChecked,
+        int&                  nbVariantsModified,
+        std::vector<UsdPrim>* unfetchedPrims = nullptr) const;
 
     void setParentsCheckState(const QModelIndex& child, TreeItem::CheckState state);
     void setChildCheckState(const QModelIndex& parent, TreeItem::CheckState state);
 
 Q_SIGNALS:
-    void checkedStateChanged(int nbChecked) const;
+    // Only the checked rows are counted: allCounted is false when some prims in scope
+    // have no rows yet.
+    void checkedStateChanged(int nbChecked, bool allCounted) const;
     void modifiedVariantCountChanged(int nbModified) const;
 
 public Q_SLOTS:
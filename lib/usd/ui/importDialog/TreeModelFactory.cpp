@@ -62,9 +62,9 @@ std::unique_ptr<TreeModel> TreeModelFactory::createFromStage(
 )
 {
     std::unique_ptr<TreeModel> treeModel = createEmptyTreeModel(mayaQtUtil, importData, parent);
-    int cnt = buildTreeHierarchy(stage->GetPseudoRoot(), treeModel->invisibleRootItem());
+    treeModel->invisibleRootItem()->appendRow(createPrimRow(stage->GetPseudoRoot()));
     if (nbItems != nullptr)
-        *nbItems = cnt;
+        *nbItems = 1;
     return treeModel;
 }
 
@@ -81,44 +81,4 @@ QList<QStandardItem*> TreeModelFactory::createPrimRow(const UsdPrim& prim)
     return ret;
 }
 
-/*static*/
-int TreeModelFactory::buildTreeHierarchy(const UsdPrim& prim, QStandardItem* parentItem)
-{
-    QList<QStandardItem*> primDataCells = createPrimRow(prim);
-    parentItem->appendRow(primDataCells);
-    int cnt = 1;
-
-    for (const auto& childPrim : prim.GetAllChildren()) {
-        cnt += buildTreeHierarchy(childPrim, primDataCells.front());
-    }
-    return cnt;
-}
-
-/*static*/
-int TreeModelFactory::buildTreeHierarchy(
-    const UsdPrim&               prim,
-    QStandardItem*               parentItem,
-    const unordered_sdfpath_set& primsToIncludeInTree,
-    size_t&                      insertionsRemaining)
-{
-    int  cnt = 0;
-    bool primShouldBeIncluded
-        = primsToIncludeInTree.find(prim.GetPath()) != primsToIncludeInTree.end();
-    if (primShouldBeIncluded) {
-        QList<QStandardItem*> primDataCells = createPrimRow(prim);
-        parentItem->appendRow(primDataCells);
-        ++cnt;
-
-        // Only continue processing additional USD Prims if all expected results have not already
-        // been found:
-        if (--insertionsRemaining > 0) {
-            for (const auto& childPrim : prim.GetAllChildren()) {
-                cnt += buildTreeHierarchy(
-                    childPrim, primDataCells.front(), primsToIncludeInTree, insertionsRemaining);
-            }
-        }
-    }
-    return cnt;
-}
-
 } // namespace MAYAUSD_NS_DEF
@@ -26,7 +26,6 @@
 #include <QtCore/QList>
 
 #include <memory>
-#include <unordered_set>
 
 class QObject;
 class QStandardItem;
@@ -64,6 +63,8 @@ public:
 
     /**
      * \brief Create a TreeModel from the given USD Stage.
+     * \remarks Only the row of the pseudo-root is created, the rows of the other USD Prims are
+     * created by the TreeModel when their parent is expanded.
      * \param stage A reference to the USD Stage from which to create a TreeModel.
      * \param parent A reference to the parent of the TreeModel.
      * \param nbItems Number of items added to the TreeModel.
@@ -76,37 +77,12 @@ public:
         QObject*              parent = nullptr,
         int*                  nbItems = nullptr);
 
-protected:
-    // Type definition for an STL unordered set of SDF Paths:
-    using unordered_sdfpath_set = std::unordered_set<SdfPath, SdfPath::Hash>;
-
     /**
      * \brief Create the list of data cells used to represent the given USD Prim's data in the tree.
      * \param prim The USD Prim for which to create the list of data cells.
      * \return The List of data cells used to represent the given USD Prim's data in the tree.
      */
     static QList<QStandardItem*> createPrimRow(const UsdPrim& prim);
-
-    /**
-     * \brief Build the tree hierarchy starting at the given USD Prim.
-     * \param prim The USD Prim from which to start building the tree hierarchy.
-     * \param parentItem The parent into which to attach the tree hierarchy.
-     * \return The number of items added.
-     */
-    static int buildTreeHierarchy(const UsdPrim& prim, QStandardItem* parentItem);
-    /**
-     * \brief Build the tree hierarchy starting at the given USD Prim.
-     * \param prim The USD Prim from which to start building the tree hierarchy.
-     * \param parentItem The parent into which to attach the tree hierarchy.
-     * \param primsToIncludeInTree The list of USD Prim paths to include when building the tree.
-     * \param insertionsRemaining The number of items yet to be inserted.
-     * \return The number of items added.
-     */
-    static int buildTreeHierarchy(
-        const UsdPrim&               prim,
-        QStandardItem*               parentItem,
-        const unordered_sdfpath_set& primsToIncludeInTree,
-        size_t&                      insertionsRemaining);
 };
 
 } // namespace MAYAUSD_NS_DEF
@@ -65,14 +65,19 @@ USDImportDialog::USDImportDialog(
         = TreeModelFactory::createFromStage(fStage, mayaQtUtil, matchingImportData, this, &nbItems);
     fProxyModel = std::unique_ptr<QSortFilterProxyModel>(new QSortFilterProxyModel(this));
     QObject::connect(
-        fTreeModel.get(), SIGNAL(checkedStateChanged(int)), this, SLOT(onCheckedStateChanged(int)));
+        fTreeModel.get(),
+        SIGNAL(checkedStateChanged(int, bool)),
+        this,
+        SLOT(onCheckedStateChanged(int, bool)));
     QObject::connect(
         fTreeModel.get(),
         SIGNAL(modifiedVariantCountChanged(int)),
         this,
         SLOT(onModifiedVariantsChanged(int)));
 
-    // Set the root prim path in the tree model. This will set the default check states.
+    // Restore the variant selections of the import data, then set the root prim path
+    // in the tree model. This will set the default check states.
+    fTreeModel->restoreVariantSelections();
     fTreeModel->setRootPrimPath(fRootPrimPath);
 
     // Configure the TreeView of the dialog:
@@ -118,6 +123,16 @@ USDImportDialog::USDImportDialog(
     // Must be done AFTER we set our item delegate
     fTreeModel->openPersistentEditors(fUI->treeView, QModelIndex());
 
+    // The rows of the prims are created when their parent is expanded, so they
+    // need their editors too.
+    QObject::connect(
+        fTreeModel.get(),
+        &QAbstractItemModel::rowsInserted,
+        this,
+        [this](const QModelIndex& parent, int first, int last) {
+            fTreeModel->openPersistentEditors(fUI->treeView, parent, first, last);
+        });
+
     // This request to expand the tree to a default depth of 3 should come after the creation
     // of the editors since it can trigger calls to things like sizeHint before we've put any of
     // the variant set UI in place.
@@ -216,10 +231,13 @@ void USDImportDialog::onHierarchyViewHelpTriggered()
     MGlobal::executeCommand("showHelp \"UsdHierarchyView\"");
 }
 
-void USDImportDialog::onCheckedStateChanged(int nbChecked)
+void USDImportDialog::onCheckedStateChanged(int nbChecked, bool allCounted)
 {
+    // The prims without rows yet are only counted when the dialog is accepted.
     QString nbLabel;
     nbLabel.setNum(nbChecked);
+    if (!allCounted)
+        nbLabel += '+';
     fUI->nbPrimsInScopeLabel->setText(nbLabel);
 }
 
@@ -230,7 +248,10 @@ void USDImportDialog::onModifiedVariantsChanged(int nbModified)
     fUI->nbVariantsChangedLabel->setText(nbLabel);
 }
 
-int USDImportDialog::primsInScopeCount() const { return fUI->nbPrimsInScopeLabel->text().toInt(); }
+int USDImportDialog::primsInScopeCount() const
+{
+    return fTreeModel ? fTreeModel->primsInScopeCount() : 0;
+}
 
 int USDImportDialog::switchedVariantCount() const
 {
@@ -79,7 +79,7 @@ private Q_SLOTS:
     void onItemClicked(const QModelIndex&);
     void onResetFileTriggered();
     void onHierarchyViewHelpTriggered();
-    void onCheckedStateChanged(int);
+    void onCheckedStateChanged(int, bool);
     void onModifiedVariantsChanged(int);
 
 protected:
@@ -100,44 +100,111 @@ void LayerTreeItem::populateChildren(RecursionDetector* recursionDetector)
     recursionDetector->push(_layer->GetRealPath());
 
     for (auto const path : subPaths) {
-        std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, path);
-        auto        subLayer = SdfLayer::FindOrOpen(actualPath);
-        if (subLayer) {
-            if (recursionDetector->contains(subLayer->GetRealPath())) {
-                MString msg;
-                msg.format(
-                    StringResources::getAsMString(StringResources::kErrorRecursionDetected),
-                    subLayer->GetRealPath().c_str());
-                puts(msg.asChar());
-            } else {
-                auto item = new LayerTreeItem(
-                    subLayer,
-                    LayerType::SubLayer,
-                    path,
-                    &_incomingLayers,
-                    _isSharedStage,
-                    &_sharedLayers,
-                    recursionDetector);
-                appendRow(item);
-            }
-        } else {
+        auto item = createChildItem(path, findSubLayer(path), recursionDetector);
+        if (item) {
+            appendRow(item);
+        }
+    }
+
+    recursionDetector->pop();
+}
+
+// open the layer of one of our sublayer paths
+SdfLayerRefPtr LayerTreeItem::findSubLayer(const std::string& path) const
+{
+    std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, path);
+    return SdfLayer::FindOrOpen(actualPath);
+}
+
+// create the item of one of our sublayers, or nullptr if it would be recursive
+LayerTreeItem* LayerTreeItem::createChildItem(
+    const std::string&    path,
+    const SdfLayerRefPtr& subLayer,
+    RecursionDetector*    recursionDetector)
+{
+    if (subLayer) {
+        if (recursionDetector->contains(subLayer->GetRealPath())) {
             MString msg;
             msg.format(
-                StringResources::getAsMString(StringResources::kErrorDidNotFind),
-                std::string(path).c_str());
+                StringResources::getAsMString(StringResources::kErrorRecursionDetected),
+                subLayer->GetRealPath().c_str());
             puts(msg.asChar());
-            auto item = new LayerTreeItem(
-                subLayer,
-                LayerType::SubLayer,
-                path,
-                &_incomingLayers,
-                _isSharedStage,
-                &_sharedLayers);
-            appendRow(item);
+            return nullptr;
         }
+        return new LayerTreeItem(
+            subLayer,
+            LayerType::SubLayer,
+            path,
+            &_incomingLayers,
+            _isSharedStage,
+            &_sharedLayers,
+            recursionDetector);
     }
 
-    recursionDetector->pop();
+    MString msg;
+    msg.format(StringResources::getAsMString(StringResources::kErrorDidNotFind), path.c_str());
+    puts(msg.asChar());
+    return new LayerTreeItem(
+        subLayer, LayerType::SubLayer, path, &_incomingLayers, _isSharedStage, &_sharedLayers);
+}
+
+// update the children to match the sublayer paths of our layer. The items of the
+// sublayers that are still there are kept, with their own children, and moved if
+// their sublayer was reordered.
+void LayerTreeItem::updateChildren()
+{
+    if (isInvalidLayer()) {
+        removeRows(0, rowCount());
+        return;
+    }
+
+    // the new items must not repeat any of our ancestors, as when populating
+    RecursionDetector recursionDetector;
+    for (auto item = this; item != nullptr; item = item->parentLayerItem()) {
+        if (!item->isInvalidLayer()) {
+            recursionDetector.push(item->layer()->GetRealPath());
+        }
+    }
+
+    int  row = 0;
+    auto subPaths = _layer->GetSubLayerPaths();
+    for (auto const path : subPaths) {
+        const std::string subLayerPath = path;
+        auto              subLayer = findSubLayer(subLayerPath);
+
+        int found = -1;
+        for (int i = row, count = rowCount(); i < count && found < 0; i++) {
+            auto item = dynamic_cast<LayerTreeItem*>(child(i, 0));
+            if (item->subLayerPath() == subLayerPath && item->layer() == subLayer) {
+                found = i;
+            }
+        }
+
+        if (found > row) {
+            insertRow(row, takeRow(found));
+        } else if (found < 0) {
+            auto item = createChildItem(subLayerPath, subLayer, &recursionDetector);
+            if (!item) {
+                continue;
+            }
+            insertRow(row, item);
+        }
+        row++;
+    }
+
+    if (rowCount() > row) {
+        removeRows(row, rowCount() - row);
+    }
+}
+
+bool LayerTreeItem::invalidChildrenFound() const
+{
+    for (auto child : childrenVector()) {
+        if (child->isInvalidLayer() && findSubLayer(child->subLayerPath())) {
+            return true;
+        }
+    }
+    return false;
 }
 
 LayerItemVector LayerTreeItem::childrenVector() const
@@ -165,6 +232,15 @@ void LayerTreeItem::updateTargetLayerRecursive(const PXR_NS::SdfLayerRefPtr& new
     }
 }
 
+// refresh our display and the one of our descendants, for example after muting
+void LayerTreeItem::emitDataChangedRecursive()
+{
+    emitDataChanged();
+    for (auto child : childrenVector()) {
+        child->emitDataChangedRecursive();
+    }
+}
+
 void LayerTreeItem::fetchData(RebuildChildren in_rebuild, RecursionDetector* in_recursionDetector)
 {
     std::string name;
@@ -19,6 +19,8 @@
 
 #include "pxr/usd/sdf/layer.h"
 
+#include <mayaUsdUI/ui/api.h>
+
 #include <pxr/usd/sdf/declareHandles.h>
 #include <pxr/usd/usd/stage.h>
 
@@ -64,7 +66,7 @@ typedef std::vector<LayerTreeItem*> LayerItemVector;
  *
  */
 
-class LayerTreeItem : public QStandardItem
+class MAYAUSD_UI_PUBLIC LayerTreeItem : public QStandardItem
 {
 public:
     LayerTreeItem(
@@ -83,6 +85,13 @@ public:
     int      type() const override;
     QVariant data(int role) const override;
     void     emitDataChanged() { QStandardItem::emitDataChanged(); }
+    // emitDataChanged() for this item and all its descendants
+    void emitDataChangedRecursive();
+    // add, remove and move the children to match the current sublayers of the layer
+    void updateChildren();
+    // check if the path of one of our invalid children now loads, for example
+    // after the missing layer was created
+    bool invalidChildrenFound() const;
 
     // parent(), properly typed
     LayerTreeItem* parentLayerItem() const { return dynamic_cast<LayerTreeItem*>(parent()); }
@@ -171,6 +180,12 @@ protected:
 
 protected:
     void populateChildren(RecursionDetector* in_recursionDetector);
+    // helpers to create the item of a sublayer path
+    PXR_NS::SdfLayerRefPtr findSubLayer(const std::string& path) const;
+    LayerTreeItem*         createChildItem(
+                const std::string&            path,
+                const PXR_NS::SdfLayerRefPtr& subLayer,
+                RecursionDetector*            in_recursionDetector);
     // helper to save anon layers called by saveEdits()
     void saveAnonymousLayer();
 
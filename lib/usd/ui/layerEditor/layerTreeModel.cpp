@@ -28,6 +28,8 @@
 #include <mayaUsd/utils/utilSerialization.h>
 
 #include <pxr/base/tf/notice.h>
+#include <pxr/usd/sdf/changeList.h>
+#include <pxr/usd/sdf/schema.h>
 
 #include <maya/MGlobal.h>
 #include <maya/MQtUtil.h>
@@ -35,6 +37,7 @@
 #include <QtCore/QTimer>
 
 #include <algorithm>
+#include <set>
 #include <string>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -45,6 +48,16 @@ namespace {
 const QString LAYER_EDITOR_MIME_TYPE = QStringLiteral("text/plain");
 const QString LAYED_EDITOR_MIME_SEP = QStringLiteral(";");
 
+// What changed in a layer, accumulated from the USD notifications until the
+// items are updated on idle.
+enum LayerChange
+{
+    kLayerDataChanged = 1 << 0,      // name or dirty state
+    kSubLayersChanged = 1 << 1,      // sublayer paths, content replaced
+    kLayerMutingChanged = 1 << 2,    // muted or unmuted at the stage level
+    kCustomLayerDataChanged = 1 << 3 // can change the shared layers
+};
+
 } // namespace
 
 namespace UsdLayerEditor {
@@ -76,6 +89,7 @@ void LayerTreeModel::registerUsdNotifications(bool in_register)
         TfWeakPtr<LayerTreeModel> me(this);
         _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_layerChanged));
         _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_editTargetChanged));
+        _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_layerMutingChanged));
         _noticeKeys.push_back(TfNotice::Register(
             me, &LayerTreeModel::usd_layerDirtinessChanged, TfWeakPtr<SdfLayer>(nullptr)));
 
@@ -291,6 +305,7 @@ void LayerTreeModel::rebuildModelOnIdle()
 void LayerTreeModel::rebuildModel()
 {
     _rebuildOnIdlePending = false;
+    _pendingLayerChanges.clear();
     _lastAskedAnonLayerNameSinceRebuild = 0;
 
     beginResetModel();
@@ -357,6 +372,104 @@ LayerTreeItem* LayerTreeModel::findUSDLayerItem(const SdfLayerRefPtr& usdLayer)
     return nullptr;
 }
 
+// a layer can appear more than once, when it is a sublayer of several layers
+LayerItemVector LayerTreeModel::findUSDLayerItems(const SdfLayerHandle& usdLayer) const
+{
+    LayerItemVector result;
+    const auto      allItems = getAllItems();
+    for (auto item : allItems) {
+        if (get_pointer(item->layer()) == get_pointer(usdLayer))
+            result.push_back(item);
+    }
+    return result;
+}
+
+void LayerTreeModel::updateLayersOnIdle()
+{
+    if (!_updateOnIdlePending) {
+        _updateOnIdlePending = true;
+        QTimer::singleShot(0, this, &LayerTreeModel::updateLayers);
+    }
+}
+
+// apply the pending changes of the layers to their items, inserting, removing
+// and moving only the children of the layers whose sublayers changed.
+void LayerTreeModel::updateLayers()
+{
+    _updateOnIdlePending = false;
+    const auto pendingLayerChanges = std::move(_pendingLayerChanges);
+    _pendingLayerChanges.clear();
+
+    // a pending rebuild will take care of everything
+    if (_rebuildOnIdlePending || !_sessionState->isValid() || rowCount() == 0) {
+        return;
+    }
+
+    // the shared layers are listed in the custom data of the root layer
+    auto                 stage = _sessionState->stage();
+    const SdfLayerHandle rootLayer = stage->GetRootLayer();
+    auto                 rootLayerChange = pendingLayerChanges.find(rootLayer);
+    if (rootLayerChange != pendingLayerChanges.end()
+        && (rootLayerChange->second & kCustomLayerDataChanged)) {
+        rebuildModel();
+        return;
+    }
+
+    // the session layer may need to be shown or hidden
+    if (_sessionState->autoHideSessionLayer()) {
+        auto sessionLayer = stage->GetSessionLayer();
+        if (pendingLayerChanges.count(SdfLayerHandle(sessionLayer)) > 0) {
+            auto firstLayerItem = dynamic_cast<LayerTreeItem*>(invisibleRootItem()->child(0));
+            bool shown = firstLayerItem->isSessionLayer();
+            bool showSessionLayer
+                = sessionLayer->IsDirty() || sessionLayer == _sessionState->targetLayer();
+            if (shown != showSessionLayer) {
+                rebuildModel();
+                return;
+            }
+        }
+    }
+
+    bool subLayersChanged = false;
+    for (const auto& layerChange : pendingLayerChanges) {
+        if (!layerChange.first) {
+            continue;
+        }
+        // look the items up for each layer, as updating the children of the
+        // previous ones can have deleted some
+        for (auto item : findUSDLayerItems(layerChange.first)) {
+            if (layerChange.second & kSubLayersChanged) {
+                item->updateChildren();
+                subLayersChanged = true;
+            }
+            if (layerChange.second & kLayerMutingChanged) {
+                item->emitDataChangedRecursive();
+            }
+            item->fetchData(RebuildChildren::No);
+        }
+    }
+
+    // a missing sublayer may have been created since: update the children of the
+    // items that have an invalid child whose path now loads
+    auto filter = [](const LayerTreeItem* item) { return item->invalidChildrenFound(); };
+
+    std::set<SdfLayerHandle> parentsToUpdate;
+    for (auto item : getAllItems(filter)) {
+        parentsToUpdate.insert(item->layer());
+    }
+    for (const auto& parentLayer : parentsToUpdate) {
+        for (auto item : findUSDLayerItems(parentLayer)) {
+            item->updateChildren();
+            subLayersChanged = true;
+        }
+    }
+
+    // the new items need to know if they are the target
+    if (subLayersChanged) {
+        updateTargetLayer(InRebuildModel::Yes);
+    }
+}
+
 void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
 {
     if (rowCount() == 0) {
@@ -394,9 +507,50 @@ void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
 // notification from USD
 void LayerTreeModel::usd_layerChanged(SdfNotice::LayersDidChangeSentPerLayer const& notice)
 {
-    // experienced crashes in python prototype  For now, rebuild everything
-    if (!_blockUsdNotices)
-        rebuildModelOnIdle();
+    if (_blockUsdNotices)
+        return;
+
+    // Only the changes of the layer itself, on the absolute root path, can
+    // change the tree: the changes of the prims only refresh the items.
+    for (const auto& layerChangeList : notice.GetChangeListVec()) {
+        int changes = kLayerDataChanged;
+        for (const auto& entry : layerChangeList.second.GetEntryList()) {
+            if (!entry.first.IsAbsoluteRootPath()) {
+                continue;
+            }
+            const SdfChangeList::Entry& layerEntry = entry.second;
+            if (layerEntry.flags.didReplaceContent || layerEntry.flags.didReloadContent
+                || layerEntry.flags.didChangeIdentifier || layerEntry.flags.didChangeResolvedPath
+                || layerEntry.HasInfoChange(SdfFieldKeys->SubLayers)
+                || layerEntry.HasInfoChange(SdfFieldKeys->SubLayerOffsets)) {
+                changes |= kSubLayersChanged;
+            }
+            if (layerEntry.HasInfoChange(SdfFieldKeys->CustomLayerData)) {
+                changes |= kCustomLayerDataChanged;
+            }
+        }
+        _pendingLayerChanges[layerChangeList.first] |= changes;
+    }
+    updateLayersOnIdle();
+}
+
+// notification from USD
+void LayerTreeModel::usd_layerMutingChanged(UsdNotice::LayerMutingChanged const& notice)
+{
+    if (_blockUsdNotices || !_sessionState->isValid()
+        || get_pointer(notice.GetStage()) != get_pointer(_sessionState->stage())) {
+        return;
+    }
+
+    // the muted layers and their descendants are drawn differently
+    for (const auto& layers : { notice.GetMutedLayers(), notice.GetUnmutedLayers() }) {
+        for (const auto& identifier : layers) {
+            if (auto layer = SdfLayer::Find(identifier)) {
+                _pendingLayerChanges[layer] |= kLayerMutingChanged;
+            }
+        }
+    }
+    updateLayersOnIdle();
 }
 
 // notification from USD
@@ -19,6 +19,8 @@
 
 #include "sessionState.h"
 
+#include <mayaUsdUI/ui/api.h>
+
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/sdf/declareHandles.h>
 #include <pxr/usd/sdf/notice.h>
@@ -26,6 +28,7 @@
 
 #include <QtGui/QStandardItemModel>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -46,7 +49,7 @@ enum class InRebuildModel
  * @brief Implements the Qt data model for the usd layer tree view
  *
  */
-class LayerTreeModel
+class MAYAUSD_UI_PUBLIC LayerTreeModel
     : public QStandardItemModel
     , public PXR_NS::TfWeakBase
 {
@@ -124,6 +127,7 @@ protected:
     void registerUsdNotifications(bool in_register);
     void usd_layerChanged(PXR_NS::SdfNotice::LayersDidChangeSentPerLayer const& notice);
     void usd_editTargetChanged(PXR_NS::UsdNotice::StageEditTargetChanged const& notice);
+    void usd_layerMutingChanged(PXR_NS::UsdNotice::LayerMutingChanged const& notice);
     void usd_layerDirtinessChanged(
         PXR_NS::SdfNotice::LayerDirtinessChanged const& notice,
         const PXR_NS::TfWeakPtr<PXR_NS::SdfLayer>&      layer);
@@ -138,9 +142,16 @@ protected:
     bool _rebuildOnIdlePending = false;
     void rebuildModel();
 
+    // changes of the layers reported by USD, applied to their items on idle
+    std::map<PXR_NS::SdfLayerHandle, int> _pendingLayerChanges;
+    void                                  updateLayersOnIdle();
+    bool                                  _updateOnIdlePending = false;
+    void                                  updateLayers();
+
     void updateTargetLayer(InRebuildModel inRebuild);
 
-    LayerTreeItem* findUSDLayerItem(const PXR_NS::SdfLayerRefPtr& usdLayer) const;
+    LayerTreeItem*  findUSDLayerItem(const PXR_NS::SdfLayerRefPtr& usdLayer) const;
+    LayerItemVector findUSDLayerItems(const PXR_NS::SdfLayerHandle& usdLayer) const;
 };
 
 } // namespace UsdLayerEditor
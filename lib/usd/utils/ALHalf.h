@@ -37,7 +37,10 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MayaUsdUtils {
 
+// Separate inline namespaces for the hardware and software conversions, so that translation units
+// built with and without F16C never share an inline definition.
 #ifdef __F16C__
+inline namespace half_f16c {
 
 /// converts 8xhalf to 8xfloat
 inline void half2float_8f(const GfHalf input[8], float out[8])
@@ -141,7 +144,9 @@ inline GfHalf double2half_1f(const double f)
     return *(const GfHalf*)(&i);
 }
 
+} // namespace half_f16c
 #else
+inline namespace half_soft {
 /// converts 8xhalf to 8xfloat
 inline void half2float_8f(const GfHalf input[8], float out[8])
 {
@@ -241,6 +246,7 @@ inline void double2half_4f(const double input[4], GfHalf out[4])
 
 /// converts a double to a half
 inline GfHalf double2half_1f(const double f) { return GfHalf(float(f)); }
+} // namespace half_soft
 #endif
 
 } // namespace MayaUsdUtils
@@ -25,7 +25,28 @@
 
 #include <stdint.h>
 
-#ifdef __AVX2__
+// The AVX2 kernels are built with a target pragma rather than with -mavx2 (see
+// SIMDKernelsAVX2.cpp), which does not define __AVX2__ and friends on every compiler. They define
+// MAYAUSDUTILS_SIMD_TARGET_AVX2 instead, which enables the AVX, AVX2 and F16C helpers below.
+#if defined(__AVX2__) || defined(MAYAUSDUTILS_SIMD_TARGET_AVX2)
+#define MAYAUSDUTILS_SIMD_HAS_AVX2 1
+#else
+#define MAYAUSDUTILS_SIMD_HAS_AVX2 0
+#endif
+
+#if defined(__AVX__) || MAYAUSDUTILS_SIMD_HAS_AVX2
+#define MAYAUSDUTILS_SIMD_HAS_AVX 1
+#else
+#define MAYAUSDUTILS_SIMD_HAS_AVX 0
+#endif
+
+#if defined(__F16C__) || defined(MAYAUSDUTILS_SIMD_TARGET_AVX2)
+#define MAYAUSDUTILS_SIMD_HAS_F16C 1
+#else
+#define MAYAUSDUTILS_SIMD_HAS_F16C 0
+#endif
+
+#if MAYAUSDUTILS_SIMD_HAS_AVX2
 #include <immintrin.h>
 #endif
 
@@ -59,7 +80,20 @@
 #define ENABLE_SOME_AVX_ROUTINES 1
 #endif
 
+// The helpers below are compiled differently depending on the instruction set enabled for the
+// translation unit (see SIMDKernels.h, which builds the kernels once per instruction set). Each
+// instruction set gets its own inline namespace so that the linker never mixes up, say, an AVX2
+// build of an inline helper with the SSE one.
+#if MAYAUSDUTILS_SIMD_HAS_AVX2
+#define MAYAUSDUTILS_SIMD_ABI_NAMESPACE simd_avx2
+#elif defined(__SSE__)
+#define MAYAUSDUTILS_SIMD_ABI_NAMESPACE simd_sse
+#else
+#define MAYAUSDUTILS_SIMD_ABI_NAMESPACE simd_none
+#endif
+
 namespace MayaUsdUtils {
+inline namespace MAYAUSDUTILS_SIMD_ABI_NAMESPACE {
 
 #if defined(__SSE__)
 typedef __m128  f128;
@@ -225,8 +259,8 @@ AL_DLL_HIDDEN inline i128 splat2i64(const int64_t f) { return _mm_set1_epi64x(f)
 AL_DLL_HIDDEN inline f128 unpacklo4f(const f128 a, const f128 b) { return _mm_unpacklo_ps(a, b); }
 AL_DLL_HIDDEN inline f128 unpackhi4f(const f128 a, const f128 b) { return _mm_unpackhi_ps(a, b); }
 
-#if !defined(__SSE4__) && !defined(__SSE4_1__) && !defined(__SSE4_2__) && !defined(__AVX__) \
-    && !defined(__AVX2__)
+#if !defined(__SSE4__) && !defined(__SSE4_1__) && !defined(__SSE4_2__) \
+    && !MAYAUSDUTILS_SIMD_HAS_AVX
 AL_DLL_HIDDEN inline __m128 _mm_blendv_ps(__m128 a, __m128 b, __m128 c)
 {
     return _mm_or_ps(_mm_and_ps(c, b), _mm_andnot_ps(c, a));
@@ -258,7 +292,7 @@ inline d128 abs2d(const d128 v) { return _mm_andnot_pd(splat2d(-0.0), v); }
 
 #endif
 
-#if defined(__AVX2__)
+#if MAYAUSDUTILS_SIMD_HAS_AVX2
 typedef __m256  f256;
 typedef __m256i i256;
 typedef __m256d d256;
@@ -518,8 +552,8 @@ inline i256 loadmask3i64(const void* const ptr, const size_t count)
 }
 #endif
 
-#ifdef __F16C__
-#ifdef __AVX__
+#if MAYAUSDUTILS_SIMD_HAS_F16C
+#if MAYAUSDUTILS_SIMD_HAS_AVX
 inline f256 cvtph8(const i128 a) { return _mm256_cvtph_ps(a); }
 inline i128 cvtph8(const f256 a) { return _mm256_cvtps_ph(a, _MM_FROUND_CUR_DIRECTION); }
 #else
@@ -528,7 +562,7 @@ inline i128               cvtph4(const f128 a) { return _mm_cvtps_ph(a, _MM_FROU
 #endif
 #endif
 
-#ifdef __AVX__
+#if MAYAUSDUTILS_SIMD_HAS_AVX
 /// \brief  loads up to 3 floating point values from ptr, and sets the other elements to zero.
 inline f128 loadmask3f(const void* const ptr, const size_t count)
 {
@@ -557,4 +591,5 @@ inline f128 loadmask3f(const void* const ptr, size_t count)
 }
 #endif
 
+} // namespace MAYAUSDUTILS_SIMD_ABI_NAMESPACE
 } // namespace MayaUsdUtils
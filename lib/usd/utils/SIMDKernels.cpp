@@ -0,0 +1,209 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "SIMDKernels.h"
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+
+#include <atomic>
+#include <string>
+
+#if MAYAUSDUTILS_SIMD_X86_KERNELS
+#include <cpuid.h>
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_SIMD_ISA,
+    "",
+    "Forces the instruction set used by the mayaUsdUtils array kernels: scalar, sse or avx2. "
+    "By default the fastest one supported by the CPU is used.");
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace MayaUsdUtils {
+
+// Defined by SIMDKernels.inl, in each of the SIMDKernels<ISA>.cpp files.
+namespace simd_scalar_kernels {
+const SimdKernels& kernels();
+}
+#if MAYAUSDUTILS_SIMD_X86_KERNELS
+namespace simd_sse_kernels {
+const SimdKernels& kernels();
+}
+namespace simd_avx2_kernels {
+const SimdKernels& kernels();
+}
+#endif
+
+namespace {
+
+const SimdIsa allIsas[] = { SimdIsa::kScalar, SimdIsa::kSSE, SimdIsa::kAVX2 };
+
+#if MAYAUSDUTILS_SIMD_X86_KERNELS
+bool cpuSupportsSSE42()
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2);
+}
+
+bool cpuSupportsAVX2()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const unsigned int leaf1Bits = bit_OSXSAVE | bit_AVX | bit_FMA | bit_F16C;
+    if ((ecx & leaf1Bits) != leaf1Bits) {
+        return false;
+    }
+
+    // The OS must also save the YMM registers on context switches.
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if ((xcr0Low & 0x6) != 0x6) {
+        return false;
+    }
+
+    if (__get_cpuid_max(0, nullptr) < 7) {
+        return false;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & bit_AVX2) != 0;
+}
+#endif
+
+const SimdKernels* availableKernels(SimdIsa isa)
+{
+    switch (isa) {
+    case SimdIsa::kScalar: return &simd_scalar_kernels::kernels();
+#if MAYAUSDUTILS_SIMD_X86_KERNELS
+    case SimdIsa::kSSE: {
+        static const bool supported = cpuSupportsSSE42();
+        return supported ? &simd_sse_kernels::kernels() : nullptr;
+    }
+    case SimdIsa::kAVX2: {
+        static const bool supported = cpuSupportsAVX2();
+        return supported ? &simd_avx2_kernels::kernels() : nullptr;
+    }
+#endif
+    default: return nullptr;
+    }
+}
+
+SimdIsa initialSimdIsa()
+{
+    const SimdIsa     best = bestSimdIsa();
+    const std::string requested = TfGetEnvSetting(MAYAUSD_SIMD_ISA);
+    if (requested.empty()) {
+        return best;
+    }
+
+    for (SimdIsa isa : allIsas) {
+        if (requested == simdIsaName(isa)) {
+            if (availableKernels(isa)) {
+                return isa;
+            }
+            TF_WARN(
+                "MAYAUSD_SIMD_ISA requests '%s', which is not available on this machine. Using "
+                "'%s' instead.",
+                requested.c_str(),
+                simdIsaName(best));
+            return best;
+        }
+    }
+
+    TF_WARN(
+        "Unknown MAYAUSD_SIMD_ISA value '%s', expected scalar, sse or avx2. Using '%s' instead.",
+        requested.c_str(),
+        simdIsaName(best));
+    return best;
+}
+
+struct ActiveKernels
+{
+    std::atomic<SimdIsa>            isa;
+    std::atomic<const SimdKernels*> kernels;
+
+    ActiveKernels()
+        : isa(initialSimdIsa())
+        , kernels(availableKernels(isa.load()))
+    {
+    }
+};
+
+ActiveKernels& activeKernels()
+{
+    static ActiveKernels active;
+    return active;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+const char* simdIsaName(SimdIsa isa)
+{
+    switch (isa) {
+    case SimdIsa::kScalar: return "scalar";
+    case SimdIsa::kSSE: return "sse";
+    case SimdIsa::kAVX2: return "avx2";
+    }
+    return "unknown";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SimdIsa bestSimdIsa()
+{
+    static const SimdIsa best = []() {
+        for (SimdIsa isa : { SimdIsa::kAVX2, SimdIsa::kSSE }) {
+            if (availableKernels(isa)) {
+                return isa;
+            }
+        }
+        return SimdIsa::kScalar;
+    }();
+    return best;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SimdIsa activeSimdIsa() { return activeKernels().isa.load(std::memory_order_relaxed); }
+
+//----------------------------------------------------------------------------------------------------------------------
+bool setActiveSimdIsa(SimdIsa isa)
+{
+    const SimdKernels* kernels = availableKernels(isa);
+    if (!kernels) {
+        return false;
+    }
+    ActiveKernels& active = activeKernels();
+    active.kernels.store(kernels, std::memory_order_relaxed);
+    active.isa.store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+const SimdKernels* simdKernels(SimdIsa isa) { return availableKernels(isa); }
+
+//----------------------------------------------------------------------------------------------------------------------
+const SimdKernels& simdKernels()
+{
+    return *activeKernels().kernels.load(std::memory_order_relaxed);
+}
+
+} // namespace MayaUsdUtils
@@ -0,0 +1,244 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <mayaUsdUtils/ALHalf.h>
+#include <mayaUsdUtils/Api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MayaUsdUtils {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  The instruction sets the array kernels are built for, from the slowest to the fastest.
+///
+///         The kernels are compiled once per instruction set, and the fastest set supported by the
+///         CPU is picked the first time a kernel is called. Setting the MAYAUSD_SIMD_ISA
+///         environment variable to "scalar", "sse" or "avx2" forces a slower set, e.g. to compare
+///         results or timings.
+//----------------------------------------------------------------------------------------------------------------------
+enum class SimdIsa
+{
+    kScalar,
+    kSSE,
+    kAVX2
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  The table of array kernels built for one instruction set.
+//----------------------------------------------------------------------------------------------------------------------
+struct SimdKernels
+{
+    // DiffCore.h
+    bool (*vec2AreAllTheSameUV)(const float* u, const float* v, size_t count);
+    bool (*vec2fAreAllTheSame)(const float* array, size_t count);
+    bool (*vec3fAreAllTheSame)(const float* array, size_t count);
+    bool (*vec4fAreAllTheSame)(const float* array, size_t count);
+    bool (*vec2dAreAllTheSame)(const double* array, size_t count);
+    bool (*vec3dAreAllTheSame)(const double* array, size_t count);
+    bool (*vec4dAreAllTheSame)(const double* array, size_t count);
+    bool (*compareHalfFloatArray)(
+        const GfHalf* input0,
+        const float*  input1,
+        size_t        count0,
+        size_t        count1,
+        float         eps);
+    bool (*compareHalfDoubleArray)(
+        const GfHalf* input0,
+        const double* input1,
+        size_t        count0,
+        size_t        count1,
+        double        eps);
+    bool (*compareDoubleArray)(
+        const double* input0,
+        const double* input1,
+        size_t        count0,
+        size_t        count1,
+        double        eps);
+    bool (*compareFloatArray)(
+        const float* input0,
+        const float* input1,
+        size_t       count0,
+        size_t       count1,
+        float        eps);
+    bool (*compareInt8Array)(
+        const int8_t* input0,
+        const int8_t* input1,
+        size_t        count0,
+        size_t        count1);
+    bool (*compareInt32Array)(
+        const int32_t* input0,
+        const int32_t* input1,
+        size_t         count0,
+        size_t         count1);
+    bool (*compareUvArray)(
+        const float* u0,
+        const float* v0,
+        const float* uv1,
+        size_t       count0,
+        size_t       count1,
+        float        eps);
+    bool (*compareUvArrayToValue)(
+        float        u0,
+        float        v0,
+        const float* u1,
+        const float* v1,
+        size_t       count,
+        float        eps);
+    bool (*compareArray3Dto4Dd)(
+        const float*  input3d,
+        const double* input4d,
+        size_t        count3d,
+        size_t        count4d,
+        float         eps);
+    bool (*compareRGBAArray)(
+        float        r,
+        float        g,
+        float        b,
+        float        a,
+        const float* rgba,
+        size_t       count,
+        float        eps);
+
+    // Mesh data conversions
+    void (*floatToDouble)(double* output, const float* input, size_t count);
+    void (*doubleToFloat)(float* output, const double* input, size_t count);
+    void (*zipUVs)(const float* u, const float* v, float* uv, size_t count);
+    void (*unzipUVs)(const float* uv, float* u, float* v, size_t count);
+    void (*interleaveIndexedUvData)(
+        float*         output,
+        const float*   u,
+        const float*   v,
+        const int32_t* indices,
+        uint32_t       numIndices);
+
+    // SmoothNormals.h
+    void (*cornerNormals)(
+        float*         x,
+        float*         y,
+        float*         z,
+        const float*   points,
+        const int32_t* centers,
+        const int32_t* prevs,
+        const int32_t* nexts,
+        size_t         count);
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the name of an instruction set ("scalar", "sse" or "avx2")
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+const char* simdIsaName(SimdIsa isa);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the fastest instruction set that is both built into this library and supported
+///         by the CPU, ignoring the MAYAUSD_SIMD_ISA override.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+SimdIsa bestSimdIsa();
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the instruction set currently used by the kernels.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+SimdIsa activeSimdIsa();
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  makes the kernels use the given instruction set.
+/// \return false (leaving the active set unchanged) if the set is not available on this machine
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool setActiveSimdIsa(SimdIsa isa);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the kernels built for the given instruction set, or nullptr if the set is not
+///         available on this machine.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+const SimdKernels* simdKernels(SimdIsa isa);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the kernels for the active instruction set.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+const SimdKernels& simdKernels();
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of floats to doubles
+/// \param  output the double precision output
+/// \param  input the single precision input
+/// \param  count the number of elements in both arrays
+//----------------------------------------------------------------------------------------------------------------------
+inline void floatToDouble(double* output, const float* input, size_t count)
+{
+    simdKernels().floatToDouble(output, input, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of doubles to floats
+/// \param  output the single precision output
+/// \param  input the double precision input
+/// \param  count the number of elements in both arrays
+//----------------------------------------------------------------------------------------------------------------------
+inline void doubleToFloat(float* output, const double* input, size_t count)
+{
+    simdKernels().doubleToFloat(output, input, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  interleaves separate arrays of U and V values into an array of packed UV values
+/// \param  u the input U values
+/// \param  v the input V values
+/// \param  uv the output UV values, holding (count * 2) floats
+/// \param  count the number of U and V values
+//----------------------------------------------------------------------------------------------------------------------
+inline void zipUVs(const float* u, const float* v, float* uv, size_t count)
+{
+    simdKernels().zipUVs(u, v, uv, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  separates an array of packed UV values into arrays of U and V values
+/// \param  uv the input UV values, holding (count * 2) floats
+/// \param  u the output U values
+/// \param  v the output V values
+/// \param  count the number of U and V values
+//----------------------------------------------------------------------------------------------------------------------
+inline void unzipUVs(const float* uv, float* u, float* v, size_t count)
+{
+    simdKernels().unzipUVs(uv, u, v, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  gathers the U and V values referenced by a set of indices into an array of packed UVs
+/// \param  output the output UV values, holding (numIndices * 2) floats
+/// \param  u the input U values
+/// \param  v the input V values
+/// \param  indices the indices into the U and V arrays
+/// \param  numIndices the number of indices
+//----------------------------------------------------------------------------------------------------------------------
+inline void interleaveIndexedUvData(
+    float*         output,
+    const float*   u,
+    const float*   v,
+    const int32_t* indices,
+    uint32_t       numIndices)
+{
+    simdKernels().interleaveIndexedUvData(output, u, v, indices, numIndices);
+}
+
+} // namespace MayaUsdUtils
@@ -0,0 +1,56 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Built for AVX2, FMA and F16C with a target pragma rather than with a translation unit wide
+// -mavx2: that flag would also build the weak copies of the inline functions this file uses from
+// other headers (GfHalf conversions, std::abs, std::min...) with AVX instructions, and the linker
+// may keep these copies for the whole library, which would then crash on older CPUs. These headers
+// are all included first, with the baseline flags, and only the kernels come after the pragma. Only
+// part of the build on x86-64 with GCC or Clang.
+#if !defined(__GNUC__)
+#error "SIMDKernelsAVX2.cpp must be built with GCC or Clang"
+#endif
+
+#include <mayaUsdUtils/SIMDKernels.h>
+
+#include <pxr/base/gf/half.h>
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma,f16c"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c")
+#endif
+
+#define MAYAUSDUTILS_SIMD_TARGET_AVX2 1
+#define MAYAUSDUTILS_SIMD_NAMESPACE   simd_avx2_kernels
+#define MAYAUSDUTILS_SIMD_SSE         1
+#define MAYAUSDUTILS_SIMD_AVX2        1
+
+#include "SIMDKernels.inl"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,26 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Built with the baseline compiler flags (see compiler_config.cmake). Only part of the build on
+// x86-64 with GCC or Clang.
+#if !defined(__SSE4_2__)
+#error "SIMDKernelsSSE.cpp must be built with SSE 4.2 enabled"
+#endif
+
+#define MAYAUSDUTILS_SIMD_NAMESPACE simd_sse_kernels
+#define MAYAUSDUTILS_SIMD_SSE       1
+#define MAYAUSDUTILS_SIMD_AVX2      0
+
+#include "SIMDKernels.inl"
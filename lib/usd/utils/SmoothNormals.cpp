@@ -0,0 +1,183 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "SmoothNormals.h"
+
+#include <mayaUsdUtils/SIMDKernels.h>
+
+#include <pxr/base/work/loops.h>
+
+#include <algorithm>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace MayaUsdUtils {
+
+namespace {
+
+// Below this number of points the normals are computed on the calling thread, as scheduling the
+// tasks would cost more than the computation.
+constexpr size_t parallelThreshold = 8192;
+
+// The number of points handled by each task.
+constexpr size_t grainSize = 4096;
+
+template <typename Fn> void forEachPointRange(size_t numPoints, Fn&& fn)
+{
+    if (numPoints < parallelThreshold) {
+        fn(size_t(0), numPoints);
+    } else {
+        WorkParallelForN(numPoints, std::forward<Fn>(fn), grainSize);
+    }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+SmoothNormals::SmoothNormals(
+    const int* faceVertexCounts,
+    size_t     numFaces,
+    const int* faceVertexIndices,
+    size_t     numFaceVertexIndices,
+    bool       leftHanded)
+{
+    // count the corners around each point
+    std::vector<int32_t> valences;
+    size_t               faceStart = 0;
+    for (size_t face = 0; face < numFaces; ++face) {
+        const int numVertices = faceVertexCounts[face];
+        if (numVertices < 0 || faceStart + size_t(numVertices) > numFaceVertexIndices) {
+            _valid = false;
+            return;
+        }
+        for (int i = 0; i < numVertices; ++i) {
+            const int index = faceVertexIndices[faceStart + i];
+            if (index < 0) {
+                _valid = false;
+                return;
+            }
+            if (size_t(index) >= valences.size()) {
+                valences.resize(size_t(index) + 1, 0);
+            }
+            ++valences[index];
+        }
+        faceStart += numVertices;
+    }
+
+    _numPoints = valences.size();
+    _offsets.resize(_numPoints + 1);
+    _offsets[0] = 0;
+    for (size_t point = 0; point < _numPoints; ++point) {
+        _offsets[point + 1] = _offsets[point] + valences[point];
+    }
+
+    // store the corners in point order, keeping the face order around each point, so that the
+    // normals are summed in the same order as Hd_SmoothNormals
+    const size_t numCorners = size_t(_offsets[_numPoints]);
+    _centers.resize(numCorners);
+    _prevs.resize(numCorners);
+    _nexts.resize(numCorners);
+    std::vector<int32_t> cursors(_offsets.begin(), _offsets.end() - 1);
+
+    faceStart = 0;
+    for (size_t face = 0; face < numFaces; ++face) {
+        const int  numVertices = faceVertexCounts[face];
+        const int* vertices = faceVertexIndices + faceStart;
+        for (int i = 0; i < numVertices; ++i) {
+            int prev = vertices[(i + numVertices - 1) % numVertices];
+            int next = vertices[(i + 1) % numVertices];
+            if (leftHanded) {
+                std::swap(prev, next);
+            }
+            const int32_t corner = cursors[vertices[i]]++;
+            _centers[corner] = vertices[i];
+            _prevs[corner] = prev;
+            _nexts[corner] = next;
+        }
+        faceStart += numVertices;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SmoothNormals::compute(GfVec3f* normals, const GfVec3f* points, size_t numPoints) const
+{
+    std::fill(normals, normals + numPoints, GfVec3f(0.0f));
+    if (!_valid || numPoints < _numPoints) {
+        return false;
+    }
+    if (_numPoints == 0) {
+        return true;
+    }
+
+    const SimdKernels& kernels = simdKernels();
+    forEachPointRange(_numPoints, [&](size_t begin, size_t end) {
+        const size_t firstCorner = size_t(_offsets[begin]);
+        const size_t count = size_t(_offsets[end]) - firstCorner;
+
+        // the cross products of the corners of the range, in SOA layout
+        thread_local std::vector<float> crossProducts;
+        crossProducts.resize(count * 3);
+        float* const x = crossProducts.data();
+        float* const y = x + count;
+        float* const z = y + count;
+        kernels.cornerNormals(
+            x,
+            y,
+            z,
+            points->data(),
+            _centers.data() + firstCorner,
+            _prevs.data() + firstCorner,
+            _nexts.data() + firstCorner,
+            count);
+
+        for (size_t point = begin; point < end; ++point) {
+            GfVec3f      normal(0.0f);
+            const size_t cornerEnd = size_t(_offsets[point + 1]) - firstCorner;
+            for (size_t corner = size_t(_offsets[point]) - firstCorner; corner < cornerEnd;
+                 ++corner) {
+                normal += GfVec3f(x[corner], y[corner], z[corner]);
+            }
+            normals[point] = normal.GetNormalized();
+        }
+    });
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SmoothNormals::compute(GfVec3d* normals, const GfVec3d* points, size_t numPoints) const
+{
+    std::fill(normals, normals + numPoints, GfVec3d(0.0));
+    if (!_valid || numPoints < _numPoints) {
+        return false;
+    }
+    if (_numPoints == 0) {
+        return true;
+    }
+
+    forEachPointRange(_numPoints, [&](size_t begin, size_t end) {
+        for (size_t point = begin; point < end; ++point) {
+            const GfVec3d& center = points[point];
+            GfVec3d        normal(0.0);
+            for (int32_t corner = _offsets[point]; corner < _offsets[point + 1]; ++corner) {
+                normal += GfCross(points[_nexts[corner]] - center, points[_prevs[corner]] - center);
+            }
+            normals[point] = normal.GetNormalized();
+        }
+    });
+    return true;
+}
+
+} // namespace MayaUsdUtils
@@ -0,0 +1,91 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <mayaUsdUtils/Api.h>
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MayaUsdUtils {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Computes the smooth vertex normals of a polygonal mesh.
+///
+///         The adjacency of the mesh is built once, when the topology is set, and the normals can
+///         then be computed for any number of point positions, e.g. for each frame of a deforming
+///         mesh. The result matches Hd_SmoothNormals: the normal of a vertex is the normalized sum
+///         of the cross products of the two edges of each face corner around it.
+///
+///         The corners are stored grouped by vertex, so that the cross products are computed with
+///         the SIMD kernels of the CPU (see SIMDKernels.h), and large meshes are split across
+///         threads.
+//----------------------------------------------------------------------------------------------------------------------
+class SmoothNormals
+{
+public:
+    /// \brief  constructs an empty adjacency, for which no normal is computed.
+    SmoothNormals() = default;
+
+    /// \brief  builds the adjacency of a polygonal mesh.
+    /// \param  faceVertexCounts the number of vertices of each face
+    /// \param  numFaces the number of faces
+    /// \param  faceVertexIndices the point index of each face vertex
+    /// \param  numFaceVertexIndices the number of face vertices
+    /// \param  leftHanded true if the faces are ordered clockwise
+    MAYA_USD_UTILS_PUBLIC
+    SmoothNormals(
+        const int* faceVertexCounts,
+        size_t     numFaces,
+        const int* faceVertexIndices,
+        size_t     numFaceVertexIndices,
+        bool       leftHanded);
+
+    /// \brief  returns false if the topology is invalid, e.g. references negative point indices.
+    bool isValid() const { return _valid; }
+
+    /// \brief  returns the number of points referenced by the topology.
+    size_t numPoints() const { return _numPoints; }
+
+    /// \brief  computes the normal of each point.
+    /// \param  normals the output normals, holding numPoints values. Points that no face
+    ///         references get a zero normal.
+    /// \param  points the point positions
+    /// \param  numPoints the number of points
+    /// \return false, leaving the normals to zero, if the topology is invalid or if there are fewer
+    ///         points than the topology references. Callers should then use an empty normals
+    ///         array, as with Hd_SmoothNormals.
+    MAYA_USD_UTILS_PUBLIC
+    bool compute(PXR_NS::GfVec3f* normals, const PXR_NS::GfVec3f* points, size_t numPoints) const;
+
+    /// \brief  computes the normal of each point, in double precision.
+    MAYA_USD_UTILS_PUBLIC
+    bool compute(PXR_NS::GfVec3d* normals, const PXR_NS::GfVec3d* points, size_t numPoints) const;
+
+private:
+    size_t               _numPoints = 0;
+    bool                 _valid = true;
+    std::vector<int32_t> _offsets; ///< first corner of each point, and the total number of corners
+    std::vector<int32_t> _centers; ///< the point at each corner, in point order
+    std::vector<int32_t> _prevs;   ///< the previous point of the face at each corner
+    std::vector<int32_t> _nexts;   ///< the next point of the face at each corner
+};
+
+} // namespace MayaUsdUtils
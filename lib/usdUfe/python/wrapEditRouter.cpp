@@ -47,8 +47,9 @@ std::string handlePythonException()
 class PyEditRouter : public UsdUfe::EditRouter
 {
 public:
-    PyEditRouter(PyObject* pyCallable)
+    PyEditRouter(PyObject* pyCallable, bool cacheable)
         : _pyCb(pyCallable)
+        , _cacheable(cacheable)
     {
     }
 
@@ -83,8 +84,11 @@ public:
         }
     }
 
+    bool isCacheable() const override { return _cacheable; }
+
 private:
     PyObject* _pyCb;
+    bool      _cacheable;
 };
 
 UsdUfe::OperationEditRouterContext*
@@ -110,15 +114,19 @@ void wrapEditRouter()
     // Python compilation of the lambda and its argument.
 
     def(
-        "registerEditRouter", +[](const PXR_NS::TfToken& operation, PyObject* editRouter) {
+        "registerEditRouter",
+        +[](const PXR_NS::TfToken& operation, PyObject* editRouter, bool cacheable) {
             return UsdUfe::registerEditRouter(
-                operation, std::make_shared<PyEditRouter>(editRouter));
-        });
+                operation, std::make_shared<PyEditRouter>(editRouter, cacheable));
+        },
+        (arg("operation"), arg("editRouter"), arg("cacheable") = false));
 
     def("restoreDefaultEditRouter", &UsdUfe::restoreDefaultEditRouter);
 
     def("restoreAllDefaultEditRouters", &UsdUfe::restoreAllDefaultEditRouters);
 
+    def("clearEditRouterCache", &UsdUfe::clearEditRouterCache);
+
     using OpThis = UsdUfe::OperationEditRouterContext;
     class_<OpThis, boost::noncopyable>("OperationEditRouterContext", no_init)
         .def("__init__", make_constructor(OperationEditRouterContextInit));
@@ -20,9 +20,14 @@
 
 #include <pxr/base/tf/callContext.h>
 #include <pxr/base/tf/diagnosticLite.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/usd/sdf/pathTable.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/payloads.h>
 #include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/stage.h>
@@ -30,6 +35,10 @@
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/gprim.h>
 
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
 namespace {
 
 UsdUfe::EditRouters& getRegisterdDefaultEditRouters()
@@ -60,12 +69,209 @@ void editTargetLayer(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary&
     routingData[EditRoutingTokens->Layer] = PXR_NS::VtValue(layer);
 }
 
+// Layers computed by the cacheable edit routers, per stage, keyed by prim path,
+// operation, attribute name and edit target layer. The edit target is part of
+// the key rather than an invalidation, as the edit router contexts set and
+// restore the edit target around every routed edit. The layers of a stage are
+// forgotten when its layer stack changes, and the ones of a prim and its
+// descendants when the prim is resynced.
+class EditRouterCache : public PXR_NS::TfWeakBase
+{
+public:
+    static EditRouterCache& instance()
+    {
+        static EditRouterCache cache;
+        return cache;
+    }
+
+    bool find(
+        const PXR_NS::UsdPrim&  prim,
+        const PXR_NS::TfToken&  operation,
+        const PXR_NS::TfToken&  attrName,
+        PXR_NS::SdfLayerHandle& layer)
+    {
+        StageRoutes* stageRoutes = _stageRoutes(prim.GetStage(), false);
+        if (!stageRoutes)
+            return false;
+
+        const auto foundPrim = stageRoutes->routes.find(prim.GetPath());
+        if (foundPrim == stageRoutes->routes.end())
+            return false;
+
+        const auto foundRoute
+            = foundPrim->second.find(Key(operation, attrName, _editTargetLayer(prim)));
+        if (foundRoute == foundPrim->second.end())
+            return false;
+
+        layer = foundRoute->second;
+        return true;
+    }
+
+    void insert(
+        const PXR_NS::UsdPrim&        prim,
+        const PXR_NS::TfToken&        operation,
+        const PXR_NS::TfToken&        attrName,
+        const PXR_NS::SdfLayerHandle& layer)
+    {
+        StageRoutes* stageRoutes = _stageRoutes(prim.GetStage(), true);
+        if (!stageRoutes)
+            return;
+
+        stageRoutes->routes[prim.GetPath()][Key(operation, attrName, _editTargetLayer(prim))]
+            = layer;
+    }
+
+    void clear()
+    {
+        for (auto& entry : _stages)
+            _revoke(entry.second);
+        _stages.clear();
+    }
+
+private:
+    using Key = std::tuple<PXR_NS::TfToken, PXR_NS::TfToken, PXR_NS::SdfLayerHandle>;
+    using Routes = std::map<Key, PXR_NS::SdfLayerHandle>;
+
+    struct StageRoutes
+    {
+        PXR_NS::UsdStageWeakPtr      stage;
+        PXR_NS::TfNotice::Key        objectsChangedKey;
+        PXR_NS::SdfPathTable<Routes> routes;
+    };
+
+    static PXR_NS::SdfLayerHandle _editTargetLayer(const PXR_NS::UsdPrim& prim)
+    {
+        return prim.GetStage()->GetEditTarget().GetLayer();
+    }
+
+    StageRoutes* _stageRoutes(const PXR_NS::UsdStageWeakPtr& stage, bool create)
+    {
+        if (!stage)
+            return nullptr;
+
+        // A stage allocated where a deleted one was must not see its layers.
+        auto found = _stages.find(get_pointer(stage));
+        if (found != _stages.end() && found->second.stage != stage) {
+            _revoke(found->second);
+            _stages.erase(found);
+            found = _stages.end();
+        }
+
+        if (found != _stages.end())
+            return &found->second;
+
+        if (!create)
+            return nullptr;
+
+        PXR_NS::TfWeakPtr<EditRouterCache> me(this);
+
+        StageRoutes& stageRoutes = _stages[get_pointer(stage)];
+        stageRoutes.stage = stage;
+        stageRoutes.objectsChangedKey
+            = PXR_NS::TfNotice::Register(me, &EditRouterCache::_onObjectsChanged, stage);
+        return &stageRoutes;
+    }
+
+    void _onObjectsChanged(
+        const PXR_NS::UsdNotice::ObjectsChanged& notice,
+        const PXR_NS::UsdStageWeakPtr&           sender)
+    {
+        StageRoutes* stageRoutes = _stageRoutes(sender, false);
+        if (!stageRoutes)
+            return;
+
+        // Changes of the layer stack resync the pseudo-root. Changes of
+        // properties, for example when dragging a manipulator, keep the cache.
+        for (const PXR_NS::SdfPath& path : notice.GetResyncedPaths()) {
+            if (path.IsAbsoluteRootPath()) {
+                _forget(sender);
+                return;
+            }
+            if (path.IsPrimPath())
+                stageRoutes->routes.erase(path);
+        }
+    }
+
+    void _forget(const PXR_NS::UsdStageWeakPtr& stage)
+    {
+        auto found = _stages.find(get_pointer(stage));
+        if (found == _stages.end())
+            return;
+
+        _revoke(found->second);
+        _stages.erase(found);
+    }
+
+    static void _revoke(StageRoutes& stageRoutes)
+    {
+        PXR_NS::TfNotice::Revoke(stageRoutes.objectsChangedKey);
+    }
+
+    std::unordered_map<const PXR_NS::UsdStage*, StageRoutes> _stages;
+};
+
+// Retrieve the layer returned by an edit router in its routing data.
+PXR_NS::SdfLayerHandle
+layerFromRoutingData(const PXR_NS::UsdPrim& prim, const PXR_NS::VtDictionary& routingData)
+{
+    const auto found = routingData.find(EditRoutingTokens->Layer);
+    if (found == routingData.end())
+        return nullptr;
+
+    const auto& value = found->second;
+    if (value.IsHolding<std::string>()) {
+        std::string            layerName = value.Get<std::string>();
+        PXR_NS::SdfLayerRefPtr layer = prim.GetStage()->GetRootLayer()->Find(layerName);
+        return layer;
+        // FIXME  We should always be using a string layer identifier, for
+        // Python and C++ compatibility, so the following code should be
+        // removed, and client code using edit routing should be adjusted
+        // accordingly.  PPT, 27-Jan-2022.
+    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
+        return value.Get<PXR_NS::SdfLayerHandle>();
+    } else {
+        return nullptr;
+    }
+}
+
+// Compute the layer of an operation with the edit router, or retrieve it from
+// the cache if the edit router is cacheable. The attribute name is only given
+// for the attribute operation.
+PXR_NS::SdfLayerHandle routeEdit(
+    const UsdUfe::EditRouter::Ptr& editRouter,
+    const PXR_NS::UsdPrim&         prim,
+    const PXR_NS::TfToken&         operation,
+    const PXR_NS::TfToken&         attrName)
+{
+    const bool cacheable = editRouter->isCacheable();
+
+    PXR_NS::SdfLayerHandle layer;
+    if (cacheable && EditRouterCache::instance().find(prim, operation, attrName, layer))
+        return layer;
+
+    PXR_NS::VtDictionary context;
+    PXR_NS::VtDictionary routingData;
+    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
+    context[EditRoutingTokens->Operation] = operation;
+    if (!attrName.IsEmpty())
+        context[operation] = PXR_NS::VtValue(attrName);
+    (*editRouter)(context, routingData);
+    layer = layerFromRoutingData(prim, routingData);
+
+    if (cacheable)
+        EditRouterCache::instance().insert(prim, operation, attrName, layer);
+
+    return layer;
+}
+
 } // namespace
 
 namespace USDUFE_NS_DEF {
 
 EditRouter::~EditRouter() { }
 
+bool EditRouter::isCacheable() const { return false; }
+
 CxxEditRouter::~CxxEditRouter() { }
 
 void CxxEditRouter::operator()(
@@ -75,6 +281,8 @@ void CxxEditRouter::operator()(
     _cb(context, routingData);
 }
 
+bool CxxEditRouter::isCacheable() const { return _cacheable; }
+
 void registerDefaultEditRouter(const PXR_NS::TfToken& operation, const EditRouter::Ptr& editRouter)
 {
     getRegisterdDefaultEditRouters()[operation] = editRouter;
@@ -89,7 +297,7 @@ EditRouters defaultEditRouters()
                                         EditRoutingTokens->RouteDuplicate,
                                         EditRoutingTokens->RouteVisibility };
     for (const auto& o : defaultOperations) {
-        defaultRouters[o] = std::make_shared<CxxEditRouter>(editTargetLayer);
+        defaultRouters[o] = std::make_shared<CxxEditRouter>(editTargetLayer, true);
     }
 
     // Then add in any registered default edit routers.
@@ -104,6 +312,7 @@ EditRouters defaultEditRouters()
 void registerEditRouter(const PXR_NS::TfToken& operation, const EditRouter::Ptr& editRouter)
 {
     getRegisteredEditRouters()[operation] = editRouter;
+    clearEditRouterCache();
 }
 
 bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
@@ -127,12 +336,14 @@ bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
         return false;
 
     editRouters.erase(pos);
+    clearEditRouterCache();
     return true;
 }
 
 void restoreAllDefaultEditRouters()
 {
     getRegisteredEditRouters().clear();
+    clearEditRouterCache();
 
     auto defaults = defaultEditRouters();
     for (const auto& entry : defaults) {
@@ -140,6 +351,8 @@ void restoreAllDefaultEditRouters()
     }
 }
 
+void clearEditRouterCache() { EditRouterCache::instance().clear(); }
+
 EditRouter::Ptr getEditRouter(const PXR_NS::TfToken& operation)
 {
     UsdUfe::EditRouters& editRouters = getRegisteredEditRouters();
@@ -155,31 +368,7 @@ getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim
     if (!dstEditRouter)
         return nullptr;
 
-    PXR_NS::VtDictionary context;
-    PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = operation;
-    (*dstEditRouter)(context, routingData);
-
-    // Try to retrieve the layer from the routing data.
-    const auto found = routingData.find(EditRoutingTokens->Layer);
-    if (found == routingData.end())
-        return nullptr;
-
-    const auto& value = found->second;
-    if (value.IsHolding<std::string>()) {
-        std::string            layerName = value.Get<std::string>();
-        PXR_NS::SdfLayerRefPtr layer = prim.GetStage()->GetRootLayer()->Find(layerName);
-        return layer;
-        // FIXME  We should always be using a string layer identifier, for
-        // Python and C++ compatibility, so the following code should be
-        // removed, and client code using edit routing should be adjusted
-        // accordingly.  PPT, 27-Jan-2022.
-    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
-        return value.Get<PXR_NS::SdfLayerHandle>();
-    } else {
-        return nullptr;
-    }
+    return routeEdit(dstEditRouter, prim, operation, PXR_NS::TfToken());
 }
 
 PXR_NS::SdfLayerHandle
@@ -191,27 +380,7 @@ getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrN
     if (!dstEditRouter)
         return nullptr;
 
-    PXR_NS::VtDictionary context;
-    PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = attrOp;
-    context[attrOp] = PXR_NS::VtValue(attrName);
-    (*dstEditRouter)(context, routingData);
-
-    // Try to retrieve the layer from the routing data.
-    const auto found = routingData.find(EditRoutingTokens->Layer);
-    if (found == routingData.end())
-        return nullptr;
-
-    const auto& value = found->second;
-    if (value.IsHolding<std::string>()) {
-        std::string layerName = value.Get<std::string>();
-        return prim.GetStage()->GetRootLayer()->Find(layerName);
-    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
-        return value.Get<PXR_NS::SdfLayerHandle>();
-    } else {
-        return nullptr;
-    }
+    return routeEdit(dstEditRouter, prim, attrOp, attrName);
 }
 
 } // namespace USDUFE_NS_DEF
@@ -41,6 +41,14 @@ public:
     // so that acceptable defaults can be left unchanged.
     virtual void operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
         = 0;
+
+    // Return true if the routing only depends on the operation, the prim path,
+    // the attribute name, and the layer stack and edit target of the stage.
+    // The layers computed by cacheable edit routers are kept per edit target
+    // layer, and reused until the layer stack changes, the prim is resynced,
+    // the edit routers are changed or the cache is cleared with
+    // clearEditRouterCache().
+    virtual bool isCacheable() const;
 };
 
 // Wrap an argument edit router callback for storage in the edit router map.
@@ -50,8 +58,9 @@ public:
     using EditRouterCb = std::function<
         void(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)>;
 
-    CxxEditRouter(EditRouterCb cb)
+    CxxEditRouter(EditRouterCb cb, bool cacheable = false)
         : _cb(cb)
+        , _cacheable(cacheable)
     {
     }
 
@@ -60,8 +69,11 @@ public:
     void
     operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData) override;
 
+    bool isCacheable() const override;
+
 private:
     EditRouterCb _cb;
+    bool         _cacheable;
 };
 
 using EditRouters
@@ -101,6 +113,11 @@ bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation);
 USDUFE_PUBLIC
 void restoreAllDefaultEditRouters();
 
+// Forget the layers computed by the cacheable edit routers. Needed when the
+// state on which a cacheable edit router bases its routing has changed.
+USDUFE_PUBLIC
+void clearEditRouterCache();
+
 // Register a default router which will be added to the list which is returned by
 // defaultEditRouters().
 USDUFE_PUBLIC
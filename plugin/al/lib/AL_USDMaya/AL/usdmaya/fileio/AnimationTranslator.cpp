@@ -18,12 +18,19 @@
 
 #include "AL/usdmaya/fileio/translators/DgNodeTranslator.h"
 #include "AL/usdmaya/fileio/translators/TransformTranslator.h"
+#include "AL/usdmaya/utils/AttributeType.h"
 #include "AL/usdmaya/utils/MeshUtils.h"
 
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MFnNumericAttribute.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
@@ -33,101 +40,405 @@ namespace AL {
 namespace usdmaya {
 namespace fileio {
 
+namespace {
+
+using usdmaya::utils::UsdDataType;
+
+// Bounds the memory used by the captured values. Once reached, the values captured so far are
+// converted and authored before evaluating the next frames.
+constexpr size_t kMaxCapturedBytes = size_t(256) << 20;
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the number of values to capture per frame for a numeric plug, or 0 if the plug
+///         has to be copied with DgNodeHelper::copyAttributeValue at each frame instead.
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t capturedComponentCount(const MPlug& plug, UsdDataType type)
+{
+    if (plug.isArray() || plug.isElement()) {
+        return 0;
+    }
+
+    const MObject attribute = plug.attribute();
+    uint32_t      mayaComponents = 0;
+    switch (attribute.apiType()) {
+    case MFn::kNumericAttribute: {
+        const MFnNumericAttribute fn(attribute);
+        if (fn.unitType() == MFnNumericData::kFloat || fn.unitType() == MFnNumericData::kDouble) {
+            mayaComponents = 1;
+        }
+    } break;
+    case MFn::kFloatAngleAttribute:
+    case MFn::kDoubleAngleAttribute:
+    case MFn::kFloatLinearAttribute:
+    case MFn::kDoubleLinearAttribute: mayaComponents = 1; break;
+    case MFn::kAttribute2Float:
+    case MFn::kAttribute2Double: mayaComponents = 2; break;
+    case MFn::kAttribute3Float:
+    case MFn::kAttribute3Double: mayaComponents = 3; break;
+    case MFn::kAttribute4Double: mayaComponents = 4; break;
+    default: break;
+    }
+
+    uint32_t usdComponents = 0;
+    switch (type) {
+    case UsdDataType::kFloat:
+    case UsdDataType::kDouble: usdComponents = 1; break;
+    case UsdDataType::kVec2f:
+    case UsdDataType::kVec2d: usdComponents = 2; break;
+    case UsdDataType::kVec3f:
+    case UsdDataType::kVec3d: usdComponents = 3; break;
+    case UsdDataType::kVec4f:
+    case UsdDataType::kVec4d: usdComponents = 4; break;
+    default: break;
+    }
+    return mayaComponents == usdComponents ? usdComponents : 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  An animated numeric plug, whose values are read at each frame into a flat buffer, and
+///         converted into time samples once a batch of frames has been evaluated.
+//----------------------------------------------------------------------------------------------------------------------
+struct CapturedPlug
+{
+    MPlug               plug;
+    UsdAttribute        attr;
+    UsdDataType         type;
+    uint32_t            numComponents;
+    float               scale;
+    std::vector<double> values; ///< numComponents values per captured frame
+
+    void capture()
+    {
+        if (numComponents == 1) {
+            values.push_back(plug.asDouble());
+        } else {
+            for (uint32_t i = 0; i < numComponents; ++i) {
+                values.push_back(plug.child(i).asDouble());
+            }
+        }
+    }
+
+    /// Applies the scale the same way as DgNodeHelper::copyAttributeValue does.
+    VtValue convert(const double* v) const
+    {
+        switch (type) {
+        case UsdDataType::kFloat: return VtValue(float(v[0]) * scale);
+        case UsdDataType::kDouble: return VtValue(v[0] * scale);
+        case UsdDataType::kVec2f: return VtValue(GfVec2f(float(v[0]), float(v[1])) * scale);
+        case UsdDataType::kVec2d: return VtValue(GfVec2d(v[0], v[1]) * scale);
+        case UsdDataType::kVec3f:
+            return VtValue(GfVec3f(float(v[0]), float(v[1]), float(v[2])) * scale);
+        case UsdDataType::kVec3d: return VtValue(GfVec3d(v[0], v[1], v[2]) * scale);
+        case UsdDataType::kVec4f:
+            return VtValue(GfVec4f(float(v[0]), float(v[1]), float(v[2]), float(v[3])) * scale);
+        case UsdDataType::kVec4d: return VtValue(GfVec4d(v[0], v[1], v[2], v[3]) * scale);
+        default: return VtValue();
+        }
+    }
+
+    void toSamples(std::vector<VtValue>& samples) const
+    {
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = convert(values.data() + i * numComponents);
+        }
+    }
+
+    size_t capturedBytes() const { return values.size() * sizeof(double); }
+    void   clear() { values.clear(); }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  The points of an animated mesh, read at each frame into a flat buffer.
+//----------------------------------------------------------------------------------------------------------------------
+struct CapturedMesh
+{
+    MDagPath             path;
+    UsdAttribute         attr;
+    std::vector<float>   points;
+    std::vector<size_t>  offsets; ///< the start of each frame in points, or npos if unreadable
+    std::vector<uint32_t> counts;
+
+    static constexpr size_t npos = size_t(-1);
+
+    void capture()
+    {
+        MStatus        status;
+        MFnMesh        fnMesh(path);
+        const uint32_t numVertices = fnMesh.numVertices();
+        const float*   pointsData = fnMesh.getRawPoints(&status);
+        if (status) {
+            offsets.push_back(points.size());
+            counts.push_back(numVertices);
+            points.insert(points.end(), pointsData, pointsData + 3 * numVertices);
+        } else {
+            MGlobal::displayError(
+                MString("Unable to access mesh vertices on mesh: ") + fnMesh.fullPathName());
+            offsets.push_back(npos);
+            counts.push_back(0);
+        }
+    }
+
+    void toSamples(std::vector<VtValue>& samples) const
+    {
+        for (size_t i = 0; i < samples.size(); ++i) {
+            if (offsets[i] != npos) {
+                const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(points.data() + offsets[i]);
+                samples[i] = VtValue(VtArray<GfVec3f>(vecData, vecData + counts[i]));
+            }
+        }
+    }
+
+    size_t capturedBytes() const { return points.size() * sizeof(float); }
+    void   clear()
+    {
+        points.clear();
+        offsets.clear();
+        counts.clear();
+    }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  The world space matrix of an animated dag path, read at each frame into a flat buffer.
+//----------------------------------------------------------------------------------------------------------------------
+struct CapturedMatrix
+{
+    MDagPath            path;
+    UsdAttribute        attr;
+    std::vector<double> values; ///< 16 values per captured frame
+
+    void capture()
+    {
+        const MMatrix mat = path.inclusiveMatrix();
+        values.insert(values.end(), &mat.matrix[0][0], &mat.matrix[0][0] + 16);
+    }
+
+    void toSamples(std::vector<VtValue>& samples) const
+    {
+        for (size_t i = 0; i < samples.size(); ++i) {
+            GfMatrix4d matrix;
+            std::copy(values.data() + i * 16, values.data() + (i + 1) * 16, matrix.data());
+            samples[i] = VtValue(matrix);
+        }
+    }
+
+    size_t capturedBytes() const { return values.size() * sizeof(double); }
+    void   clear() { values.clear(); }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Holds the values captured from Maya for a batch of frames.
+//----------------------------------------------------------------------------------------------------------------------
+struct CapturedAnimation
+{
+    std::vector<CapturedPlug>   plugs;
+    std::vector<CapturedMesh>   meshes;
+    std::vector<CapturedMatrix> matrices;
+    std::vector<double>         times;
+
+    bool empty() const { return plugs.empty() && meshes.empty() && matrices.empty(); }
+
+    void capture(double time)
+    {
+        times.push_back(time);
+        for (auto& plug : plugs) {
+            plug.capture();
+        }
+        for (auto& mesh : meshes) {
+            mesh.capture();
+        }
+        for (auto& matrix : matrices) {
+            matrix.capture();
+        }
+    }
+
+    size_t capturedBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& plug : plugs) {
+            bytes += plug.capturedBytes();
+        }
+        for (const auto& mesh : meshes) {
+            bytes += mesh.capturedBytes();
+        }
+        for (const auto& matrix : matrices) {
+            bytes += matrix.capturedBytes();
+        }
+        return bytes;
+    }
+
+    /// Converts the captured values into time samples in parallel, one attribute per task, then
+    /// authors them. Layers cannot be edited from several threads, so the samples are set from
+    /// the calling thread, in a single change block.
+    void flush()
+    {
+        if (times.empty()) {
+            return;
+        }
+
+        const size_t numPlugs = plugs.size();
+        const size_t numMeshes = meshes.size();
+        const size_t numAttributes = numPlugs + numMeshes + matrices.size();
+
+        std::vector<std::vector<VtValue>> samples(
+            numAttributes, std::vector<VtValue>(times.size()));
+        WorkParallelForN(numAttributes, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (i < numPlugs) {
+                    plugs[i].toSamples(samples[i]);
+                } else if (i < numPlugs + numMeshes) {
+                    meshes[i - numPlugs].toSamples(samples[i]);
+                } else {
+                    matrices[i - numPlugs - numMeshes].toSamples(samples[i]);
+                }
+            }
+        });
+
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < numAttributes; ++i) {
+            UsdAttribute& attr = (i < numPlugs) ? plugs[i].attr
+                : (i < numPlugs + numMeshes)    ? meshes[i - numPlugs].attr
+                                                : matrices[i - numPlugs - numMeshes].attr;
+            for (size_t j = 0; j < times.size(); ++j) {
+                if (!samples[i][j].IsEmpty()) {
+                    attr.Set(samples[i][j], UsdTimeCode(times[j]));
+                }
+            }
+        }
+
+        times.clear();
+        for (auto& plug : plugs) {
+            plug.clear();
+        }
+        for (auto& mesh : meshes) {
+            mesh.clear();
+        }
+        for (auto& matrix : matrices) {
+            matrix.clear();
+        }
+    }
+};
+
+} // namespace
+
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
-    auto const startAttrib = m_animatedPlugs.begin();
-    auto const endAttrib = m_animatedPlugs.end();
-    auto const startAttribScaled = m_scaledAnimatedPlugs.begin();
-    auto const endAttribScaled = m_scaledAnimatedPlugs.end();
-    auto const startTransformAttrib = m_animatedTransformPlugs.begin();
-    auto const endTransformAttrib = m_animatedTransformPlugs.end();
-    auto const startMultiAttrib = m_animatedMultiPlugs.begin();
-    auto const endMultiAttrib = m_animatedMultiPlugs.end();
-    auto const startMesh = m_animatedMeshes.begin();
-    auto const endMesh = m_animatedMeshes.end();
-    auto const startWSM = m_worldSpaceOutputs.begin();
-    auto const endWSM = m_worldSpaceOutputs.end();
-
-    if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
-        || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
-        || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
-        double increment = 1.0 / std::max(1U, params.m_subSamples);
-        for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
-            MAnimControl::setCurrentTime(t);
-            UsdTimeCode timeCode(t);
-            for (auto it = startAttrib; it != endAttrib; ++it) {
-                /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
-                ///         maya::Dg
-                ///         usdmaya::Dg
-                ///         usdmaya::fileio::translator::Dg
+    if (m_animatedPlugs.empty() && m_scaledAnimatedPlugs.empty()
+        && m_animatedTransformPlugs.empty() && m_animatedMultiPlugs.empty()
+        && m_animatedMeshes.empty() && m_worldSpaceOutputs.empty() && m_animatedNodes.empty()) {
+        return;
+    }
+
+    // The export runs in two phases. While Maya evaluates each frame, the values of numeric plugs,
+    // mesh points and world space matrices are only read into flat buffers. They are converted
+    // into USD values in parallel afterwards (see CapturedAnimation::flush). Anything else is
+    // copied into USD at each frame, as before.
+    CapturedAnimation    captured;
+    PlugAttrVector       serialPlugs;
+    PlugAttrScaledVector serialScaledPlugs;
+
+    // Offset parent matrices are merged by decomposing the local matrix at each frame, which is
+    // left to TransformTranslator::copyAttributeValue.
 #if MAYA_APP_VERSION > 2019
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode, params.m_mergeOffsetParentMatrix);
+    const bool canCapturePlugs = !params.m_mergeOffsetParentMatrix;
 #else
-                translators::DgNodeTranslator::copyAttributeValue(it->first, it->second, timeCode);
+    const bool canCapturePlugs = true;
 #endif
-            }
-            for (auto it = startAttribScaled; it != endAttribScaled; ++it) {
-                /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
-                ///         maya::Dg
-                ///         usdmaya::Dg
-                ///         usdmaya::fileio::translator::Dg
+    for (const auto& it : m_animatedPlugs) {
+        const UsdDataType type = usdmaya::utils::getAttributeType(it.second);
+        const uint32_t    numComponents
+            = canCapturePlugs ? capturedComponentCount(it.first, type) : 0;
+        if (numComponents) {
+            captured.plugs.push_back({ it.first, it.second, type, numComponents, 1.0f, {} });
+        } else {
+            serialPlugs.insert(it);
+        }
+    }
+    for (const auto& it : m_scaledAnimatedPlugs) {
+        const UsdDataType type = usdmaya::utils::getAttributeType(it.second.attr);
+        const uint32_t    numComponents
+            = canCapturePlugs ? capturedComponentCount(it.first, type) : 0;
+        if (numComponents) {
+            captured.plugs.push_back(
+                { it.first, it.second.attr, type, numComponents, it.second.scale, {} });
+        } else {
+            serialScaledPlugs.insert(it);
+        }
+    }
+    for (const auto& it : m_animatedMeshes) {
+        captured.meshes.push_back({ it.first, it.second, {}, {}, {} });
+    }
+    for (const auto& it : m_worldSpaceOutputs) {
+        captured.matrices.push_back({ it.first, it.second, {} });
+    }
+
+    double increment = 1.0 / std::max(1U, params.m_subSamples);
+    for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
+        MAnimControl::setCurrentTime(t);
+        UsdTimeCode timeCode(t);
+        for (auto it = serialPlugs.begin(); it != serialPlugs.end(); ++it) {
+            /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
+            ///         maya::Dg
+            ///         usdmaya::Dg
+            ///         usdmaya::fileio::translator::Dg
 #if MAYA_APP_VERSION > 2019
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first,
-                    it->second.attr,
-                    it->second.scale,
-                    timeCode,
-                    params.m_mergeOffsetParentMatrix);
+            translators::TransformTranslator::copyAttributeValue(
+                it->first, it->second, timeCode, params.m_mergeOffsetParentMatrix);
 #else
-                translators::DgNodeTranslator::copyAttributeValue(
-                    it->first, it->second.attr, it->second.scale, timeCode);
+            translators::DgNodeTranslator::copyAttributeValue(it->first, it->second, timeCode);
 #endif
-            }
-            for (auto it = startTransformAttrib; it != endTransformAttrib; ++it) {
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode);
-            }
-            for (auto it = startMultiAttrib; it != endMultiAttrib; ++it) {
-                // Note: so far there is only one attribute need to be treated specially
-                //       we do this special handling for this particular attribute atm,
-                //       will see if we need to generalize once have more requests
-                if (it->first.GetName() == UsdGeomTokens->clippingRange && it->second.size() == 2) {
-                    const auto& plugs(it->second);
-                    MDistance   nearDistance;
-                    MDistance   farDistance;
-                    if (plugs[0].getValue(nearDistance) == MStatus::kSuccess
-                        && plugs[1].getValue(farDistance) == MStatus::kSuccess) {
-                        GfVec2f clippingRange {
-                            static_cast<float>(nearDistance.as(MDistance::kCentimeters)),
-                            static_cast<float>(farDistance.as(MDistance::kCentimeters))
-                        };
-                        it->first.Set(clippingRange, timeCode);
-                    }
+        }
+        for (auto it = serialScaledPlugs.begin(); it != serialScaledPlugs.end(); ++it) {
+            /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
+            ///         maya::Dg
+            ///         usdmaya::Dg
+            ///         usdmaya::fileio::translator::Dg
+#if MAYA_APP_VERSION > 2019
+            translators::TransformTranslator::copyAttributeValue(
+                it->first,
+                it->second.attr,
+                it->second.scale,
+                timeCode,
+                params.m_mergeOffsetParentMatrix);
+#else
+            translators::DgNodeTranslator::copyAttributeValue(
+                it->first, it->second.attr, it->second.scale, timeCode);
+#endif
+        }
+        for (auto it = m_animatedTransformPlugs.begin(); it != m_animatedTransformPlugs.end();
+             ++it) {
+            translators::TransformTranslator::copyAttributeValue(it->first, it->second, timeCode);
+        }
+        for (auto it = m_animatedMultiPlugs.begin(); it != m_animatedMultiPlugs.end(); ++it) {
+            // Note: so far there is only one attribute need to be treated specially
+            //       we do this special handling for this particular attribute atm,
+            //       will see if we need to generalize once have more requests
+            if (it->first.GetName() == UsdGeomTokens->clippingRange && it->second.size() == 2) {
+                const auto& plugs(it->second);
+                MDistance   nearDistance;
+                MDistance   farDistance;
+                if (plugs[0].getValue(nearDistance) == MStatus::kSuccess
+                    && plugs[1].getValue(farDistance) == MStatus::kSuccess) {
+                    GfVec2f clippingRange {
+                        static_cast<float>(nearDistance.as(MDistance::kCentimeters)),
+                        static_cast<float>(farDistance.as(MDistance::kCentimeters))
+                    };
+                    it->first.Set(clippingRange, timeCode);
                 }
             }
-            for (auto it = startMesh; it != endMesh; ++it) {
-                UsdGeomMesh                           mesh(it->second.GetPrim());
-                AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
-                context.copyVertexData(timeCode);
-            }
-            for (auto nodeAnim : m_animatedNodes) {
-                nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
-            }
-            for (auto it = startWSM; it != endWSM; ++it) {
-                MMatrix mat = it->first.inclusiveMatrix();
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif
-                it->second.Set(*(const GfMatrix4d*)&mat, timeCode);
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
+        }
+        for (auto nodeAnim : m_animatedNodes) {
+            nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
+        }
+
+        if (!captured.empty()) {
+            captured.capture(t);
+            if (captured.capturedBytes() >= kMaxCapturedBytes) {
+                captured.flush();
             }
         }
     }
+    captured.flush();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -14,7 +14,9 @@
 // limitations under the License.
 //
 #include "AL/usdmaya/utils/DiffPrimVar.h"
+#include "AL/usdmaya/utils/MeshUtils.h"
 
+#include <maya/MDagPath.h>
 #include <maya/MFileIO.h>
 #include <maya/MFloatPointArray.h>
 #include <maya/MFnMesh.h>
@@ -23,6 +25,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 static const float P[][4] = {
     { 0, 0, 0, 1 }, { 1, 0, 0, 1 }, { 1, 1, 0, 1 }, { 0, 1, 0, 1 },
     { 0, 0, 0, 1 }, { 2, 0, 0, 1 }, { 2, 2, 0, 1 }, { 0, 2, 0, 1 },
@@ -360,3 +364,70 @@ TEST(DiffGeom, normalTests)
                 geom, fnMesh, UsdTimeCode::Default(), AL::usdmaya::utils::kNormals));
     }
 }
+
+// make sure a diffing export only authors the components that have changed
+TEST(DiffGeom, writtenComponents)
+{
+    using namespace AL::usdmaya::utils;
+    MFileIO::newFile(true);
+
+    MFnTransform fnTM;
+    MFnMesh      fnMesh;
+    MObject      oTransform = fnTM.create();
+    MObject      oMesh = fnMesh.create(
+        numP,
+        numFC,
+        MFloatPointArray(P, numP),
+        MIntArray(FC, numFC),
+        MIntArray(FV, numFV),
+        oTransform);
+    MDagPath path;
+    ASSERT_TRUE(MDagPath::getAPathTo(oMesh, path));
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    ASSERT_TRUE(stage);
+    auto geom = UsdGeomMesh::Define(stage, SdfPath("/mesh"));
+
+    const uint32_t geomComponents = kPoints | kExtent | kFaceVertexCounts | kFaceVertexIndices;
+    auto           writeMesh = [&](UsdTimeCode time, bool performDiff) {
+        MeshExportContext context(path, geom, time, performDiff);
+        EXPECT_TRUE(context);
+        context.copyVertexData(time);
+        context.copyExtentData(time);
+        context.copyFaceConnectsAndPolyCounts();
+        return context.writtenComponents() & geomComponents;
+    };
+
+    // a full export writes everything, an unchanged mesh nothing
+    EXPECT_EQ(geomComponents, writeMesh(UsdTimeCode::Default(), false));
+    EXPECT_EQ(0u, writeMesh(UsdTimeCode::Default(), true));
+
+    // moving a point outside of the bounds only rewrites the points and extent
+    fnMesh.setPoint(6, MPoint(3, 3, 0));
+    EXPECT_EQ(kPoints | kExtent, writeMesh(UsdTimeCode::Default(), true));
+    EXPECT_EQ(0u, writeMesh(UsdTimeCode::Default(), true));
+
+    // unchanged time samples are not authored again: the layer is left untouched
+    const UsdTimeCode sampleTime(1.0);
+    EXPECT_EQ(geomComponents, writeMesh(sampleTime, false));
+    std::string layerBefore, layerAfter;
+    ASSERT_TRUE(stage->GetRootLayer()->ExportToString(&layerBefore));
+    EXPECT_EQ(0u, writeMesh(sampleTime, true));
+    ASSERT_TRUE(stage->GetRootLayer()->ExportToString(&layerAfter));
+    EXPECT_EQ(layerBefore, layerAfter);
+
+    // the static topology stays at the default time, next to the animated points
+    EXPECT_EQ(1u, geom.GetPointsAttr().GetNumTimeSamples());
+    EXPECT_EQ(0u, geom.GetFaceVertexCountsAttr().GetNumTimeSamples());
+    EXPECT_EQ(0u, geom.GetFaceVertexIndicesAttr().GetNumTimeSamples());
+
+    // while an animated topology is written back into its time sample
+    VtArray<int32_t> faceVertexCounts;
+    ASSERT_TRUE(geom.GetFaceVertexCountsAttr().Get(&faceVertexCounts));
+    geom.GetFaceVertexCountsAttr().Set(VtArray<int32_t>(1, 3), sampleTime);
+    EXPECT_EQ(kFaceVertexCounts, writeMesh(sampleTime, true));
+    VtArray<int32_t> sampledCounts;
+    ASSERT_TRUE(geom.GetFaceVertexCountsAttr().Get(&sampledCounts, sampleTime));
+    EXPECT_EQ(faceVertexCounts, sampledCounts);
+    EXPECT_EQ(1u, geom.GetFaceVertexCountsAttr().GetNumTimeSamples());
+}
@@ -14,9 +14,18 @@
 // limitations under the License.
 //
 #include "AL/usdmaya/fileio/AnimationTranslator.h"
+#include "AL/usdmaya/fileio/ExportParams.h"
 #include "test_usdmaya.h"
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MAnimControl.h>
 #include <maya/MDGModifier.h>
+#include <maya/MDagPath.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFileIO.h>
 #include <maya/MFnAnimCurve.h>
@@ -24,10 +33,13 @@
 #include <maya/MFnNurbsCurve.h>
 #include <maya/MFnTransform.h>
 #include <maya/MGlobal.h>
+#include <maya/MMatrix.h>
 #include <maya/MPointArray.h>
 #include <maya/MSelectionList.h>
+#include <maya/MVector.h>
 
 using AL::usdmaya::fileio::AnimationTranslator;
+using AL::usdmaya::fileio::ExporterParams;
 
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  Test USD to attribute enum mappings
@@ -46,6 +58,17 @@ void  setUp()
     m_outTime = time1Fn.findPlug("outTime");
 }
 
+const double kPi = 3.14159265358979323846;
+
+// Keys the given plug with a linear curve going from value0 at frame 1 to value1 at frame 3.
+void keyPlug(const MPlug& plug, double value0, double value1)
+{
+    MFnAnimCurve fna;
+    fna.create(plug);
+    fna.addKey(MTime(1.0), value0, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear);
+    fna.addKey(MTime(3.0), value1, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear);
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -463,3 +486,114 @@ TEST(translators_AnimationTranslator, isAnimatedTransform)
     mod.deleteNode(root);
     mod.doIt();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+// The values of animated plugs are captured at each frame, then converted and authored once all the
+// frames have been evaluated: the samples must match what Maya evaluated at each frame.
+TEST(translators_AnimationTranslator, capturedPlugSamples)
+{
+    MFileIO::newFile(true);
+
+    MFnTransform fnt;
+    MObject      node = fnt.create();
+    keyPlug(fnt.findPlug("translateX", true), 0.0, 4.0);
+    keyPlug(fnt.findPlug("translateZ", true), -1.0, 1.0);
+    keyPlug(fnt.findPlug("rotateY", true), 0.0, kPi);
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim        prim = stage->DefinePrim(SdfPath("/node"));
+    UsdAttribute   translate
+        = prim.CreateAttribute(TfToken("translate"), SdfValueTypeNames->Double3);
+    UsdAttribute translateX
+        = prim.CreateAttribute(TfToken("translateX"), SdfValueTypeNames->Float);
+    UsdAttribute rotate = prim.CreateAttribute(TfToken("rotate"), SdfValueTypeNames->Float3);
+
+    ExporterParams      params;
+    AnimationTranslator animTranslator;
+    params.m_minFrame = 1.0;
+    params.m_maxFrame = 3.0;
+    params.m_subSamples = 2;
+    animTranslator.addPlug(fnt.findPlug("translate", true), translate, true);
+    animTranslator.addPlug(fnt.findPlug("translateX", true), translateX, true);
+    animTranslator.addPlug(fnt.findPlug("rotate", true), rotate, float(180.0 / kPi), true);
+    animTranslator.exportAnimation(params);
+
+    // one sample per sub-frame
+    EXPECT_EQ(5u, translate.GetNumTimeSamples());
+    EXPECT_EQ(5u, translateX.GetNumTimeSamples());
+    EXPECT_EQ(5u, rotate.GetNumTimeSamples());
+
+    for (double t = 1.0; t < 3.0 + 1e-3; t += 0.5) {
+        MAnimControl::setCurrentTime(MTime(t));
+        const double tx = fnt.findPlug("translateX", true).asDouble();
+        const double tz = fnt.findPlug("translateZ", true).asDouble();
+        const double ry = fnt.findPlug("rotateY", true).asDouble();
+
+        GfVec3d translateValue;
+        EXPECT_TRUE(translate.Get(&translateValue, t));
+        EXPECT_NEAR(tx, translateValue[0], 1e-6);
+        EXPECT_NEAR(0.0, translateValue[1], 1e-6);
+        EXPECT_NEAR(tz, translateValue[2], 1e-6);
+
+        float translateXValue = 0.0f;
+        EXPECT_TRUE(translateX.Get(&translateXValue, t));
+        EXPECT_NEAR(tx, translateXValue, 1e-5);
+
+        // angles are converted to degrees
+        GfVec3f rotateValue;
+        EXPECT_TRUE(rotate.Get(&rotateValue, t));
+        EXPECT_NEAR(ry * 180.0 / kPi, rotateValue[1], 1e-4);
+    }
+
+    MDGModifier mod;
+    mod.deleteNode(node);
+    mod.doIt();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// World space matrices are captured at each frame as well, and must follow the animated parents.
+TEST(translators_AnimationTranslator, capturedWorldSpaceSamples)
+{
+    MFileIO::newFile(true);
+
+    MFnTransform fnParent;
+    MObject      parent = fnParent.create();
+    keyPlug(fnParent.findPlug("translateY", true), 0.0, 2.0);
+    keyPlug(fnParent.findPlug("rotateZ", true), 0.0, kPi / 2.0);
+
+    MFnTransform fnChild;
+    fnChild.create(parent);
+    fnChild.setTranslation(MVector(1.0, 0.0, 0.0), MSpace::kTransform);
+    MDagPath childPath;
+    fnChild.getPath(childPath);
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim        prim = stage->DefinePrim(SdfPath("/child"));
+    UsdAttribute   transform
+        = prim.CreateAttribute(TfToken("xformOp:transform"), SdfValueTypeNames->Matrix4d);
+
+    ExporterParams      params;
+    AnimationTranslator animTranslator;
+    params.m_minFrame = 1.0;
+    params.m_maxFrame = 3.0;
+    animTranslator.addWorldSpace(childPath, transform);
+    animTranslator.exportAnimation(params);
+
+    EXPECT_EQ(3u, transform.GetNumTimeSamples());
+    for (double t = 1.0; t < 3.0 + 1e-3; t += 1.0) {
+        MAnimControl::setCurrentTime(MTime(t));
+        const MMatrix mayaMatrix = childPath.inclusiveMatrix();
+
+        GfMatrix4d usdMatrix;
+        EXPECT_TRUE(transform.Get(&usdMatrix, t));
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                EXPECT_NEAR(mayaMatrix(i, j), usdMatrix[i][j], 1e-6);
+            }
+        }
+    }
+
+    MDGModifier mod;
+    mod.deleteNode(parent);
+    mod.doIt();
+}
@@ -40,6 +40,8 @@
 #include <maya/MProfiler.h>
 #include <maya/MVectorArray.h>
 
+#include <limits>
+
 namespace {
 const int _meshProfilerCategory = MProfiler::addCategory(
 #if MAYA_API_VERSION >= 20190000
@@ -261,8 +263,13 @@ MStatus Mesh::preTearDown(UsdPrim& prim)
         AL_MAYA_CHECK_ERROR(
             status, MString("unable to attach function set to mesh: ") + path.fullPathName());
 
-        UsdGeomMesh geomPrim(prim);
-        writeEdits(path, geomPrim, kPerformDiff | kDynamicAttributes);
+        UsdGeomMesh    geomPrim(prim);
+        const uint32_t written = writeEdits(path, geomPrim, kPerformDiff | kDynamicAttributes);
+        TF_DEBUG(ALUSDMAYA_TRANSLATORS)
+            .Msg(
+                "Mesh::preTearDown wrote components 0x%x to prim='%s'\n",
+                written,
+                prim.GetPath().GetText());
     } else {
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg(
@@ -274,11 +281,28 @@ MStatus Mesh::preTearDown(UsdPrim& prim)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void Mesh::writeEdits(MDagPath& dagPath, UsdGeomMesh& geomPrim, uint32_t options)
+uint32_t Mesh::writeEdits(MDagPath& dagPath, UsdGeomMesh& geomPrim, uint32_t options)
 {
     TF_DEBUG(ALUSDMAYA_TRANSLATORS)
         .Msg("MeshTranslator::writing edits to prim='%s'\n", geomPrim.GetPath().GetText());
-    UsdTimeCode                           t = UsdTimeCode::Default();
+
+    // Animated meshes are imported from their earliest time sample (see import), so compare against
+    // and write back to that sample. Authoring a default value would be hidden by the samples, and
+    // comparing against it would report every component as changed.
+    UsdTimeCode          t = UsdTimeCode::Default();
+    TranslatorContextPtr ctx = context();
+    if (!(ctx && ctx->getForceDefaultRead())) {
+        // The samples bracketing the lowest possible time are both the first one, found without
+        // loading all the sample times.
+        double firstTime = 0.0, upperTime = 0.0;
+        bool   hasTimeSamples = false;
+        if (geomPrim.GetPointsAttr().GetBracketingTimeSamples(
+                std::numeric_limits<double>::lowest(), &firstTime, &upperTime, &hasTimeSamples)
+            && hasTimeSamples) {
+            t = UsdTimeCode(firstTime);
+        }
+    }
+
     AL::usdmaya::utils::MeshExportContext context(dagPath, geomPrim, t, options & kPerformDiff);
     if (context) {
         context.copyVertexData(t);
@@ -295,7 +319,9 @@ void Mesh::writeEdits(MDagPath& dagPath, UsdGeomMesh& geomPrim, uint32_t options
             UsdPrim prim = geomPrim.GetPrim();
             DgNodeTranslator::copyDynamicAttributes(dagPath.node(), prim);
         }
+        return context.writtenComponents();
     }
+    return 0;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -67,7 +67,13 @@ private:
         kPerformDiff = 1 << 0,
         kDynamicAttributes = 1 << 1
     };
-    void writeEdits(
+    /// \brief  writes the maya mesh back into the usd prim.
+    /// \param  dagPath the maya mesh
+    /// \param  geomPrim the usd prim to write into
+    /// \param  options a combination of WriteOptions. With kPerformDiff, only the components that
+    ///         differ from the usd prim are authored.
+    /// \return the components (AL::usdmaya::utils::DiffComponents bits) that have been authored
+    uint32_t writeEdits(
         MDagPath&            dagPath,
         PXR_NS::UsdGeomMesh& geomPrim,
         uint32_t             options = kDynamicAttributes);
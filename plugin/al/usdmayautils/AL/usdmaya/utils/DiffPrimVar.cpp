@@ -34,6 +34,19 @@ namespace AL {
 namespace usdmaya {
 namespace utils {
 
+//----------------------------------------------------------------------------------------------------------------------
+GfRange3f computeExtent(const float* points, size_t count)
+{
+    if (!count) {
+        return GfRange3f(GfVec3f(0.0f), GfVec3f(0.0f));
+    }
+    GfRange3f range;
+    for (size_t i = 0; i < count; ++i, points += 3) {
+        range.UnionWith(GfVec3f(points[0], points[1], points[2]));
+    }
+    return range;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t diffGeom(UsdGeomPointBased& geom, MFnMesh& mesh, UsdTimeCode timeCode, uint32_t exportMask)
 {
@@ -59,20 +72,11 @@ uint32_t diffGeom(UsdGeomPointBased& geom, MFnMesh& mesh, UsdTimeCode timeCode,
         MStatus      status;
         const float* pointsData = mesh.getRawPoints(&status);
         if (status) {
-            const uint32_t   numVertices = mesh.numVertices();
-            const GfVec3f*   vecData = reinterpret_cast<const GfVec3f*>(pointsData);
-            VtArray<GfVec3f> points(vecData, vecData + numVertices);
-
-            VtArray<GfVec3f> mayaExtent(2);
-            UsdGeomPointBased::ComputeExtent(points, &mayaExtent);
+            const GfRange3f mayaRange = computeExtent(pointsData, mesh.numVertices());
 
-            VtArray<GfVec3f> usdExtent(2);
+            VtArray<GfVec3f> usdExtent;
             geom.GetExtentAttr().Get(&usdExtent, timeCode);
-
-            const GfRange3f mayaRange(mayaExtent[0], mayaExtent[1]);
-            const GfRange3f usdRange(usdExtent[0], usdExtent[1]);
-
-            if (mayaRange != usdRange)
+            if (usdExtent.size() != 2 || mayaRange != GfRange3f(usdExtent[0], usdExtent[1]))
                 result |= kExtent;
         }
     }
@@ -19,6 +19,7 @@
 
 #include <mayaUsdUtils/ForwardDeclares.h>
 
+#include <pxr/base/gf/range3f.h>
 #include <pxr/usd/usdGeom/mesh.h>
 
 #include <maya/MFnMesh.h>
@@ -46,9 +47,21 @@ enum DiffComponents
     kCornerIndices = 1 << 9,     ///< the vertex creases have changed
     kCornerSharpness = 1 << 10,  ///< the vertex crease weights have changed
     kExtent = 1 << 11,           ///< the point extents have changed
+    kUvSets = 1 << 12,           ///< one or more uv sets have changed
+    kColourSets = 1 << 13,       ///< one or more colour sets have changed
+    kBindPose = 1 << 14,         ///< the bind pose (pref) points have changed
     kAllComponents = 0xFFFFFFFF
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  computes the bounds of an array of points, without copying them into a VtArray first
+/// \param  points the x/y/z point values
+/// \param  count the number of points
+/// \return the bounds of the points, or a zero sized range at the origin if there are no points
+//----------------------------------------------------------------------------------------------------------------------
+AL_USDMAYA_UTILS_PUBLIC
+GfRange3f computeExtent(const float* points, size_t count);
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  performs a diff between a point based usdgeom, and a maya mesh. This only checks the
 /// points
@@ -22,6 +22,7 @@
 
 #include <mayaUsdUtils/DebugCodes.h>
 #include <mayaUsdUtils/DiffCore.h>
+#include <mayaUsdUtils/SIMDKernels.h>
 
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdUtils/pipeline.h>
@@ -43,17 +44,13 @@ const TfToken primvarDisplayOpacityToken("primvars:displayOpacity");
 //----------------------------------------------------------------------------------------------------------------------
 void floatToDouble(double* output, const float* const input, size_t count)
 {
-    for (size_t i = 0; i < count; ++i) {
-        output[i] = double(input[i]);
-    }
+    MayaUsdUtils::floatToDouble(output, input, count);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void doubleToFloat(float* output, const double* const input, size_t count)
 {
-    for (size_t i = 0; i < count; ++i) {
-        output[i] = float(input[i]);
-    }
+    MayaUsdUtils::doubleToFloat(output, input, count);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -436,60 +433,7 @@ void MeshImportContext::applyHoleFaces()
 //----------------------------------------------------------------------------------------------------------------------
 void unzipUVs(const float* const uv, float* const u, float* const v, const size_t count)
 {
-#if AL_UTILS_ENABLE_SIMD
-
-#ifdef __AVX2__
-    const size_t count8 = count & ~7ULL;
-    size_t       i = 0, j = 0;
-    for (; i < count8; i += 8, j += 16) {
-        const f256 uva = loadu8f(uv + j);
-        const f256 uvb = loadu8f(uv + j + 8);
-        const f256 uva1 = permute2f128(uva, uvb, 0x20);
-        const f256 uvb1 = permute2f128(uva, uvb, 0x31);
-        const f256 uvals = shuffle8f(uva1, uvb1, 2, 0, 2, 0);
-        const f256 vvals = shuffle8f(uva1, uvb1, 3, 1, 3, 1);
-        storeu8f(u + i, uvals);
-        storeu8f(v + i, vvals);
-    }
-
-    if (count & 0x4) {
-        const f128 uva = loadu4f(uv + j);
-        const f128 uvb = loadu4f(uv + j + 4);
-        const f128 uvals = shuffle4f(uva, uvb, 2, 0, 2, 0);
-        const f128 vvals = shuffle4f(uva, uvb, 3, 1, 3, 1);
-        storeu4f(u + i, uvals);
-        storeu4f(v + i, vvals);
-        i += 4;
-        j += 8;
-    }
-#else
-
-    const size_t count4 = count & ~3ULL;
-    size_t       i = 0, j = 0;
-    for (; i < count4; i += 4, j += 8) {
-        const f128 uva = loadu4f(uv + j);
-        const f128 uvb = loadu4f(uv + j + 4);
-        const f128 uvals = shuffle4f(uva, uvb, 2, 0, 2, 0);
-        const f128 vvals = shuffle4f(uva, uvb, 3, 1, 3, 1);
-        storeu4f(u + i, uvals);
-        storeu4f(v + i, vvals);
-    }
-
-#endif
-
-    switch (count & 3) {
-    case 3: u[i + 2] = uv[j + 4]; v[i + 2] = uv[j + 5];
-    case 2: u[i + 1] = uv[j + 2]; v[i + 1] = uv[j + 3];
-    case 1: u[i] = uv[j]; v[i] = uv[j + 1];
-    default: break;
-    }
-
-#else
-    for (size_t i = 0, j = 0; i < count; ++i, j += 2) {
-        u[i] = uv[j];
-        v[i] = uv[j + 1];
-    }
-#endif
+    MayaUsdUtils::unzipUVs(uv, u, v, count);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -999,6 +943,7 @@ MeshExportContext::MeshExportContext(
     , subdivisionScheme(inSubdivisionScheme)
     , performDiff(performDiff)
     , reverseNormals(reverseNormals)
+    , m_writtenComponents(0)
 {
     MStatus status = fnMesh.setObject(path);
     valid = (status == MS::kSuccess);
@@ -1009,7 +954,11 @@ MeshExportContext::MeshExportContext(
     }
 
     if (!reverseNormals && fnMesh.findPlug("opposite", true).asBool()) {
-        mesh.CreateOrientationAttr().Set(UsdGeomTokens->leftHanded);
+        TfToken orientation;
+        if (!performDiff || !mesh.GetOrientationAttr().Get(&orientation)
+            || orientation != UsdGeomTokens->leftHanded) {
+            mesh.CreateOrientationAttr().Set(UsdGeomTokens->leftHanded);
+        }
     }
 
     TfToken subdToken;
@@ -1034,6 +983,24 @@ MeshExportContext::MeshExportContext(
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the time at which to author the given attribute: the time code of the export if
+///         the attribute is animated, the default time otherwise. A default value would be hidden by
+///         the time samples, while a single time sample would make a static attribute animated.
+static UsdTimeCode authoringTime(const UsdAttribute& attr, const UsdTimeCode timeCode)
+{
+    if (timeCode.IsDefault()) {
+        return timeCode;
+    }
+    double lower = 0.0, upper = 0.0;
+    bool   hasTimeSamples = false;
+    if (attr.GetBracketingTimeSamples(timeCode.GetValue(), &lower, &upper, &hasTimeSamples)
+        && hasTimeSamples) {
+        return timeCode;
+    }
+    return UsdTimeCode::Default();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void MeshExportContext::copyFaceConnectsAndPolyCounts()
 {
@@ -1044,7 +1011,8 @@ void MeshExportContext::copyFaceConnectsAndPolyCounts()
             &faceCounts[0],
             sizeof(uint32_t) * faceCounts.length());
         if (UsdAttribute vertextCounts = mesh.GetFaceVertexCountsAttr()) {
-            vertextCounts.Set(faceVertexCounts);
+            vertextCounts.Set(faceVertexCounts, authoringTime(vertextCounts, m_timeCode));
+            m_writtenComponents |= kFaceVertexCounts;
         }
     }
 
@@ -1055,7 +1023,9 @@ void MeshExportContext::copyFaceConnectsAndPolyCounts()
             &faceConnects[0],
             sizeof(uint32_t) * faceConnects.length());
         if (UsdAttribute faceVertexIndicies = mesh.GetFaceVertexIndicesAttr()) {
-            faceVertexIndicies.Set(faceVertexIndices);
+            faceVertexIndicies.Set(
+                faceVertexIndices, authoringTime(faceVertexIndicies, m_timeCode));
+            m_writtenComponents |= kFaceVertexIndices;
         }
     }
 }
@@ -1107,61 +1077,7 @@ bool isUvSetDataSparse(const int32_t* uvCounts, const uint32_t count)
 //----------------------------------------------------------------------------------------------------------------------
 void zipUVs(const float* u, const float* v, float* uv, const size_t count)
 {
-#if AL_UTILS_ENABLE_SIMD
-#ifdef __AVX2__
-
-    uint32_t uvCount8 = count & ~7U;
-
-    for (uint32_t i = 0; i < uvCount8; i += 8, uv += 16) {
-        const f256 U = loadu8f(u + i);
-        const f256 V = loadu8f(v + i);
-        const f256 uv0 = unpacklo8f(U, V);
-        const f256 uv1 = unpackhi8f(U, V);
-        storeu8f(uv, permute2f128(uv0, uv1, 0x20));
-        storeu8f(uv + 8, permute2f128(uv0, uv1, 0x31));
-    }
-
-    if (count & 0x4) {
-        const f128 U = loadu4f(u + uvCount8);
-        const f128 V = loadu4f(v + uvCount8);
-        storeu4f(uv, unpacklo4f(U, V));
-        storeu4f(uv + 4, unpackhi4f(U, V));
-        uv += 8;
-        uvCount8 += 4;
-    }
-
-    switch (count & 3) {
-    case 3: uv[4] = u[uvCount8 + 2]; uv[5] = v[uvCount8 + 2];
-    case 2: uv[2] = u[uvCount8 + 1]; uv[3] = v[uvCount8 + 1];
-    case 1: uv[0] = u[uvCount8 + 0]; uv[1] = v[uvCount8 + 0];
-    default: break;
-    }
-
-#else
-
-    const uint32_t uvCount4 = count & ~3U;
-
-    for (uint32_t i = 0; i < uvCount4; i += 4, uv += 8) {
-        const f128 U = loadu4f(u + i);
-        const f128 V = loadu4f(v + i);
-        storeu4f(uv, unpacklo4f(U, V));
-        storeu4f(uv + 4, unpackhi4f(U, V));
-    }
-
-    switch (count & 3) {
-    case 3: uv[4] = u[uvCount4 + 2]; uv[5] = v[uvCount4 + 2];
-    case 2: uv[2] = u[uvCount4 + 1]; uv[3] = v[uvCount4 + 1];
-    case 1: uv[0] = u[uvCount4 + 0]; uv[1] = v[uvCount4 + 0];
-    default: break;
-    }
-
-#endif
-#else
-    for (uint32_t i = 0, j = 0; i < count; i++, j += 2) {
-        uv[j] = u[i];
-        uv[j + 1] = v[i];
-    }
-#endif
+    MayaUsdUtils::zipUVs(u, v, uv, count);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1221,6 +1137,7 @@ void MeshExportContext::copyUvSetData()
                             SdfValueTypeNames->Float2Array,
                             UsdGeomTokens->constant);
                         uvSet.Set(uvValues, m_timeCode);
+                        m_writtenComponents |= kUvSets;
                     } else if (interpolation == UsdGeomTokens->vertex) {
                         if (uValues.length()) {
                             const uint32_t npoints = fnMesh.numVertices();
@@ -1246,6 +1163,7 @@ void MeshExportContext::copyUvSetData()
                                 SdfValueTypeNames->Float2Array,
                                 UsdGeomTokens->vertex);
                             uvSet.Set(uvValues, m_timeCode);
+                            m_writtenComponents |= kUvSets;
                         }
                     } else if (interpolation == UsdGeomTokens->uniform) {
                         const uint32_t nfaces = fnMesh.numPolygons();
@@ -1262,6 +1180,7 @@ void MeshExportContext::copyUvSetData()
                             SdfValueTypeNames->Float2Array,
                             UsdGeomTokens->uniform);
                         uvSet.Set(uvValues, m_timeCode);
+                        m_writtenComponents |= kUvSets;
                     } else {
                         uvValues.resize(uValues.length());
                         if (uvSetNames[i] == "map1") {
@@ -1280,11 +1199,13 @@ void MeshExportContext::copyUvSetData()
                             SdfValueTypeNames->Float2Array,
                             UsdGeomTokens->faceVarying);
                         uvSet.Set(uvValues);
+                        m_writtenComponents |= kUvSets;
 
                         VtArray<int32_t> uvIndices;
                         int32_t*         ptr = &uvIds[0];
                         uvIndices.assign(ptr, ptr + uvIds.length());
                         uvSet.SetIndices(uvIndices, m_timeCode);
+                        m_writtenComponents |= kUvSets;
                     }
                 }
             } else {
@@ -1299,6 +1220,7 @@ void MeshExportContext::copyUvSetData()
             uvValues.resize(1);
             fnMesh.getUV(0, uvValues[0][0], uvValues[0][1], &diff_report[i].setName());
             uvSet.Set(uvValues, m_timeCode);
+            m_writtenComponents |= kUvSets;
             uvSet.SetInterpolation(UsdGeomTokens->constant);
         } else if (diff_report[i].vertexInterpolation()) {
             const uint32_t npoints = fnMesh.numVertices();
@@ -1319,6 +1241,7 @@ void MeshExportContext::copyUvSetData()
                 }
             }
             uvSet.Set(uvValues, m_timeCode);
+            m_writtenComponents |= kUvSets;
             uvSet.SetInterpolation(UsdGeomTokens->vertex);
         } else if (diff_report[i].uniformInterpolation()) {
             const uint32_t nfaces = fnMesh.numPolygons();
@@ -1328,6 +1251,7 @@ void MeshExportContext::copyUvSetData()
                     j, 0, uvValues[j][0], uvValues[j][1], &diff_report[i].setName());
             }
             uvSet.Set(uvValues, m_timeCode);
+            m_writtenComponents |= kUvSets;
             uvSet.SetInterpolation(UsdGeomTokens->uniform);
         } else if (diff_report[i].faceVaryingInterpolation()) {
             // Initialize the VtArray to the max possible size (facevarying)
@@ -1346,6 +1270,7 @@ void MeshExportContext::copyUvSetData()
                             float* uvptr = (float*)uvValues.data();
                             zipUVs(uptr, vptr, uvptr, vValues.length());
                             uvSet.Set(uvValues, m_timeCode);
+                            m_writtenComponents |= kUvSets;
                         }
 
                         if (diff_report[i].indicesHaveChanged()) {
@@ -1353,6 +1278,7 @@ void MeshExportContext::copyUvSetData()
                             int32_t*         ptr = &uvIds[0];
                             uvIndices.assign(ptr, ptr + uvIds.length());
                             uvSet.SetIndices(uvIndices, m_timeCode);
+                            m_writtenComponents |= kUvSets;
                         }
                     }
                     uvSet.SetInterpolation(UsdGeomTokens->faceVarying);
@@ -1372,110 +1298,7 @@ void interleaveIndexedUvData(
     const int32_t* indices,
     const uint32_t numIndices)
 {
-#if AL_UTILS_ENABLE_SIMD
-
-#if defined(__AVX2__) && ENABLE_SOME_AVX_ROUTINES
-
-    const uint32_t numIndices8 = numIndices & ~7;
-    uint32_t       i = 0;
-    for (; i < numIndices8; i += 8, output += 16) {
-        const i256 I = loadu8i(indices + i);
-        const f256 U = i32gather8f(u, I);
-        const f256 V = i32gather8f(v, I);
-        const f256 uv0 = unpacklo8f(U, V);
-        const f256 uv1 = unpackhi8f(U, V);
-        storeu8f(output, permute2f128(uv0, uv1, 0x20));
-        storeu8f(output + 8, permute2f128(uv0, uv1, 0x31));
-    }
-
-    if (numIndices & 0x4) {
-        const i128 I = loadu4i(indices + i);
-        const f128 U = i32gather4f(u, I);
-        const f128 V = i32gather4f(v, I);
-        const f128 uv0 = unpacklo4f(U, V);
-        const f128 uv1 = unpackhi4f(U, V);
-        storeu4f(output, uv0);
-        storeu4f(output + 4, uv1);
-        output += 8;
-        i += 4;
-    }
-
-#else
-
-    const i128 uptr = splat2i64(intptr_t(u));
-    const i128 vptr = splat2i64(intptr_t(v));
-    const i128 mask = set4i(0xFFFFFFFF, 0, 0xFFFFFFFF, 0);
-
-    const uint32_t numIndices4 = numIndices & ~3;
-    uint32_t       i = 0;
-    for (; i < numIndices4; i += 4, output += 8) {
-        // load 4 indices
-        const i128 I = loadu4i(indices + i);
-
-        // mask out into 2 pairs of 64 bit indices, and scale values by 4 (using shift)
-        const i128 I02 = lshift64(and4i(mask, I), 2);
-        const i128 I13 = lshift64(and4i(mask, shiftBytesRight(I, 4)), 2);
-
-        // get addresses by adding the base offset
-        const i128 U02 = add2i64(I02, uptr);
-        const i128 U13 = add2i64(I13, uptr);
-        const i128 V02 = add2i64(I02, vptr);
-        const i128 V13 = add2i64(I13, vptr);
-
-#ifndef __SSE4_1__
-        ALIGN16(float* ptrs[8]);
-        store4i(ptrs, U02);
-        store4i(ptrs + 2, U13);
-        store4i(ptrs + 4, V02);
-        store4i(ptrs + 6, V13);
-
-        const f128 u0 = load1f(ptrs[0]);
-        const f128 u2 = load1f(ptrs[1]);
-        const f128 u1 = load1f(ptrs[2]);
-        const f128 u3 = load1f(ptrs[3]);
-        const f128 v0 = load1f(ptrs[4]);
-        const f128 v2 = load1f(ptrs[5]);
-        const f128 v1 = load1f(ptrs[6]);
-        const f128 v3 = load1f(ptrs[7]);
-#else
-#define extract_float_ptr(reg, index) reinterpret_cast<const float*>(_mm_extract_epi64(reg, index))
-        const f128 u0 = load1f(extract_float_ptr(U02, 0));
-        const f128 u2 = load1f(extract_float_ptr(U02, 1));
-        const f128 u1 = load1f(extract_float_ptr(U13, 0));
-        const f128 u3 = load1f(extract_float_ptr(U13, 1));
-        const f128 v0 = load1f(extract_float_ptr(V02, 0));
-        const f128 v2 = load1f(extract_float_ptr(V02, 1));
-        const f128 v1 = load1f(extract_float_ptr(V13, 0));
-        const f128 v3 = load1f(extract_float_ptr(V13, 1));
-#undef extract_ptr
-#endif
-
-        const f128 uv0 = unpacklo4f(u0, v0);
-        const f128 uv1 = unpacklo4f(u1, v1);
-        storeu4f(output, movelh4f(uv0, uv1));
-
-        const f128 uv2 = unpacklo4f(u2, v2);
-        const f128 uv3 = unpacklo4f(u3, v3);
-        storeu4f(output + 4, movelh4f(uv2, uv3));
-    }
-
-#endif
-
-    switch (numIndices & 0x3) {
-    case 3: output[4] = u[indices[i + 2]]; output[5] = v[indices[i + 2]];
-    case 2: output[2] = u[indices[i + 1]]; output[3] = v[indices[i + 1]];
-    case 1: output[0] = u[indices[i]]; output[1] = v[indices[i]];
-    default: break;
-    }
-
-#else
-
-    for (uint32_t i = 0, j = 0; i < numIndices; ++i, j += 2) {
-        output[j] = u[indices[i]];
-        output[j + 1] = v[indices[i]];
-    }
-
-#endif
+    MayaUsdUtils::interleaveIndexedUvData(output, u, v, indices, numIndices);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1607,6 +1430,7 @@ void MeshExportContext::copyColourSetData(
                     SdfValueTypeNames->Color3fArray,
                     interpolation);
                 colourSet.Set(colourValues, m_timeCode);
+                m_writtenComponents |= kColourSets;
             }
             if (MFnMesh::kRGBA == representation) {
                 VtArray<float> alphaValues;
@@ -1633,6 +1457,7 @@ void MeshExportContext::copyColourSetData(
                 UsdGeomPrimvar opacitySet = UsdGeomPrimvarsAPI(mesh).CreatePrimvar(
                     displayOpacityToken, SdfValueTypeNames->FloatArray, interpolation);
                 opacitySet.Set(alphaValues, m_timeCode);
+                m_writtenComponents |= kColourSets;
             }
 
         } else {
@@ -1662,6 +1487,7 @@ void MeshExportContext::copyColourSetData(
                 SdfValueTypeNames->Color4fArray,
                 interpolation);
             colourSet.Set(colourValues, m_timeCode);
+            m_writtenComponents |= kColourSets;
         }
     }
 
@@ -1712,6 +1538,7 @@ void MeshExportContext::copyColourSetData(
                 SdfValueTypeNames->Color3fArray,
                 interp);
             colourSet.Set(colourValues, m_timeCode);
+            m_writtenComponents |= kColourSets;
         } else {
             VtArray<GfVec4f> colourValues;
             if (interp == UsdGeomTokens->constant) {
@@ -1737,6 +1564,7 @@ void MeshExportContext::copyColourSetData(
                 SdfValueTypeNames->Color4fArray,
                 interp);
             colourSet.Set(colourValues, m_timeCode);
+            m_writtenComponents |= kColourSets;
         }
     }
 }
@@ -1753,6 +1581,7 @@ void MeshExportContext::copyInvisibleHoles()
             uint32_t*        ptr = &mayaHoles[0];
             memcpy((int32_t*)subdHoles.data(), ptr, count * sizeof(uint32_t));
             mesh.GetHoleIndicesAttr().Set(subdHoles, m_timeCode);
+            m_writtenComponents |= kHoleIndices;
         }
     }
 }
@@ -1770,12 +1599,14 @@ void MeshExportContext::copyCreaseVertices()
                 AL::usdmaya::utils::doubleToFloat(
                     subdCornerSharpnesses.data(), &creaseData[0], creaseData.length());
                 mesh.GetCornerSharpnessesAttr().Set(subdCornerSharpnesses, m_timeCode);
+                m_writtenComponents |= kCornerSharpness;
             }
 
             if (diffMesh & kCornerIndices) {
                 VtArray<int> subdCornerIndices(vertIds.length());
                 memcpy(subdCornerIndices.data(), &vertIds[0], vertIds.length() * sizeof(int32_t));
                 mesh.GetCornerIndicesAttr().Set(subdCornerIndices, m_timeCode);
+                m_writtenComponents |= kCornerIndices;
             }
         }
     }
@@ -1797,6 +1628,7 @@ void MeshExportContext::copyCreaseEdges()
                 AL::usdmaya::utils::doubleToFloat(
                     usdCreaseValues.data(), (double*)&creaseData[0], creaseData.length());
                 mesh.GetCreaseSharpnessesAttr().Set(usdCreaseValues, m_timeCode);
+                m_writtenComponents |= kCreaseWeights;
             }
 
             if (diffMesh & kCreaseIndices) {
@@ -1812,6 +1644,7 @@ void MeshExportContext::copyCreaseEdges()
                 }
 
                 creases.Set(usdCreaseIndices, m_timeCode);
+                m_writtenComponents |= kCreaseIndices;
             }
 
             // Note: In the original USD maya bridge, they actually attempt to merge creases.
@@ -1823,6 +1656,7 @@ void MeshExportContext::copyCreaseEdges()
                 lengths.resize(creaseData.length());
                 std::fill(lengths.begin(), lengths.end(), 2);
                 creasesLengths.Set(lengths, m_timeCode);
+                m_writtenComponents |= kCreaseLengths;
             }
         }
     }
@@ -1869,6 +1703,7 @@ void MeshExportContext::copyVertexData(UsdTimeCode time)
                 const GfVec3f*   vecData = reinterpret_cast<const GfVec3f*>(pointsData);
                 VtArray<GfVec3f> points(vecData, vecData + numVertices);
                 pointsAttr.Set(points, time);
+                m_writtenComponents |= kPoints;
             } else {
                 MGlobal::displayError(
                     MString("Unable to access mesh vertices on mesh: ") + fnMesh.fullPathName());
@@ -1885,13 +1720,12 @@ void MeshExportContext::copyExtentData(UsdTimeCode time)
             MStatus      status;
             const float* pointsData = fnMesh.getRawPoints(&status);
             if (status) {
-                const GfVec3f*   vecData = reinterpret_cast<const GfVec3f*>(pointsData);
-                const uint32_t   numVertices = fnMesh.numVertices();
-                VtArray<GfVec3f> points(vecData, vecData + numVertices);
-
+                const GfRange3f  range = computeExtent(pointsData, fnMesh.numVertices());
                 VtArray<GfVec3f> extent(2);
-                UsdGeomPointBased::ComputeExtent(points, &extent);
+                extent[0] = range.GetMin();
+                extent[1] = range.GetMax();
                 extentAttr.Set(extent, time);
+                m_writtenComponents |= kExtent;
             } else {
                 MGlobal::displayError(
                     MString("Unable to access mesh vertices on mesh: ") + fnMesh.fullPathName());
@@ -1917,6 +1751,7 @@ void MeshExportContext::copyBindPoseData(UsdTimeCode time)
                 VtArray<GfVec3f> points(vecData, vecData + numVertices);
 
                 pRefPrimVarAttr.Set(points, time);
+                m_writtenComponents |= kBindPose;
             } else {
                 MGlobal::displayError(
                     MString("Unable to access mesh vertices on mesh: ") + fnMesh.fullPathName());
@@ -2102,6 +1937,7 @@ void MeshExportContext::copyNormalData(UsdTimeCode time, bool copyAsPrimvar)
                     }
                     normalsAttr.Set(normals, time);
                 }
+                m_writtenComponents |= kNormals;
             } else {
                 MGlobal::displayError(
                     MString("Unable to access mesh normals on mesh: ") + fnMesh.fullPathName());
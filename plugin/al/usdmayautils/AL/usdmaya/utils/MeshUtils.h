@@ -267,7 +267,9 @@ public:
     AL_USDMAYA_UTILS_PUBLIC
     void copyCreaseVertices();
 
-    /// \brief  copies the face connects and counts information from maya into the usd prim.
+    /// \brief  copies the face connects and counts information from maya into the usd prim. They are
+    ///         authored at the time code of the context if they are animated, at the default time
+    ///         otherwise.
     AL_USDMAYA_UTILS_PUBLIC
     void copyFaceConnectsAndPolyCounts();
 
@@ -312,6 +314,15 @@ public:
     /// \brief  returns the time code
     UsdTimeCode timeCode() const { return m_timeCode; }
 
+    /// \brief  returns the components (a combination of DiffComponents bits) that the copy methods
+    ///         have authored into the usd prim so far. When performing a diff, unchanged components
+    ///         are skipped, and so are not part of the returned value.
+    uint32_t writtenComponents() const { return m_writtenComponents; }
+
+    /// \brief  returns the components (a combination of DiffComponents bits) found to differ
+    ///         between maya and usd. All components are returned when not performing a diff.
+    uint32_t changedComponents() const { return diffGeom | diffMesh; }
+
 private:
     MFnMesh           fnMesh;       ///< the maya function set
     MIntArray         faceCounts;   ///< the number of verts in each face
@@ -325,6 +336,8 @@ private:
     bool              valid;          ///< true if the function set is ok
     bool              performDiff;    ///< true if performing a diff on export
     bool              reverseNormals; ///< true if reversing normals on 'opposite' meshes
+    // the components authored by the copy methods
+    uint32_t m_writtenComponents;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,119 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsdUtils/DiffPrims.h>
+#include <mayaUsdUtils/MergePrims.h>
+#include <mayaUsdUtils/MergePrimsOptions.h>
+
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/valueTypeName.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const SdfPath rootPath("/root");
+
+// A hierarchy of groups of prims, each with a few scalar and array
+// attributes, similar to what an edit-as-Maya session exports.
+void populate(const UsdStageRefPtr& stage, size_t count, bool modified)
+{
+    const size_t groupSize = 100;
+    stage->DefinePrim(rootPath, TfToken("Xform"));
+    for (size_t i = 0; i < count; ++i) {
+        const SdfPath groupPath
+            = rootPath.AppendChild(TfToken("group" + std::to_string(i / groupSize)));
+        if (i % groupSize == 0)
+            stage->DefinePrim(groupPath, TfToken("Xform"));
+
+        UsdPrim prim = stage->DefinePrim(
+            groupPath.AppendChild(TfToken("prim" + std::to_string(i))), TfToken("Mesh"));
+
+        // One prim in ten differs between the modified and baseline stages.
+        const bool   differs = modified && (i % 10 == 0);
+        const double value = differs ? double(i) + 0.5 : double(i);
+        prim.CreateAttribute(TfToken("value"), SdfValueTypeNames->Double).Set(value);
+        prim.CreateAttribute(TfToken("label"), SdfValueTypeNames->String)
+            .Set(std::string("prim") + std::to_string(i));
+
+        VtIntArray indices(64);
+        for (size_t j = 0; j < indices.size(); ++j)
+            indices[j] = int(j + (differs ? 1 : 0));
+        prim.CreateAttribute(TfToken("indices"), SdfValueTypeNames->IntArray).Set(indices);
+    }
+}
+
+} // namespace
+
+MAYAUSD_BENCHMARK(DiffPrims_children, false, 1000, 10000)
+{
+    UsdStageRefPtr modified = UsdStage::CreateInMemory();
+    UsdStageRefPtr baseline = UsdStage::CreateInMemory();
+    populate(modified, state.size(), true);
+    populate(baseline, state.size(), false);
+
+    size_t nbDiffs = 0;
+    state.measure([&]() {
+        nbDiffs = 0;
+        for (const UsdPrim& group : modified->GetPrimAtPath(rootPath).GetChildren()) {
+            const UsdPrim baselineGroup = baseline->GetPrimAtPath(group.GetPath());
+            for (const UsdPrim& prim : group.GetChildren()) {
+                const UsdPrim baselinePrim = baselineGroup.GetChild(prim.GetName());
+                if (MayaUsdUtils::comparePrims(prim, baselinePrim)
+                    != MayaUsdUtils::DiffResult::Same)
+                    ++nbDiffs;
+            }
+        }
+    });
+    state.setCounter("differentPrims", double(nbDiffs));
+}
+
+MAYAUSD_BENCHMARK(MergePrims_children, false, 1000, 10000)
+{
+    UsdStageRefPtr modified = UsdStage::CreateInMemory();
+    populate(modified, state.size(), true);
+
+    UsdStageRefPtr baselineContent = UsdStage::CreateInMemory();
+    populate(baselineContent, state.size(), false);
+
+    UsdStageRefPtr baseline = UsdStage::CreateInMemory();
+
+    MayaUsdUtils::MergePrimsOptions options;
+    options.verbosity = MayaUsdUtils::MergeVerbosity::None;
+    options.mergeChildren = true;
+
+    // Each run merges into a fresh copy of the baseline.
+    state.measure(
+        [&]() {
+            MayaUsdUtils::mergePrims(
+                modified,
+                modified->GetRootLayer(),
+                rootPath,
+                baseline,
+                baseline->GetRootLayer(),
+                rootPath,
+                options);
+        },
+        [&]() { baseline->GetRootLayer()->TransferContent(baselineContent->GetRootLayer()); });
+}
@@ -0,0 +1,145 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsd/fileio/importData.h>
+#include <mayaUsd/fileio/jobs/jobArgs.h>
+#include <mayaUsd/fileio/jobs/readJob.h>
+#include <mayaUsd/fileio/jobs/writeJob.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <maya/MDagPath.h>
+#include <maya/MFileIO.h>
+#include <maya/MFnMesh.h>
+#include <maya/MGlobal.h>
+#include <maya/MIntArray.h>
+#include <maya/MItDag.h>
+#include <maya/MSelectionList.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Replace the Maya scene by a grid of polygon spheres, each with its UVs and
+// a color set, of 32 x 32 subdivisions, i.e. about 1000 faces.
+void createMeshes(size_t count)
+{
+    MFileIO::newFile(true);
+    const std::string script = "for ($i = 0; $i < " + std::to_string(count)
+        + "; ++$i) {\n"
+          "    string $sphere[] = `polySphere -sx 32 -sy 32`;\n"
+          "    move ($i % 32 * 3) 0 ($i / 32 * 3) $sphere[0];\n"
+          "    polyColorPerVertex -rgb 0.8 0.2 0.1 -cdo $sphere[0];\n"
+          "}";
+    MGlobal::executeCommand(script.c_str());
+}
+
+UsdMayaUtil::MDagPathSet meshTransforms()
+{
+    UsdMayaUtil::MDagPathSet dagPaths;
+    for (MItDag it(MItDag::kDepthFirst, MFn::kMesh); !it.isDone(); it.next()) {
+        MDagPath dagPath;
+        it.getPath(dagPath);
+        dagPath.pop();
+        dagPaths.insert(dagPath);
+    }
+    return dagPaths;
+}
+
+std::string tmpFileName(const char* suffix)
+{
+    return ArchMakeTmpFileName("mayaUsdBenchmarks", suffix);
+}
+
+bool writeMeshes(const std::string& fileName)
+{
+    const UsdMayaJobExportArgs args
+        = UsdMayaJobExportArgs::CreateFromDictionary(VtDictionary(), meshTransforms());
+    UsdMaya_WriteJob job(args);
+    return job.Write(fileName, /* append = */ false);
+}
+
+} // namespace
+
+MAYAUSD_BENCHMARK(WriteJob_meshes, true, 10, 100, 500)
+{
+    createMeshes(state.size());
+    const std::string fileName = tmpFileName(".usdc");
+
+    state.measure([&fileName]() { writeMeshes(fileName); });
+
+    TfDeleteFile(fileName);
+}
+
+MAYAUSD_BENCHMARK(ReadJob_meshes, true, 10, 100, 500)
+{
+    createMeshes(state.size());
+    const std::string fileName = tmpFileName(".usdc");
+    writeMeshes(fileName);
+
+    const UsdMayaJobImportArgs args
+        = UsdMayaJobImportArgs::CreateFromDictionary(VtDictionary(), false, GfInterval());
+
+    state.measure(
+        [&fileName, &args]() {
+            MayaUsd::ImportData   importData(fileName);
+            UsdMaya_ReadJob       job(importData, args);
+            std::vector<MDagPath> addedDagPaths;
+            job.Read(&addedDagPaths);
+        },
+        []() { MFileIO::newFile(true); });
+
+    TfDeleteFile(fileName);
+}
+
+MAYAUSD_BENCHMARK(CompressFaceVaryingPrimvarIndices, true, 64, 256, 1024)
+{
+    // A single sphere of size x size subdivisions, with one value per vertex
+    // on its face-vertices, which is the most expensive case to detect.
+    MFileIO::newFile(true);
+    const std::string size = std::to_string(state.size());
+    MGlobal::executeCommand(("polySphere -sx " + size + " -sy " + size + " -n bench").c_str());
+
+    MSelectionList selection;
+    selection.add("benchShape");
+    MDagPath dagPath;
+    selection.getDagPath(0, dagPath);
+    MFnMesh mesh(dagPath);
+
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    mesh.getVertices(faceVertexCounts, faceVertexIndices);
+    VtIntArray assignmentIndices(faceVertexIndices.length());
+    for (unsigned int i = 0; i < faceVertexIndices.length(); ++i) {
+        assignmentIndices[i] = faceVertexIndices[i];
+    }
+
+    size_t compressed = 0;
+    state.measure([&]() {
+        TfToken    interpolation = UsdGeomTokens->faceVarying;
+        VtIntArray indices = assignmentIndices;
+        UsdMayaUtil::CompressFaceVaryingPrimvarIndices(mesh, &interpolation, &indices);
+        compressed = indices.size();
+    });
+    state.setCounter("faceVertices", double(assignmentIndices.size()));
+    state.setCounter("compressedIndices", double(compressed));
+}
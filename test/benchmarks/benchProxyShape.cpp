@@ -0,0 +1,150 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsd/nodes/proxyShapeBase.h>
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/cube.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <maya/MBoundingBox.h>
+#include <maya/MDagPath.h>
+#include <maya/MFileIO.h>
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
+
+#include <ufe/observer.h>
+#include <ufe/scene.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Write a layer with a grid of count cubes, under groups of 100.
+std::string writeCubes(size_t count)
+{
+    const std::string fileName = ArchMakeTmpFileName("mayaUsdBenchmarks", ".usdc");
+    UsdStageRefPtr    stage = UsdStage::CreateNew(fileName);
+
+    const size_t groupSize = 100;
+    for (size_t i = 0; i < count; ++i) {
+        const SdfPath groupPath("/group" + std::to_string(i / groupSize));
+        if (i % groupSize == 0)
+            UsdGeomXform::Define(stage, groupPath);
+
+        const SdfPath cubePath = groupPath.AppendChild(TfToken("cube" + std::to_string(i)));
+        UsdGeomCube   cube = UsdGeomCube::Define(stage, cubePath);
+        cube.AddTranslateOp().Set(GfVec3d(double(i % 32) * 3.0, 0.0, double(i / 32) * 3.0));
+    }
+    stage->GetRootLayer()->Save();
+    return fileName;
+}
+
+// Replace the Maya scene by a proxy shape on the file.
+MayaUsdProxyShapeBase* createProxyShape(const std::string& fileName)
+{
+    MFileIO::newFile(true);
+    MGlobal::executeCommand("createNode transform -n bench; "
+                            "createNode mayaUsdProxyShape -p bench -n benchShape;");
+    MGlobal::executeCommand(
+        ("setAttr -type \"string\" benchShape.filePath \"" + fileName + "\"").c_str());
+
+    MSelectionList selection;
+    selection.add("benchShape");
+    MDagPath dagPath;
+    selection.getDagPath(0, dagPath);
+    return MayaUsdProxyShapeBase::GetShapeAtDagPath(dagPath);
+}
+
+class CountingObserver : public Ufe::Observer
+{
+public:
+    void operator()(const Ufe::Notification&) override { ++count; }
+
+    size_t count = 0;
+};
+
+} // namespace
+
+MAYAUSD_BENCHMARK(ProxyShape_boundingBox, true, 1000, 10000, 50000)
+{
+    const std::string      fileName = writeCubes(state.size());
+    MayaUsdProxyShapeBase* proxyShape = createProxyShape(fileName);
+    if (!proxyShape || !proxyShape->getUsdStage())
+        return;
+
+    // Each run computes the bounds from the stage, not from the cache.
+    state.measure(
+        [proxyShape]() { proxyShape->boundingBox(); },
+        [proxyShape]() { proxyShape->clearBoundingBoxCache(); });
+
+    MFileIO::newFile(true);
+    TfDeleteFile(fileName);
+}
+
+MAYAUSD_BENCHMARK(StagesSubject_notifications, true, 100, 1000, 10000)
+{
+    // The observers stand for the Outliner, the Attribute Editor and the
+    // other UI that listen to the UFE scene.
+    const size_t nbObservers = 8;
+
+    const std::string      fileName = writeCubes(1);
+    MayaUsdProxyShapeBase* proxyShape = createProxyShape(fileName);
+    UsdStageRefPtr         stage = proxyShape ? proxyShape->getUsdStage() : UsdStageRefPtr();
+    if (!stage)
+        return;
+
+    std::vector<std::shared_ptr<CountingObserver>> observers;
+    for (size_t i = 0; i < nbObservers; ++i) {
+        observers.push_back(std::make_shared<CountingObserver>());
+        Ufe::Scene::instance().addObserver(observers.back());
+    }
+
+    // Author all the prims in a single change block, as the import and merge
+    // commands do, so that the cost is in the fan-out of the notifications.
+    const SdfPath rootPath("/added");
+    state.measure(
+        [&]() {
+            for (const auto& observer : observers)
+                observer->count = 0;
+            SdfChangeBlock    changeBlock;
+            SdfPrimSpecHandle root = SdfCreatePrimInLayer(stage->GetRootLayer(), rootPath);
+            root->SetSpecifier(SdfSpecifierDef);
+            for (size_t i = 0; i < state.size(); ++i)
+                SdfPrimSpec::New(root, "prim" + std::to_string(i), SdfSpecifierDef);
+        },
+        [&]() { stage->RemovePrim(rootPath); });
+
+    size_t nbNotifications = 0;
+    for (const auto& observer : observers) {
+        nbNotifications += observer->count;
+        Ufe::Scene::instance().removeObserver(observer);
+    }
+    state.setCounter("notificationsPerObserver", double(nbNotifications) / nbObservers);
+
+    MFileIO::newFile(true);
+    TfDeleteFile(fileName);
+}
@@ -0,0 +1,261 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <pxr/base/js/json.h>
+#include <pxr/base/js/value.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace MayaUsdBenchmarks {
+
+namespace {
+
+std::vector<Benchmark>& registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+double toDouble(const JsValue& value)
+{
+    if (value.IsReal())
+        return value.GetReal();
+    if (value.IsInt())
+        return static_cast<double>(value.GetInt64());
+    return 0.0;
+}
+
+const JsValue& member(const JsObject& object, const std::string& key)
+{
+    static const JsValue null;
+    const auto           found = object.find(key);
+    return (found == object.end()) ? null : found->second;
+}
+
+} // namespace
+
+double Result::minMs() const
+{
+    return timesMs.empty() ? 0.0 : *std::min_element(timesMs.begin(), timesMs.end());
+}
+
+double Result::medianMs() const
+{
+    if (timesMs.empty())
+        return 0.0;
+    std::vector<double> sorted(timesMs);
+    std::sort(sorted.begin(), sorted.end());
+    const size_t middle = sorted.size() / 2;
+    return (sorted.size() % 2) ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+}
+
+double Result::meanMs() const
+{
+    if (timesMs.empty())
+        return 0.0;
+    return std::accumulate(timesMs.begin(), timesMs.end(), 0.0) / timesMs.size();
+}
+
+State::State(Result& result, size_t repetitions)
+    : _result(result)
+    , _repetitions(std::max<size_t>(repetitions, 1))
+{
+}
+
+void State::measure(const std::function<void()>& body, const std::function<void()>& reset)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // The first run fills the caches, e.g. the plugin registries, and is not recorded.
+    for (size_t i = 0; i <= _repetitions; ++i) {
+        if (reset)
+            reset();
+        const Clock::time_point start = Clock::now();
+        body();
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (i > 0)
+            _result.timesMs.push_back(ms);
+    }
+}
+
+bool registerBenchmark(
+    const std::string&  name,
+    std::vector<size_t> sizes,
+    bool                needsMaya,
+    BenchmarkFn         fn)
+{
+    registry().push_back({ name, std::move(sizes), needsMaya, std::move(fn) });
+    return true;
+}
+
+const std::vector<Benchmark>& benchmarks() { return registry(); }
+
+bool writeResults(
+    const std::string&                        fileName,
+    const std::map<std::string, std::string>& info,
+    const std::vector<Result>&                results)
+{
+    JsObject infoJson;
+    for (const auto& entry : info)
+        infoJson[entry.first] = JsValue(entry.second);
+
+    JsArray resultsJson;
+    for (const Result& result : results) {
+        JsObject resultJson;
+        resultJson["name"] = JsValue(result.name);
+        resultJson["size"] = JsValue(static_cast<int64_t>(result.size));
+        resultJson["minMs"] = JsValue(result.minMs());
+        resultJson["medianMs"] = JsValue(result.medianMs());
+        resultJson["meanMs"] = JsValue(result.meanMs());
+
+        JsArray timesJson;
+        for (double ms : result.timesMs)
+            timesJson.push_back(JsValue(ms));
+        resultJson["timesMs"] = JsValue(timesJson);
+
+        JsObject countersJson;
+        for (const auto& counter : result.counters)
+            countersJson[counter.first] = JsValue(counter.second);
+        resultJson["counters"] = JsValue(countersJson);
+
+        resultsJson.push_back(JsValue(resultJson));
+    }
+
+    JsObject json;
+    json["info"] = JsValue(infoJson);
+    json["results"] = JsValue(resultsJson);
+
+    std::ofstream file(fileName);
+    if (!file) {
+        fprintf(stderr, "Unable to write the benchmark results to %s\n", fileName.c_str());
+        return false;
+    }
+    JsWriteToStream(JsValue(json), file);
+    file << std::endl;
+    return bool(file);
+}
+
+bool readResults(const std::string& fileName, std::vector<Result>& results)
+{
+    std::ifstream file(fileName);
+    if (!file) {
+        fprintf(stderr, "Unable to read the benchmark results from %s\n", fileName.c_str());
+        return false;
+    }
+
+    JsParseError  error;
+    const JsValue json = JsParseStream(file, &error);
+    if (!json.IsObject()) {
+        fprintf(
+            stderr,
+            "Invalid benchmark results in %s, line %u: %s\n",
+            fileName.c_str(),
+            error.line,
+            error.reason.c_str());
+        return false;
+    }
+
+    const JsValue& resultsJson = member(json.GetJsObject(), "results");
+    if (!resultsJson.IsArray())
+        return false;
+
+    for (const JsValue& resultJson : resultsJson.GetJsArray()) {
+        if (!resultJson.IsObject())
+            continue;
+        const JsObject& object = resultJson.GetJsObject();
+
+        Result result;
+        if (member(object, "name").IsString())
+            result.name = member(object, "name").GetString();
+        result.size = static_cast<size_t>(toDouble(member(object, "size")));
+        if (member(object, "timesMs").IsArray()) {
+            for (const JsValue& ms : member(object, "timesMs").GetJsArray())
+                result.timesMs.push_back(toDouble(ms));
+        }
+        if (member(object, "counters").IsObject()) {
+            for (const auto& counter : member(object, "counters").GetJsObject())
+                result.counters[counter.first] = toDouble(counter.second);
+        }
+        results.push_back(std::move(result));
+    }
+    return true;
+}
+
+int compareResults(
+    const std::vector<Result>& results,
+    const std::vector<Result>& baseline,
+    double                     tolerance)
+{
+    int regressions = 0;
+    printf("%-48s %10s %12s %12s %8s\n", "benchmark", "size", "baseline ms", "median ms", "ratio");
+    for (const Result& result : results) {
+        const auto reference
+            = std::find_if(baseline.begin(), baseline.end(), [&result](const Result& r) {
+                  return r.name == result.name && r.size == result.size;
+              });
+        if (reference == baseline.end() || reference->medianMs() <= 0.0) {
+            printf(
+                "%-48s %10zu %12s %12.3f %8s\n",
+                result.name.c_str(),
+                result.size,
+                "-",
+                result.medianMs(),
+                "new");
+            continue;
+        }
+
+        const double ratio = result.medianMs() / reference->medianMs();
+        const bool   regressed = ratio > 1.0 + tolerance;
+        regressions += regressed ? 1 : 0;
+        printf(
+            "%-48s %10zu %12.3f %12.3f %8.2f%s\n",
+            result.name.c_str(),
+            result.size,
+            reference->medianMs(),
+            result.medianMs(),
+            ratio,
+            regressed ? "  REGRESSION" : "");
+    }
+
+    // A benchmark of the baseline that did not run, e.g. because it was
+    // renamed or its sizes changed, would otherwise go unnoticed.
+    for (const Result& reference : baseline) {
+        const auto found
+            = std::find_if(results.begin(), results.end(), [&reference](const Result& r) {
+                  return r.name == reference.name && r.size == reference.size;
+              });
+        if (found == results.end()) {
+            ++regressions;
+            printf(
+                "%-48s %10zu %12.3f %12s %8s  MISSING\n",
+                reference.name.c_str(),
+                reference.size,
+                reference.medianMs(),
+                "-",
+                "-");
+        }
+    }
+    return regressions;
+}
+
+} // namespace MayaUsdBenchmarks
@@ -0,0 +1,110 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace MayaUsdBenchmarks {
+
+/// \brief Timings and counters measured by one run of a benchmark, for one size.
+struct Result
+{
+    std::string                   name;
+    size_t                        size = 0;
+    std::vector<double>           timesMs;
+    std::map<std::string, double> counters;
+
+    double minMs() const;
+    double medianMs() const;
+    double meanMs() const;
+};
+
+/// \brief Passed to the benchmark functions, to measure their body.
+///
+/// The benchmark function builds its synthetic scene for size(), which is not
+/// timed, then calls measure() with the code to time.
+class State
+{
+public:
+    State(Result& result, size_t repetitions);
+
+    /// \brief The size of the synthetic scene, e.g. a number of meshes or prims.
+    size_t size() const { return _result.size; }
+
+    /// \brief Time body() repetitions times, after a warm-up run. The optional
+    ///        reset() is called before each run and is not timed.
+    void measure(const std::function<void()>& body, const std::function<void()>& reset = {});
+
+    /// \brief Record an extra metric of the run, e.g. a number of notifications.
+    void setCounter(const std::string& name, double value) { _result.counters[name] = value; }
+
+private:
+    Result& _result;
+    size_t  _repetitions;
+};
+
+using BenchmarkFn = std::function<void(State&)>;
+
+struct Benchmark
+{
+    std::string         name;
+    std::vector<size_t> sizes;
+    bool                needsMaya = false;
+    BenchmarkFn         fn;
+};
+
+/// \brief Add a benchmark to the suite, run for each of the given sizes.
+///        Benchmarks that do not need Maya can run without initializing it.
+bool registerBenchmark(
+    const std::string&  name,
+    std::vector<size_t> sizes,
+    bool                needsMaya,
+    BenchmarkFn         fn);
+
+const std::vector<Benchmark>& benchmarks();
+
+/// \brief Write the results as JSON, with information on how they were measured,
+///        e.g. the versions of Maya and USD.
+bool writeResults(
+    const std::string&                        fileName,
+    const std::map<std::string, std::string>& info,
+    const std::vector<Result>&                results);
+
+/// \brief Read results previously written by writeResults().
+bool readResults(const std::string& fileName, std::vector<Result>& results);
+
+/// \brief Compare the median times with a baseline and print the differences.
+/// \return the number of results slower than the baseline by more than the tolerance,
+///         e.g. 0.1 for 10%, plus the number of baseline entries without a result.
+int compareResults(
+    const std::vector<Result>& results,
+    const std::vector<Result>& baseline,
+    double                     tolerance);
+
+} // namespace MayaUsdBenchmarks
+
+/// \brief Define and register a benchmark, from its name, whether it needs Maya and its sizes:
+///
+///     MAYAUSD_BENCHMARK(WriteJob_meshes, true, 10, 100) { ... state.measure(...); }
+#define MAYAUSD_BENCHMARK(NAME, NEEDS_MAYA, ...)                              \
+    static void       NAME(MayaUsdBenchmarks::State& state);                   \
+    static const bool NAME##_registered = MayaUsdBenchmarks::registerBenchmark( \
+        #NAME, { __VA_ARGS__ }, NEEDS_MAYA, NAME);                              \
+    static void NAME(MayaUsdBenchmarks::State& state)
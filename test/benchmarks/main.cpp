@@ -0,0 +1,209 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <pxr/pxr.h>
+
+#include <maya/MGlobal.h>
+#include <maya/MLibrary.h>
+#include <maya/MString.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+
+#if !defined(MAYAUSD_VERSION)
+#error "MAYAUSD_VERSION is not defined"
+#endif
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+using namespace MayaUsdBenchmarks;
+
+namespace {
+
+void usage(const char* program)
+{
+    printf(
+        "Usage: %s [options]\n"
+        "  --list               list the benchmarks and exit\n"
+        "  --filter <text>      only run the benchmarks whose name contains the text\n"
+        "  --quick              only run the smallest size of each benchmark\n"
+        "  --no-maya            skip the benchmarks that need to initialize Maya\n"
+        "  --repetitions <n>    number of timed runs of each benchmark (default 5)\n"
+        "  --output <file>      write the results to a JSON file\n"
+        "  --baseline <file>    compare with the results of a previous run, and fail\n"
+        "                       if a benchmark is slower than the tolerance allows\n"
+        "  --tolerance <ratio>  allowed slowdown over the baseline (default 0.1)\n",
+        program);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    std::string outputFile;
+    std::string baselineFile;
+    size_t      repetitions = 5;
+    double      tolerance = 0.1;
+    bool        quick = false;
+    bool        skipMaya = false;
+    bool        list = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+        } else if (strcmp(argv[i], "--no-maya") == 0) {
+            skipMaya = true;
+        } else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+            repetitions = static_cast<size_t>(std::max(atoi(argv[++i]), 1));
+        } else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+            outputFile = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselineFile = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && hasValue) {
+            tolerance = atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector<const Benchmark*> selected;
+    bool                          needsMaya = false;
+    for (const Benchmark& benchmark : benchmarks()) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+            continue;
+        if (skipMaya && benchmark.needsMaya)
+            continue;
+        selected.push_back(&benchmark);
+        needsMaya = needsMaya || benchmark.needsMaya;
+    }
+
+    if (list) {
+        for (const Benchmark* benchmark : selected)
+            printf("%s%s\n", benchmark->name.c_str(), benchmark->needsMaya ? " (maya)" : "");
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<Result> baseline;
+    if (!baselineFile.empty() && !readResults(baselineFile, baseline))
+        return EXIT_FAILURE;
+
+    std::map<std::string, std::string> info;
+    info["mayaUsd"] = TOSTRING(MAYAUSD_VERSION);
+    info["usd"] = std::to_string(PXR_VERSION);
+    info["threads"] = std::to_string(std::thread::hardware_concurrency());
+    info["repetitions"] = std::to_string(repetitions);
+
+    // Headless Maya, with the mayaUsd plugin for the nodes, translators and UFE runtime.
+    if (needsMaya) {
+        if (!MLibrary::initialize(true, argv[0], true)) {
+            fprintf(stderr, "Unable to initialize Maya\n");
+            return EXIT_FAILURE;
+        }
+        if (!MGlobal::executeCommand("loadPlugin mayaUsdPlugin")) {
+            fprintf(stderr, "Unable to load the mayaUsdPlugin\n");
+            MLibrary::cleanup(EXIT_FAILURE);
+        }
+        info["maya"] = MGlobal::mayaVersion().asChar();
+    }
+
+    std::vector<Result> results;
+    int                 failures = 0;
+    for (const Benchmark* benchmark : selected) {
+        for (size_t size : benchmark->sizes) {
+            Result result;
+            result.name = benchmark->name;
+            result.size = size;
+
+            State state(result, repetitions);
+            benchmark->fn(state);
+
+            // A benchmark returns before measuring when its scene could not be set up.
+            if (result.timesMs.empty()) {
+                printf("%-48s %10zu  FAILED, nothing measured\n", result.name.c_str(), result.size);
+                ++failures;
+            } else {
+                printf(
+                    "%-48s %10zu  median %10.3f ms  min %10.3f ms\n",
+                    result.name.c_str(),
+                    result.size,
+                    result.medianMs(),
+                    result.minMs());
+            }
+            fflush(stdout);
+            results.push_back(std::move(result));
+
+            if (quick)
+                break;
+        }
+    }
+
+    int exitCode = EXIT_SUCCESS;
+    if (failures > 0) {
+        printf("\n%d benchmark(s) failed\n", failures);
+        exitCode = EXIT_FAILURE;
+    }
+
+    if (!outputFile.empty() && !writeResults(outputFile, info, results))
+        exitCode = EXIT_FAILURE;
+
+    if (!baselineFile.empty()) {
+        // Only the baseline entries of the benchmarks and sizes selected for
+        // this run are expected in the results.
+        const auto expected = [&](const Result& reference) {
+            const auto benchmark = std::find_if(
+                benchmarks().begin(), benchmarks().end(), [&reference](const Benchmark& b) {
+                    return b.name == reference.name;
+                });
+            if (benchmark == benchmarks().end())
+                return filter.empty() || reference.name.find(filter) != std::string::npos;
+            if (std::find(selected.begin(), selected.end(), &*benchmark) == selected.end())
+                return false;
+            return !quick || reference.size == benchmark->sizes.front();
+        };
+        baseline.erase(
+            std::remove_if(
+                baseline.begin(),
+                baseline.end(),
+                [&expected](const Result& reference) { return !expected(reference); }),
+            baseline.end());
+
+        printf("\n");
+        const int regressions = compareResults(results, baseline, tolerance);
+        if (regressions > 0) {
+            printf("\n%d benchmark(s) slower than the baseline or missing\n", regressions);
+            exitCode = EXIT_FAILURE;
+        }
+    }
+
+    // Does not return when Maya was initialized.
+    if (needsMaya)
+        MLibrary::cleanup(exitCode);
+    return exitCode;
+}
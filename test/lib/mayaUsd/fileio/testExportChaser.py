@@ -17,9 +17,10 @@
 
 import mayaUsd.lib as mayaUsdLib
 
-from pxr import Usd
+from pxr import Sdf, Usd
 
 from maya import cmds
+import maya.api.OpenMaya as OpenMaya
 from maya import standalone
 
 import fixturesUtils, os
@@ -51,6 +52,28 @@ class exportChaserTest(mayaUsdLib.ExportChaser):
         exportChaserTest.PostExportCalled = True
         return True
 
+class exportChaserBatchTest(mayaUsdLib.ExportChaser):
+    ExportFrameCalled = False
+    Times = []
+    Values = []
+
+    def __init__(self, factoryContext, *args, **kwargs):
+        super(exportChaserBatchTest, self).__init__(factoryContext, *args, **kwargs)
+
+    def GetSampledPlugs(self):
+        selection = OpenMaya.MSelectionList()
+        selection.add('apple.translateX')
+        return [(selection.getPlug(0), Sdf.ValueTypeNames.Double)]
+
+    def ExportFrame(self, frame):
+        exportChaserBatchTest.ExportFrameCalled = True
+        return True
+
+    def ExportFrames(self, times, values):
+        exportChaserBatchTest.Times = [time.GetValue() for time in times]
+        exportChaserBatchTest.Values = values
+        return True
+
 class testExportChaser(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -85,5 +108,25 @@ class testExportChaser(unittest.TestCase):
         self.assertTrue('test' in exportChaserTest.ChaserNames)
         self.assertEqual(exportChaserTest.ChaserArgs,{'bar': 'ometer', 'foo': 'tball'})
 
+    def testBatchExportChaser(self):
+        mayaUsdLib.ExportChaser.Register(exportChaserBatchTest, "batch")
+        cmds.polySphere(r = 3.5, name='apple')
+        cmds.setKeyframe('apple', attribute='translateX', time=1, value=0.0)
+        cmds.setKeyframe('apple', attribute='translateX', time=3, value=4.0)
+
+        usdFilePath = os.path.join(self.temp_dir,'testExportChaserBatch.usda')
+        cmds.usdExport(mergeTransformAndShape=True,
+            file=usdFilePath,
+            chaser=['batch'],
+            frameRange=(1, 3),
+            shadingMode='none')
+
+        # The plug is sampled at each frame and all the frames are given at once.
+        self.assertFalse(exportChaserBatchTest.ExportFrameCalled)
+        self.assertEqual(exportChaserBatchTest.Times, [1.0, 2.0, 3.0])
+        self.assertEqual(len(exportChaserBatchTest.Values), 1)
+        self.assertAlmostEqual(exportChaserBatchTest.Values[0][0], 0.0)
+        self.assertAlmostEqual(exportChaserBatchTest.Values[0][2], 4.0)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
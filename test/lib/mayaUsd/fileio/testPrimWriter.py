@@ -17,7 +17,7 @@
 
 import mayaUsd.lib as mayaUsdLib
 
-from pxr import UsdGeom
+from pxr import Usd, UsdGeom
 
 from maya import cmds
 import maya.api.OpenMaya as OpenMaya
@@ -64,6 +64,22 @@ class primWriterTest(mayaUsdLib.PrimWriter):
     def PostExport(self):
         primWriterTest.PostExportCalled = True
 
+class primWriterBatchTest(mayaUsdLib.PrimWriter):
+    BatchCalls = []
+
+    def __init__(self, *args, **kwargs):
+        super(primWriterBatchTest, self).__init__(*args, **kwargs)
+        primSchema = UsdGeom.Sphere.Define(self.GetUsdStage(), self.GetUsdPath())
+        self._SetUsdPrim(primSchema.GetPrim())
+
+    @classmethod
+    def WriteBatch(cls, primWriters, usdTime):
+        for primWriter in primWriters:
+            depNodeFn = OpenMaya.MFnDependencyNode(primWriter.GetMayaObject())
+            radius = depNodeFn.findPlug('radius', False).asFloat()
+            primWriter.GetUsdPrim().GetAttribute('radius').Set(radius, usdTime)
+        cls.BatchCalls.append((len(primWriters), usdTime))
+
 class testReadWriteUtils(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -91,5 +107,30 @@ class testReadWriteUtils(unittest.TestCase):
         self.assertTrue(primWriterTest.WriteCalled)
         self.assertTrue(primWriterTest.PostExportCalled)
 
+    def testBatchPrimWriter(self):
+        mayaUsdLib.PrimWriter.Register(primWriterBatchTest, "implicitSphere")
+
+        for name in ('first', 'second'):
+            xform = cmds.createNode('transform', name=name)
+            sphere = cmds.createNode('implicitSphere', name=name + 'Shape', parent=xform)
+            cmds.setKeyframe(sphere, attribute='radius', time=1, value=1.0)
+            cmds.setKeyframe(sphere, attribute='radius', time=3, value=3.0)
+
+        usdFilePath = os.path.join(self.temp_dir,'testPrimWriterBatchExport.usda')
+        cmds.usdExport(mergeTransformAndShape=True,
+            file=usdFilePath,
+            frameRange=(1, 3),
+            shadingMode='none')
+
+        # Both prims are written by a single call per frame.
+        batchCalls = [(count, usdTime.GetValue())
+            for count, usdTime in primWriterBatchTest.BatchCalls]
+        self.assertEqual(batchCalls, [(2, 1.0), (2, 2.0), (2, 3.0)])
+
+        stage = Usd.Stage.Open(usdFilePath)
+        radiusAttr = stage.GetPrimAtPath('/first').GetAttribute('radius')
+        self.assertEqual(radiusAttr.GetTimeSamples(), [1.0, 2.0, 3.0])
+        self.assertAlmostEqual(radiusAttr.Get(3), 3.0)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
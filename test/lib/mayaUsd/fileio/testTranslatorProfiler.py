@@ -0,0 +1,95 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+import glob
+import json
+import os
+import unittest
+
+
+class testTranslatorProfiler(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+        # The setting is read the first time a job runs, so it must be set
+        # before any export or import.
+        cls._profileDir = os.path.abspath('translatorProfile')
+        os.environ['MAYAUSD_TRANSLATOR_PROFILE_DIR'] = cls._profileDir
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+    def _readReport(self, jobName):
+        reports = glob.glob(os.path.join(self._profileDir, jobName + '_*.json'))
+        self.assertEqual(len(reports), 1)
+        with open(reports[0]) as reportFile:
+            report = json.load(reportFile)
+        os.remove(reports[0])
+        return report
+
+    def testExportAndImportProfile(self):
+        cmds.polyCube(name='cube')
+        cmds.setKeyframe('cube.tx', time=1, value=0.0)
+        cmds.setKeyframe('cube.tx', time=3, value=2.0)
+
+        usdFilePath = os.path.abspath('translatorProfile.usda')
+        cmds.mayaUSDExport(file=usdFilePath, frameRange=(1, 3))
+
+        report = self._readReport('usdExport')
+        self.assertEqual(report['summary']['job'], 'usdExport')
+
+        # The merged transform and shape writers both write the cube prim, each
+        # with one default-time write, then one write per frame.
+        cubeStats = report['summary']['prims']['/cube']
+        self.assertGreaterEqual(len(cubeStats), 1)
+        for translator, phases in cubeStats.items():
+            self.assertIn(translator, report['summary']['translators'])
+            self.assertEqual(phases['Write']['calls'], 4)
+            self.assertEqual(phases['PostExport']['calls'], 1)
+
+            cubeWrites = [e for e in report['traceEvents']
+                if e['cat'] == 'Write' and e['args']['prim'] == '/cube'
+                and e['name'] == translator]
+            self.assertEqual(len(cubeWrites), 4)
+            for event in cubeWrites:
+                self.assertEqual(event['ph'], 'X')
+                self.assertGreaterEqual(event['dur'], 0.0)
+
+        cmds.file(new=True, force=True)
+        cmds.mayaUSDImport(file=usdFilePath)
+
+        report = self._readReport('usdImport')
+        self.assertEqual(report['summary']['job'], 'usdImport')
+        for phases in report['summary']['prims']['/cube'].values():
+            self.assertEqual(phases['Read']['calls'], 1)
+        self.assertTrue(any(e['cat'] == 'Read' and e['args']['prim'] == '/cube'
+            for e in report['traceEvents']))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
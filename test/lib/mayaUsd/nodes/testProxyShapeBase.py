@@ -62,6 +62,52 @@ class testProxyShapeBase(unittest.TestCase):
         bboxSize = cmds.getAttr('Cube_usd.boundingBoxSize')[0]
         self.assertEqual(bboxSize, (1.0, 1.0, 1.0))
 
+    def testBoundingBoxMayaExtents(self):
+        '''
+        Verify that the Maya-specific extents of cameras follow edits to the stage.
+        '''
+        cmds.file(new=True, force=True)
+
+        from pxr import UsdGeom, Gf
+
+        shapeNode, stage = mayaUtils.createProxyAndStage()
+
+        def getBBox():
+            return (cmds.getAttr(shapeNode + '.boundingBoxMin')[0],
+                    cmds.getAttr(shapeNode + '.boundingBoxMax')[0])
+
+        def assertBBox(expectedMin, expectedMax):
+            bboxMin, bboxMax = getBBox()
+            for actual, expected in zip(bboxMin + bboxMax, expectedMin + expectedMax):
+                self.assertAlmostEqual(actual, expected, places=5)
+
+        camera = UsdGeom.Camera.Define(stage, '/Xform1/Camera1')
+        UsdGeom.XformCommonAPI(camera).SetTranslate(Gf.Vec3d(10.0, 0.0, 0.0))
+        assertBBox((9.6, -0.3, -2.0), (10.4, 1.0, 2.0))
+
+        # Moving the camera must update the cached transforms.
+        UsdGeom.XformCommonAPI(camera).SetTranslate(Gf.Vec3d(0.0, 5.0, 0.0))
+        assertBBox((-0.4, 4.7, -2.0), (0.4, 6.0, 2.0))
+
+        # Moving a parent of the camera must also update the cached transforms.
+        xform = UsdGeom.Xform(stage.GetPrimAtPath('/Xform1'))
+        UsdGeom.XformCommonAPI(xform).SetTranslate(Gf.Vec3d(0.0, 0.0, 3.0))
+        assertBBox((-0.4, 4.7, 1.0), (0.4, 6.0, 5.0))
+
+        # Adding a camera must add it to the index.
+        UsdGeom.Camera.Define(stage, '/Camera2')
+        assertBBox((-0.4, -0.3, -2.0), (0.4, 6.0, 5.0))
+
+        # Removing a camera must remove it from the index.
+        stage.RemovePrim('/Xform1')
+        assertBBox((-0.4, -0.3, -2.0), (0.4, 1.0, 2.0))
+
+        # Changing the type of a prim must update the index.
+        stage.GetPrimAtPath('/Camera2').SetTypeName('Xform')
+        UsdGeom.Camera.Define(stage, '/Camera3')
+        UsdGeom.XformCommonAPI(stage.GetPrimAtPath('/Camera3')).SetTranslate(Gf.Vec3d(-10.0, 0.0, 0.0))
+        assertBBox((-10.4, -0.3, -2.0), (-9.6, 1.0, 2.0))
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testDuplicateProxyStageAnonymous only available in UFE v2 or greater.')
     def testDuplicateProxyStageAnonymous(self):
         '''
@@ -168,6 +168,47 @@ class testVP2RenderDelegateSelection(imageUtils.ImageDiffingTestCase):
         self._selectionTest('instance_', usdball01, usdball03, proxyDagPath, 'wireframe')
 
 
+    def testInstancedSelectionUpdates(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+        usdaFile = testUtils.getTestScene("instances", "perInstanceInheritedData.usda")
+        proxyDagPath, stage = mayaUtils.createProxyFromFile(usdaFile)
+        usdball01 = proxyDagPath + ",/root/group/ball_01"
+        usdball03 = proxyDagPath + ",/root/group/ball_03"
+
+        cmds.move(8.5, -20, 0, "persp")
+        cmds.rotate(90, 0, 0, "persp")
+        cmds.modelEditor('modelPanel4', e=True, displayAppearance='smoothShaded', displayLights='default')
+        cmds.modelEditor('modelPanel4', e=True, wireframeOnShaded=False, displayLights='default')
+
+        globalSelection = ufe.GlobalSelection.get()
+        globalSelection.clear()
+        self.assertSnapshotClose('instance_unselected_smoothShaded.png')
+
+        # Appending to and removing from the selection update the highlighting
+        # from the selection changes only.
+        globalSelection.append(self._stringToUfeItem(usdball01))
+        self.assertSnapshotClose('instance_objectA_smoothShaded.png')
+        globalSelection.append(self._stringToUfeItem(usdball03))
+        self.assertSnapshotClose('instance_objectA_and_objectB_smoothShaded.png')
+        globalSelection.remove(self._stringToUfeItem(usdball03))
+        self.assertSnapshotClose('instance_objectA_smoothShaded.png')
+        globalSelection.append(self._stringToUfeItem(usdball03))
+        self.assertSnapshotClose('instance_objectA_and_objectB_smoothShaded.png')
+
+        # Removing the invisible ball_02 instance changes the instance indices
+        # of the selected ball_03, which must be looked up again for the
+        # highlighting to stay on the selected instances.
+        ball02 = stage.GetPrimAtPath('/root/group/ball_02')
+        ball02.SetActive(False)
+        self.assertSnapshotClose('instance_objectA_and_objectB_smoothShaded.png')
+        ball02.SetActive(True)
+        self.assertSnapshotClose('instance_objectA_and_objectB_smoothShaded.png')
+
+        # Replacing the selection updates the highlighting from the whole selection.
+        cmds.select(clear=True)
+        self.assertSnapshotClose('instance_clear_smoothShaded.png')
+
 
 if __name__ == '__main__':
     fixturesUtils.runTests(globals())
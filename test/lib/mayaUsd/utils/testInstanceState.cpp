@@ -0,0 +1,214 @@
+#include <mayaUsd/render/vp2RenderDelegate/instanceState.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/imaging/hd/selection.h>
+
+#include <maya/MColor.h>
+#include <maya/MFloatArray.h>
+#include <maya/MMatrix.h>
+#include <maya/MString.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const unsigned int kNumChannels = HdVP2InstanceState::kNumColorChannels;
+
+const MColor kColors[HdVP2InstanceState::kNumHighlightColors]
+    = { MColor(0.0f, 0.0f, 1.0f), MColor(1.0f, 1.0f, 0.0f), MColor(0.0f, 1.0f, 0.0f) };
+
+VtMatrix4dArray makeTransforms(size_t count)
+{
+    VtMatrix4dArray transforms(count);
+    for (size_t i = 0; i < count; ++i)
+        transforms[i].SetTranslate(GfVec3d(double(i), 0.0, 0.0));
+    return transforms;
+}
+
+HdSelection::PrimSelectionState makeSelection(const VtIntArray& indices)
+{
+    HdSelection::PrimSelectionState state;
+    state.instanceIndices.push_back(indices);
+    return state;
+}
+
+bool hasColor(const MFloatArray& colors, unsigned int index, const MColor& color)
+{
+    for (unsigned int j = 0; j < kNumChannels; ++j) {
+        if (colors[index * kNumChannels + j] != color[j])
+            return false;
+    }
+    return true;
+}
+
+// Update the transforms of the instance state, counting the identifiers computed.
+bool updateTransforms(
+    HdVP2InstanceState&    state,
+    const MMatrix&         worldMatrix,
+    const VtMatrix4dArray& transforms,
+    size_t&                nbIdentifiers)
+{
+    return state.UpdateTransforms(worldMatrix, transforms, [&nbIdentifiers](unsigned int i) {
+        ++nbIdentifiers;
+        return MString(std::to_string(i).c_str());
+    });
+}
+
+} // namespace
+
+TEST(InstanceState, transforms)
+{
+    HdVP2InstanceState    state;
+    const VtMatrix4dArray transforms = makeTransforms(100);
+    size_t                nbIdentifiers = 0;
+
+    EXPECT_TRUE(updateTransforms(state, MMatrix(), transforms, nbIdentifiers));
+    EXPECT_EQ(state.GetInstanceCount(), 100u);
+    EXPECT_EQ(state.GetUfeIdentifiers().length(), 100u);
+    EXPECT_EQ(state.GetUfeIdentifiers()[42], MString("42"));
+    EXPECT_EQ((*state.GetTransforms())[42](3, 0), 42.0);
+    EXPECT_EQ(nbIdentifiers, 100u);
+    EXPECT_NE(state.GetTransformsVersion(), 0u);
+
+    // Unchanged transforms keep the same array and version, for the commit to skip them.
+    const auto     previous = state.GetTransforms();
+    const uint64_t previousVersion = state.GetTransformsVersion();
+    EXPECT_FALSE(updateTransforms(state, MMatrix(), makeTransforms(100), nbIdentifiers));
+    EXPECT_EQ(state.GetTransforms(), previous);
+    EXPECT_EQ(state.GetTransformsVersion(), previousVersion);
+    EXPECT_EQ(nbIdentifiers, 100u);
+
+    // A new world matrix moves all the instances without recomputing their identifiers.
+    MMatrix worldMatrix;
+    worldMatrix(3, 1) = 5.0;
+    EXPECT_TRUE(updateTransforms(state, worldMatrix, transforms, nbIdentifiers));
+    EXPECT_NE(state.GetTransforms(), previous);
+    EXPECT_NE(state.GetTransformsVersion(), previousVersion);
+    EXPECT_EQ((*state.GetTransforms())[42](3, 0), 42.0);
+    EXPECT_EQ((*state.GetTransforms())[42](3, 1), 5.0);
+    EXPECT_EQ(nbIdentifiers, 100u);
+
+    // The previous array is left untouched for the commit still using it.
+    EXPECT_EQ((*previous)[42](3, 1), 0.0);
+
+    // New instances recompute everything.
+    EXPECT_TRUE(updateTransforms(state, worldMatrix, makeTransforms(10), nbIdentifiers));
+    EXPECT_EQ(state.GetInstanceCount(), 10u);
+    EXPECT_EQ(nbIdentifiers, 110u);
+
+    state.Reset();
+    EXPECT_EQ(state.GetInstanceCount(), 0u);
+    EXPECT_TRUE(updateTransforms(state, worldMatrix, makeTransforms(10), nbIdentifiers));
+    EXPECT_EQ(nbIdentifiers, 120u);
+}
+
+TEST(InstanceState, selectionColors)
+{
+    HdVP2InstanceState state;
+    size_t             nbIdentifiers = 0;
+    updateTransforms(state, MMatrix(), makeTransforms(1000), nbIdentifiers);
+
+    const auto active = makeSelection({ 1, 2 });
+    const auto lead = makeSelection({ 2 });
+    EXPECT_TRUE(state.UpdateColors(kColors, &active, &lead));
+    EXPECT_EQ(state.GetColors()->length(), 1000u * kNumChannels);
+    EXPECT_TRUE(hasColor(*state.GetColors(), 0, kColors[0]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 1, kColors[1]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, kColors[2]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 999, kColors[0]));
+
+    // The same selection keeps the same colors and version.
+    const auto previous = state.GetColors();
+    uint64_t   version = state.GetColorsVersion();
+    EXPECT_NE(version, 0u);
+    EXPECT_FALSE(state.UpdateColors(kColors, &active, &lead));
+    EXPECT_EQ(state.GetColors(), previous);
+    EXPECT_EQ(state.GetColorsVersion(), version);
+
+    // A new selection only changes the colors of the instances selected before or now,
+    // in a copy since the commit still holds the previous colors.
+    const auto newLead = makeSelection({ 500, -1, 2000 });
+    EXPECT_TRUE(state.UpdateColors(kColors, nullptr, &newLead));
+    EXPECT_NE(state.GetColors(), previous);
+    EXPECT_TRUE(hasColor(*state.GetColors(), 1, kColors[0]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, kColors[0]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 500, kColors[2]));
+    EXPECT_TRUE(hasColor(*previous, 2, kColors[2]));
+    EXPECT_TRUE(hasColor(*previous, 500, kColors[0]));
+
+    // Without other owner, the colors are updated in place, with a new version for the
+    // commit to upload them.
+    const MFloatArray* colors = state.GetColors().get();
+    version = state.GetColorsVersion();
+    EXPECT_TRUE(state.UpdateColors(kColors, nullptr, nullptr));
+    EXPECT_EQ(state.GetColors().get(), colors);
+    EXPECT_NE(state.GetColorsVersion(), version);
+    EXPECT_TRUE(hasColor(*state.GetColors(), 500, kColors[0]));
+
+    // Changing the highlight colors rewrites all the instances.
+    MColor newColors[HdVP2InstanceState::kNumHighlightColors]
+        = { MColor(1.0f, 0.0f, 0.0f), kColors[1], kColors[2] };
+    EXPECT_TRUE(state.UpdateColors(newColors, nullptr, nullptr));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 0, newColors[0]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 999, newColors[0]));
+}
+
+TEST(InstanceState, authoredColors)
+{
+    HdVP2InstanceState state;
+    size_t             nbIdentifiers = 0;
+    updateTransforms(state, MMatrix(), makeTransforms(3), nbIdentifiers);
+
+    MFloatArray  authoredColors(3 * kNumChannels, 0.5f);
+    const auto   active = makeSelection({ 1 });
+    const MColor authored(0.5f, 0.5f, 0.5f, 0.5f);
+
+    // The dormant instances keep their authored colors.
+    EXPECT_TRUE(state.SetAuthoredColors(authoredColors));
+    EXPECT_TRUE(state.UpdateColors(kColors, &active, nullptr));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 0, authored));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 1, kColors[1]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, authored));
+
+    // The authored colors are kept by a selection change, which only updates the
+    // instances selected before or now.
+    const MFloatArray* colors = state.GetColors().get();
+    const auto         newActive = makeSelection({ 2 });
+    EXPECT_TRUE(state.UpdateColors(kColors, &newActive, nullptr));
+    EXPECT_EQ(state.GetColors().get(), colors);
+    EXPECT_TRUE(hasColor(*state.GetColors(), 1, authored));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, kColors[1]));
+
+    // Setting the same authored colors again does not rewrite the colors.
+    const uint64_t version = state.GetColorsVersion();
+    EXPECT_FALSE(state.SetAuthoredColors(MFloatArray(3 * kNumChannels, 0.5f)));
+    EXPECT_FALSE(state.UpdateColors(kColors, &newActive, nullptr));
+    EXPECT_EQ(state.GetColorsVersion(), version);
+
+    // New authored colors rewrite all the colors.
+    authoredColors[0] = 0.25f;
+    EXPECT_TRUE(state.SetAuthoredColors(authoredColors));
+    EXPECT_TRUE(state.UpdateColors(kColors, &newActive, nullptr));
+    EXPECT_NE(state.GetColorsVersion(), version);
+    EXPECT_EQ((*state.GetColors())[0], 0.25f);
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, kColors[1]));
+
+    // Without authored colors, the dormant instances use the dormant color.
+    EXPECT_TRUE(state.SetAuthoredColors(MFloatArray()));
+    EXPECT_TRUE(state.UpdateColors(kColors, &newActive, nullptr));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 0, kColors[0]));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 2, kColors[1]));
+
+    // A reset forgets the authored colors.
+    EXPECT_TRUE(state.SetAuthoredColors(authoredColors));
+    state.Reset();
+    updateTransforms(state, MMatrix(), makeTransforms(3), nbIdentifiers);
+    EXPECT_TRUE(state.UpdateColors(kColors, nullptr, nullptr));
+    EXPECT_TRUE(hasColor(*state.GetColors(), 0, kColors[0]));
+}
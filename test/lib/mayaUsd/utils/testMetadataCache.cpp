@@ -0,0 +1,154 @@
+#include <mayaUsd/base/tokens.h>
+#include <mayaUsd/utils/editability.h>
+#include <mayaUsd/utils/selectability.h>
+
+#include <pxr/usd/sdf/valueTypeName.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+UsdStageRefPtr createStage()
+{
+    auto stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/a/b/c"));
+    stage->DefinePrim(SdfPath("/a/d"));
+    return stage;
+}
+
+} // namespace
+
+TEST(MetadataCache, selectabilityIsKeptAcrossSelections)
+{
+    Selectability::clearCache();
+    auto    stage = createStage();
+    UsdPrim c = stage->GetPrimAtPath(SdfPath("/a/b/c"));
+
+    EXPECT_TRUE(Selectability::isSelectable(c));
+    const size_t misses = Selectability::getCacheStatistics().misses;
+    EXPECT_GT(misses, 0u);
+
+    Selectability::prepareForSelection();
+    EXPECT_TRUE(Selectability::isSelectable(c));
+    EXPECT_EQ(Selectability::getCacheStatistics().misses, misses);
+    EXPECT_EQ(Selectability::getCacheStatistics().hits, 1u);
+}
+
+TEST(MetadataCache, selectabilityInvalidation)
+{
+    Selectability::clearCache();
+    auto    stage = createStage();
+    UsdPrim a = stage->GetPrimAtPath(SdfPath("/a"));
+    UsdPrim c = stage->GetPrimAtPath(SdfPath("/a/b/c"));
+    UsdPrim d = stage->GetPrimAtPath(SdfPath("/a/d"));
+
+    EXPECT_TRUE(Selectability::isSelectable(c));
+    EXPECT_TRUE(Selectability::isSelectable(d));
+
+    // The selectability is inherited: changing it on an ancestor invalidates
+    // the whole subtree.
+    a.SetMetadata(MayaUsdMetadata->Selectability, MayaUsdTokens->Off);
+    EXPECT_FALSE(Selectability::isSelectable(c));
+    EXPECT_FALSE(Selectability::isSelectable(d));
+
+    c.SetMetadata(MayaUsdMetadata->Selectability, MayaUsdTokens->On);
+    EXPECT_TRUE(Selectability::isSelectable(c));
+    EXPECT_FALSE(Selectability::isSelectable(d));
+
+    // Changes that do not involve the selectability keep the cache.
+    const size_t misses = Selectability::getCacheStatistics().misses;
+    c.CreateAttribute(TfToken("value"), SdfValueTypeNames->Double).Set(1.0);
+    d.SetMetadata(SdfFieldKeys->Documentation, std::string("doc"));
+    EXPECT_TRUE(Selectability::isSelectable(c));
+    EXPECT_FALSE(Selectability::isSelectable(d));
+    EXPECT_EQ(Selectability::getCacheStatistics().misses, misses);
+
+    // Removing and recreating prims drops their cached selectability.
+    stage->RemovePrim(SdfPath("/a"));
+    stage->DefinePrim(SdfPath("/a/b/c"));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/a/b/c"))));
+
+    // Each stage has its own cache.
+    auto    other = createStage();
+    UsdPrim otherC = other->GetPrimAtPath(SdfPath("/a/b/c"));
+    otherC.SetMetadata(MayaUsdMetadata->Selectability, MayaUsdTokens->Off);
+    EXPECT_FALSE(Selectability::isSelectable(otherC));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/a/b/c"))));
+}
+
+TEST(MetadataCache, selectabilityHitRate)
+{
+    Selectability::clearCache();
+    auto stage = UsdStage::CreateInMemory();
+
+    const size_t         count = 1000;
+    std::vector<SdfPath> paths;
+    for (size_t i = 0; i < count; ++i) {
+        paths.push_back(SdfPath("/root/group" + std::to_string(i / 100) + "/prim"
+                                + std::to_string(i)));
+        stage->DefinePrim(paths.back());
+    }
+
+    for (const SdfPath& path : paths)
+        Selectability::isSelectable(stage->GetPrimAtPath(path));
+
+    // Every prim is computed once: the groups, the root and the pseudo-root
+    // are computed on the first query of one of their descendants.
+    const size_t nbPrims = count + 10 + 1 + 1;
+    EXPECT_EQ(Selectability::getCacheStatistics().misses, nbPrims);
+
+    // Each prim queried after the first one of its group found its parent in the cache.
+    EXPECT_EQ(Selectability::getCacheStatistics().hits, count - 1);
+
+    // Later selections only hit the cache, whatever the depth of the prims.
+    for (int selection = 0; selection < 3; ++selection) {
+        Selectability::prepareForSelection();
+        for (const SdfPath& path : paths)
+            Selectability::isSelectable(stage->GetPrimAtPath(path));
+    }
+    EXPECT_EQ(Selectability::getCacheStatistics().misses, nbPrims);
+    EXPECT_EQ(Selectability::getCacheStatistics().hits, count - 1 + 3 * count);
+}
+
+TEST(MetadataCache, lockInvalidation)
+{
+    MayaUsd::Editability::clearCache();
+    auto    stage = createStage();
+    UsdPrim c = stage->GetPrimAtPath(SdfPath("/a/b/c"));
+
+    UsdAttribute attr = c.CreateAttribute(TfToken("value"), SdfValueTypeNames->Double);
+    UsdAttribute other = c.CreateAttribute(TfToken("other"), SdfValueTypeNames->Double);
+    EXPECT_FALSE(MayaUsd::Editability::isLocked(attr));
+    EXPECT_FALSE(MayaUsd::Editability::isLocked(other));
+    EXPECT_EQ(MayaUsd::Editability::getCacheStatistics().misses, 2u);
+
+    // The lock is not inherited: only the modified property is recomputed.
+    attr.SetMetadata(MayaUsdMetadata->Lock, MayaUsdTokens->On);
+    EXPECT_TRUE(MayaUsd::Editability::isLocked(attr));
+    EXPECT_FALSE(MayaUsd::Editability::isLocked(other));
+    EXPECT_EQ(MayaUsd::Editability::getCacheStatistics().misses, 3u);
+
+    // Setting values keeps the cache.
+    attr.Set(2.0);
+    EXPECT_TRUE(MayaUsd::Editability::isLocked(attr));
+    EXPECT_EQ(MayaUsd::Editability::getCacheStatistics().misses, 3u);
+
+    attr.ClearMetadata(MayaUsdMetadata->Lock);
+    EXPECT_FALSE(MayaUsd::Editability::isLocked(attr));
+
+    // Resyncing an ancestor drops the states of its properties.
+    attr.SetMetadata(MayaUsdMetadata->Lock, MayaUsdTokens->On);
+    EXPECT_TRUE(MayaUsd::Editability::isLocked(attr));
+    stage->RemovePrim(SdfPath("/a"));
+    c = stage->DefinePrim(SdfPath("/a/b/c"));
+    attr = c.CreateAttribute(TfToken("value"), SdfValueTypeNames->Double);
+    EXPECT_FALSE(MayaUsd::Editability::isLocked(attr));
+}
@@ -0,0 +1,186 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+import mayaUsd.lib
+
+from maya import standalone
+
+import os
+import shutil
+import tempfile
+import time
+import unittest
+
+_DOCUMENT = '''<?xml version="1.0"?>
+<materialx version="1.38">
+  <standard_surface name="SR_test" type="surfaceshader">
+    <input name="base_color" type="color3" value="%s" />
+  </standard_surface>
+  <surfacematerial name="M_test" type="material">
+    <input name="surfaceshader" type="surfaceshader" nodename="SR_test" />
+  </surfacematerial>
+</materialx>
+'''
+
+
+class testOgsFragmentCache(unittest.TestCase):
+    '''
+    Verify that generated MaterialX OGS fragments are stored on disk and
+    reused without generating them again.
+    '''
+
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(self.pluginsLoaded)
+
+        self._cacheDir = tempfile.mkdtemp(prefix='ogsFragmentCache')
+        self._previousDir = mayaUsd.lib.OgsFragmentCache.GetDirectory()
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(self._cacheDir, 64 * 1024 * 1024)
+        mayaUsd.lib.OgsFragmentCache.Clear()
+
+    def tearDown(self):
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(self._previousDir, 256 * 1024 * 1024)
+        shutil.rmtree(self._cacheDir, ignore_errors=True)
+
+    def _generate(self, color='0.8, 0.2, 0.1'):
+        return mayaUsd.lib.OgsFragmentCache.GenerateFragment(_DOCUMENT % color, 'M_test')
+
+    def _entries(self):
+        return [f for f in os.listdir(self._cacheDir) if f.endswith('.ogsfrag')]
+
+    def testCacheHit(self):
+        name, source, fromCache = self._generate()
+        self.assertFalse(fromCache)
+        self.assertTrue(name)
+        self.assertIn(name, source)
+        self.assertEqual(len(self._entries()), 1)
+
+        cachedName, cachedSource, fromCache = self._generate()
+        self.assertTrue(fromCache)
+        self.assertEqual(cachedName, name)
+        self.assertEqual(cachedSource, source)
+
+        self.assertEqual(mayaUsd.lib.OgsFragmentCache.GetHitCount(), 1)
+        self.assertEqual(mayaUsd.lib.OgsFragmentCache.GetMissCount(), 1)
+
+    def testNetworkChange(self):
+        self._generate()
+
+        # Any change to the network gets its own entry.
+        _, _, fromCache = self._generate('0.1, 0.2, 0.8')
+        self.assertFalse(fromCache)
+        self.assertEqual(len(self._entries()), 2)
+
+        _, _, fromCache = self._generate()
+        self.assertTrue(fromCache)
+
+    def testCorruptEntry(self):
+        name, source, _ = self._generate()
+        for entry in self._entries():
+            with open(os.path.join(self._cacheDir, entry), 'w') as f:
+                f.write('not an entry')
+
+        # A damaged entry is generated again, and replaced.
+        regeneratedName, regeneratedSource, fromCache = self._generate()
+        self.assertFalse(fromCache)
+        self.assertEqual(regeneratedName, name)
+        self.assertEqual(regeneratedSource, source)
+
+        _, _, fromCache = self._generate()
+        self.assertTrue(fromCache)
+
+    def testEviction(self):
+        colors = ['0.8, 0.2, 0.1', '0.1, 0.2, 0.8', '0.1, 0.8, 0.2', '0.8, 0.1, 0.2']
+        entries = {}
+        for color in colors[:3]:
+            previous = set(self._entries())
+            self._generate(color)
+            entries[color] = (set(self._entries()) - previous).pop()
+        entrySize = os.path.getsize(os.path.join(self._cacheDir, entries[colors[0]]))
+
+        # Set the last use of the entries explicitly, from the oldest to the
+        # most recent, rather than relying on the file system time resolution.
+        now = time.time()
+        for age, color in zip((300, 200, 100), colors[:3]):
+            entryPath = os.path.join(self._cacheDir, entries[color])
+            os.utime(entryPath, (now - age, now - age))
+
+        # Using the oldest entry makes it the most recently used one.
+        _, _, fromCache = self._generate(colors[0])
+        self.assertTrue(fromCache)
+
+        # Room for three and a half entries: adding a fourth one evicts the
+        # least recently used entries, down to three quarters of the limit.
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(self._cacheDir, entrySize * 7 // 2)
+        self._generate(colors[3])
+        remaining = set(self._entries())
+        self.assertEqual(len(remaining), 2)
+        self.assertIn(entries[colors[0]], remaining)
+        self.assertNotIn(entries[colors[1]], remaining)
+        self.assertNotIn(entries[colors[2]], remaining)
+
+        _, _, fromCache = self._generate(colors[3])
+        self.assertTrue(fromCache)
+        _, _, fromCache = self._generate(colors[0])
+        self.assertTrue(fromCache)
+
+    def testDisabled(self):
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(self._cacheDir, 0)
+        self._generate()
+        _, _, fromCache = self._generate()
+        self.assertFalse(fromCache)
+        self.assertEqual(self._entries(), [])
+
+    @unittest.skipIf(os.name == 'nt', 'The directory permissions are only checked on POSIX.')
+    def testSharedDirectory(self):
+        # Entries are neither read from nor written to a directory other users can write to.
+        os.chmod(self._cacheDir, 0o777)
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(self._cacheDir, 64 * 1024 * 1024)
+        self._generate()
+        _, _, fromCache = self._generate()
+        self.assertFalse(fromCache)
+        self.assertEqual(self._entries(), [])
+
+    def testCreatedDirectory(self):
+        # A missing directory is created private to the user.
+        cacheDir = os.path.join(self._cacheDir, 'created')
+        mayaUsd.lib.OgsFragmentCache.SetDirectory(cacheDir, 64 * 1024 * 1024)
+        self._generate()
+        _, _, fromCache = self._generate()
+        self.assertTrue(fromCache)
+        if os.name != 'nt':
+            self.assertEqual(os.stat(cacheDir).st_mode & 0o077, 0)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
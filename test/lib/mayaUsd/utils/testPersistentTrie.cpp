@@ -0,0 +1,258 @@
+#include <mayaUsd/utils/persistentTrie.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using Trie = MayaUsd::PersistentTrie<std::string>;
+using Key = Ufe::PathSegment::Components;
+using Contents = std::map<std::vector<std::string>, std::string>;
+
+namespace {
+
+Key makeKey(const std::vector<std::string>& names)
+{
+    Key key;
+    for (const auto& name : names) {
+        key.push_back(Ufe::PathComponent(name));
+    }
+    return key;
+}
+
+std::vector<std::string> leafNames(int stage, int group, int prim)
+{
+    return { "world",
+             "proxyShape" + std::to_string(stage),
+             "group" + std::to_string(group),
+             "prim" + std::to_string(prim) };
+}
+
+// A trie shaped like the pulled prims of large scenes: a few stages, each with
+// many groups of pulled prims.
+Trie makeTrie(int nbStages, int nbGroups, int nbPrims, Contents* contents = nullptr)
+{
+    Trie trie;
+    for (int stage = 0; stage < nbStages; ++stage) {
+        for (int group = 0; group < nbGroups; ++group) {
+            for (int prim = 0; prim < nbPrims; ++prim) {
+                const auto names = leafNames(stage, group, prim);
+                const auto data = "|world|pulled" + std::to_string(prim);
+                trie.add(makeKey(names), data);
+                if (contents) {
+                    (*contents)[names] = data;
+                }
+            }
+        }
+    }
+    return trie;
+}
+
+void collectContents(
+    const Trie::NodePtr&      node,
+    std::vector<std::string>& names,
+    Contents&                 contents)
+{
+    if (node->hasData()) {
+        contents[names] = node->data();
+    }
+    for (const auto& child : node->children()) {
+        EXPECT_EQ(child.first, child.second->component().string());
+        // Nodes without data nor children are pruned.
+        EXPECT_TRUE(child.second->hasData() || !child.second->empty());
+        names.push_back(child.first);
+        collectContents(child.second, names, contents);
+        names.pop_back();
+    }
+}
+
+Contents contentsOf(const Trie& trie)
+{
+    Contents                 contents;
+    std::vector<std::string> names;
+    collectContents(trie.root(), names, contents);
+    return contents;
+}
+
+void collectNodes(const Trie::NodePtr& node, std::set<const Trie::Node*>& nodes)
+{
+    nodes.insert(node.get());
+    for (const auto& child : node->children()) {
+        collectNodes(child.second, nodes);
+    }
+}
+
+} // namespace
+
+TEST(PersistentTrie, addFindRemove)
+{
+    Trie trie;
+    EXPECT_TRUE(trie.empty());
+
+    const Key leaf = makeKey({ "a", "b", "c" });
+    const Key sibling = makeKey({ "a", "b", "d" });
+    const Key parent = makeKey({ "a", "b" });
+
+    trie.add(leaf, "c");
+    trie.add(sibling, "d");
+    EXPECT_FALSE(trie.empty());
+    ASSERT_TRUE(trie.find(leaf));
+    EXPECT_EQ(trie.find(leaf)->data(), "c");
+    EXPECT_EQ(trie.find(leaf)->component().string(), "c");
+
+    // Internal nodes exist, but have no data.
+    EXPECT_TRUE(trie.node(parent));
+    EXPECT_FALSE(trie.find(parent));
+    EXPECT_TRUE(trie.containsDescendant(parent));
+    EXPECT_FALSE(trie.containsDescendant(leaf));
+    EXPECT_TRUE(trie.containsDescendantInclusive(leaf));
+    EXPECT_FALSE(trie.containsDescendantInclusive(makeKey({ "a", "x" })));
+
+    // Adding to an existing key replaces its data.
+    trie.add(leaf, "c2");
+    EXPECT_EQ(trie.find(leaf)->data(), "c2");
+
+    EXPECT_TRUE(trie.remove(leaf));
+    EXPECT_FALSE(trie.remove(leaf));
+    EXPECT_FALSE(trie.node(leaf));
+    EXPECT_TRUE(trie.find(sibling));
+
+    // Removing the last data prunes the ancestors.
+    EXPECT_TRUE(trie.remove(sibling));
+    EXPECT_FALSE(trie.node(parent));
+    EXPECT_TRUE(trie.empty());
+}
+
+TEST(PersistentTrie, move)
+{
+    Trie trie;
+    trie.add(makeKey({ "a", "b", "c" }), "c");
+    trie.add(makeKey({ "a", "b", "d" }), "d");
+    trie.add(makeKey({ "a", "e" }), "e");
+
+    // Rename.
+    trie.move(makeKey({ "a", "b" }), makeKey({ "a", "f" }));
+    EXPECT_FALSE(trie.node(makeKey({ "a", "b" })));
+    ASSERT_TRUE(trie.node(makeKey({ "a", "f" })));
+    EXPECT_EQ(trie.node(makeKey({ "a", "f" }))->component().string(), "f");
+    EXPECT_EQ(trie.find(makeKey({ "a", "f", "c" }))->data(), "c");
+
+    // Reparent, pruning the old parent.
+    trie.move(makeKey({ "a", "f" }), makeKey({ "g", "f" }));
+    trie.move(makeKey({ "a", "e" }), makeKey({ "g", "e" }));
+    EXPECT_FALSE(trie.node(makeKey({ "a" })));
+    EXPECT_EQ(trie.find(makeKey({ "g", "f", "d" }))->data(), "d");
+    EXPECT_EQ(trie.find(makeKey({ "g", "e" }))->data(), "e");
+
+    // Moving a missing key does nothing.
+    const Contents before = contentsOf(trie);
+    trie.move(makeKey({ "x" }), makeKey({ "y" }));
+    EXPECT_EQ(contentsOf(trie), before);
+}
+
+TEST(PersistentTrie, copiesShareUnchangedNodes)
+{
+    const Trie original = makeTrie(4, 50, 50);
+
+    std::set<const Trie::Node*> originalNodes;
+    collectNodes(original.root(), originalNodes);
+
+    // Removing a leaf copies only its ancestors: root, world, proxy shape and group.
+    Trie edited = original;
+    EXPECT_TRUE(edited.remove(makeKey(leafNames(2, 10, 10))));
+
+    std::set<const Trie::Node*> allNodes = originalNodes;
+    collectNodes(edited.root(), allNodes);
+    EXPECT_EQ(allNodes.size(), originalNodes.size() + 4);
+
+    EXPECT_EQ(
+        original.node(makeKey({ "world", "proxyShape2", "group11" })),
+        edited.node(makeKey({ "world", "proxyShape2", "group11" })));
+    EXPECT_NE(
+        original.node(makeKey({ "world", "proxyShape2", "group10" })),
+        edited.node(makeKey({ "world", "proxyShape2", "group10" })));
+
+    // The original is unchanged.
+    EXPECT_TRUE(original.find(makeKey(leafNames(2, 10, 10))));
+    EXPECT_FALSE(edited.find(makeKey(leafNames(2, 10, 10))));
+}
+
+TEST(PersistentTrie, undoRedo)
+{
+    // Apply a sequence of edits, keeping a copy of the trie before each, as
+    // the undo items keep the orphaned nodes manager mementos. Restoring the
+    // copies in reverse order must give back the exact previous contents.
+    Contents     contents;
+    Trie         trie = makeTrie(3, 40, 40, &contents);
+    const size_t nbEdits = 500;
+
+    std::vector<Trie>     undoStack;
+    std::vector<Contents> expected;
+    for (size_t i = 0; i < nbEdits; ++i) {
+        undoStack.push_back(trie);
+        expected.push_back(contents);
+
+        const int stage = int(i % 3);
+        const int group = int((i * 7) % 40);
+        const int prim = int((i * 13) % 40);
+        switch (i % 4) {
+        case 0: {
+            // Discard or merge of a pulled prim.
+            const auto names = leafNames(stage, group, prim);
+            trie.remove(makeKey(names));
+            contents.erase(names);
+        } break;
+        case 1: {
+            // Edit as Maya.
+            auto names = leafNames(stage, group, prim);
+            names.back() += "_pulled" + std::to_string(i);
+            trie.add(makeKey(names), names.back());
+            contents[names] = names.back();
+        } break;
+        case 2: {
+            // Rename of an ancestor of pulled prims.
+            const std::vector<std::string> oldGroup = { "world",
+                                                        "proxyShape" + std::to_string(stage),
+                                                        "group" + std::to_string(group) };
+            std::vector<std::string>       newGroup = oldGroup;
+            newGroup.back() += "_renamed" + std::to_string(i);
+            trie.move(makeKey(oldGroup), makeKey(newGroup));
+
+            Contents moved;
+            for (const auto& entry : contents) {
+                auto names = entry.first;
+                if (std::equal(oldGroup.begin(), oldGroup.end(), names.begin())) {
+                    names[oldGroup.size() - 1] = newGroup.back();
+                }
+                moved[names] = entry.second;
+            }
+            contents.swap(moved);
+        } break;
+        default: {
+            // Update of the pull information.
+            auto it = contents.begin();
+            std::advance(it, (i * 31) % contents.size());
+            it->second += "_updated";
+            trie.add(makeKey(it->first), it->second);
+        } break;
+        }
+        ASSERT_EQ(contentsOf(trie), contents) << "edit " << i;
+    }
+
+    std::vector<Trie> redoStack;
+    for (size_t i = nbEdits; i-- > 0;) {
+        redoStack.push_back(trie);
+        trie = undoStack[i];
+        ASSERT_EQ(contentsOf(trie), expected[i]) << "undo " << i;
+    }
+    for (size_t i = 0; i < nbEdits; ++i) {
+        trie = redoStack.back();
+        redoStack.pop_back();
+        const Contents& redone = (i + 1 < nbEdits) ? expected[i + 1] : contents;
+        ASSERT_EQ(contentsOf(trie), redone) << "redo " << i;
+    }
+}
@@ -0,0 +1,145 @@
+#include <mayaUsd/fileio/pullInformation.h>
+#include <mayaUsd/utils/primActivation.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Count the ObjectsChanged notices sent by a stage, each one being a recomposition.
+class NoticeCounter : public TfWeakBase
+{
+public:
+    NoticeCounter(const UsdStagePtr& stage)
+    {
+        _key = TfNotice::Register(TfCreateWeakPtr(this), &NoticeCounter::_onChanged, stage);
+    }
+
+    ~NoticeCounter() { TfNotice::Revoke(_key); }
+
+    size_t count = 0;
+
+private:
+    void _onChanged(const UsdNotice::ObjectsChanged&, const UsdStageWeakPtr&) { ++count; }
+
+    TfNotice::Key _key;
+};
+
+// Create /a/b/p0.../a/b/pN under the inactive /a/b, and /c/q0.../c/qN.
+UsdStageRefPtr createStage(size_t count, SdfPathVector& hiddenPaths, SdfPathVector& visiblePaths)
+{
+    auto stage = UsdStage::CreateInMemory();
+    for (size_t i = 0; i < count; ++i) {
+        hiddenPaths.emplace_back("/a/b/p" + std::to_string(i));
+        visiblePaths.emplace_back("/c/q" + std::to_string(i));
+        stage->DefinePrim(hiddenPaths.back());
+        stage->DefinePrim(visiblePaths.back());
+    }
+    stage->GetPrimAtPath(SdfPath("/a/b")).SetActive(false);
+    return stage;
+}
+
+bool hasSessionActive(const UsdStagePtr& stage, const SdfPath& path)
+{
+    return stage->GetSessionLayer()->HasField(path, SdfFieldKeys->Active);
+}
+
+} // namespace
+
+TEST(PrimActivation, batchActivation)
+{
+    SdfPathVector hiddenPaths;
+    SdfPathVector visiblePaths;
+    auto          stage = createStage(10, hiddenPaths, visiblePaths);
+
+    NoticeCounter counter(stage);
+    {
+        MayaUsd::PrimActivation activation(stage, hiddenPaths);
+
+        // All the ancestors are activated at once.
+        EXPECT_EQ(counter.count, 1u);
+        for (const SdfPath& path : hiddenPaths)
+            EXPECT_TRUE(stage->GetPrimAtPath(path).IsValid());
+    }
+
+    // And restored at once.
+    EXPECT_EQ(counter.count, 2u);
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/a/b")).IsActive());
+    EXPECT_FALSE(stage->GetPrimAtPath(hiddenPaths[0]).IsValid());
+    EXPECT_FALSE(hasSessionActive(stage, SdfPath("/a/b")));
+}
+
+TEST(PrimActivation, nestedInactiveAncestors)
+{
+    auto stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/x/y/z"));
+    stage->GetPrimAtPath(SdfPath("/x/y")).SetActive(false);
+    stage->GetPrimAtPath(SdfPath("/x")).SetActive(false);
+
+    // The session layer already deactivates /x: it must be deactivated again on restore.
+    SdfCreatePrimInLayer(stage->GetSessionLayer(), SdfPath("/x"))->SetActive(false);
+
+    NoticeCounter counter(stage);
+    {
+        MayaUsd::PrimActivation activation(stage, { SdfPath("/x/y/z") });
+
+        // One recomposition per level of inactive ancestors.
+        EXPECT_EQ(counter.count, 2u);
+        EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/x/y/z")).IsValid());
+    }
+
+    EXPECT_EQ(counter.count, 3u);
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/x")).IsActive());
+    EXPECT_TRUE(hasSessionActive(stage, SdfPath("/x")));
+    EXPECT_FALSE(hasSessionActive(stage, SdfPath("/x/y")));
+}
+
+TEST(PrimActivation, excludeFromRenderingForMultiplePulledPrims)
+{
+    SdfPathVector hiddenPaths;
+    SdfPathVector visiblePaths;
+    auto          stage = createStage(100, hiddenPaths, visiblePaths);
+
+    NoticeCounter counter(stage);
+
+    // Prims with active ancestors are all excluded in a single change block.
+    EXPECT_TRUE(MayaUsd::addExcludeFromRendering(stage, visiblePaths));
+    EXPECT_EQ(counter.count, 1u);
+    for (const SdfPath& path : visiblePaths) {
+        EXPECT_FALSE(stage->GetPrimAtPath(path).IsActive());
+        EXPECT_TRUE(hasSessionActive(stage, path));
+    }
+
+    EXPECT_TRUE(MayaUsd::removeExcludeFromRendering(stage, visiblePaths));
+    EXPECT_EQ(counter.count, 2u);
+    for (const SdfPath& path : visiblePaths) {
+        EXPECT_TRUE(stage->GetPrimAtPath(path).IsActive());
+        EXPECT_FALSE(hasSessionActive(stage, path));
+    }
+
+    // Prims below an inactive ancestor need the ancestor to be activated first,
+    // then the exclusion and the restoration of the ancestor share a change block.
+    counter.count = 0;
+    EXPECT_TRUE(MayaUsd::addExcludeFromRendering(stage, hiddenPaths));
+    EXPECT_EQ(counter.count, 2u);
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/a/b")).IsActive());
+    EXPECT_FALSE(hasSessionActive(stage, SdfPath("/a/b")));
+    for (const SdfPath& path : hiddenPaths)
+        EXPECT_TRUE(hasSessionActive(stage, path));
+
+    // Missing prims are reported.
+    EXPECT_FALSE(MayaUsd::addExcludeFromRendering(stage, { SdfPath("/missing") }));
+}
@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import json
+import os
+import tempfile
+import unittest
+
+from maya import cmds
+from maya.api import OpenMaya as om
+import mayaUsd_createStageWithNewLayer
+import mayaUsd
+from pxr import Trace, UsdGeom
+
+
+class MayaUsdProfileTraceCommandTestCase(unittest.TestCase):
+    """ test the 'mayaUsdProfileTrace' command """
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin')
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        shapePath = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(shapePath).GetStage()
+        UsdGeom.Sphere.Define(stage, '/ball')
+
+        self.traceFile = os.path.join(tempfile.mkdtemp(), 'profileTrace.json')
+
+    def testProfileTrace(self):
+        result = cmds.mayaUsdProfileTrace(file=self.traceFile, frames=3, startFrame=1)
+        self.assertEqual(result, self.traceFile)
+
+        with open(self.traceFile) as traceFile:
+            trace = json.load(traceFile)
+
+        self.assertEqual(trace['frames'], 3)
+        self.assertIn('traceEvents', trace)
+
+        # Maya and USD events are reported as two named processes.
+        processNames = [e['args']['name'] for e in trace['traceEvents'] if e['ph'] == 'M']
+        self.assertEqual(processNames, ['Maya', 'USD'])
+
+        # Aggregates are sorted from the most expensive scope.
+        totals = [s['totalUs'] for s in trace['stats']]
+        self.assertEqual(totals, sorted(totals, reverse=True))
+        for scopeStats in trace['stats']:
+            self.assertGreater(scopeStats['count'], 0)
+            self.assertLessEqual(scopeStats['minUs'], scopeStats['maxUs'])
+
+    def testProfileTraceEvents(self):
+        # Record a Maya profiler event and a USD trace event on each frame.
+        category = om.MProfiler.addCategory('testProfileTrace', 'mayaUsdProfileTrace test')
+
+        def onTimeChanged(time, clientData):
+            eventId = om.MProfiler.eventBegin(category, om.MProfiler.kColorE_L1, 'testMayaEvent')
+            om.MProfiler.eventEnd(eventId)
+            Trace.Collector().BeginEvent('testUsdEvent')
+            Trace.Collector().EndEvent('testUsdEvent')
+
+        # The profiler data recorded before the command is kept.
+        om.MProfiler.setCategoryRecording(category, True)
+        om.MProfiler.setRecordingActive(True)
+        onTimeChanged(None, None)
+        om.MProfiler.setRecordingActive(False)
+        eventCount = om.MProfiler.getEventCount()
+        self.assertGreater(eventCount, 0)
+
+        callbackId = om.MDGMessage.addTimeChangeCallback(onTimeChanged)
+        try:
+            cmds.mayaUsdProfileTrace(
+                file=self.traceFile, frames=2, startFrame=2, category='testProfileTrace')
+        finally:
+            om.MMessage.removeCallback(callbackId)
+
+        self.assertGreaterEqual(om.MProfiler.getEventCount(), eventCount)
+
+        with open(self.traceFile) as traceFile:
+            trace = json.load(traceFile)
+
+        # Only the events of the frames viewed by the command are reported.
+        mayaEvents = [e for e in trace['traceEvents']
+                      if e['pid'] == 0 and e.get('name') == 'testMayaEvent']
+        self.assertEqual(len(mayaEvents), 2)
+        for event in mayaEvents:
+            self.assertEqual(event['ph'], 'X')
+            self.assertEqual(event['cat'], 'testProfileTrace')
+
+        usdEvents = [e for e in trace['traceEvents']
+                     if e['pid'] == 1 and e.get('name') == 'testUsdEvent']
+        self.assertGreater(len(usdEvents), 0)
+
+        stats = dict(((s['category'], s['name']), s) for s in trace['stats'])
+        self.assertEqual(stats[('testProfileTrace', 'testMayaEvent')]['count'], 2)
+        self.assertEqual(stats[('USD', 'testUsdEvent')]['count'], 2)
+
+    def testProfileTraceWithoutUsd(self):
+        cmds.mayaUsdProfileTrace(
+            file=self.traceFile, frames=1, category='ProxyShapeBase', usdTrace=False)
+
+        with open(self.traceFile) as traceFile:
+            trace = json.load(traceFile)
+
+        for event in trace['traceEvents']:
+            self.assertEqual(event['pid'], 0)
+            if event['ph'] != 'M':
+                self.assertEqual(event['cat'], 'ProxyShapeBase')
+
+    def testProfileTraceErrors(self):
+        # The output file is required.
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdProfileTrace(frames=1)
+
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdProfileTrace(file=self.traceFile, frames=0)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -9,7 +9,7 @@ import ufeUtils
 import ufe
 import unittest
 import usdUtils
-from pxr import UsdGeom
+from pxr import Sdf, UsdGeom
 
 #####################################################################
 #
@@ -322,6 +322,73 @@ class EditRoutingTestCase(unittest.TestCase):
         except Exception:
             self.assertFalse(True, "Should have been able to create a command")
 
+    def testCacheableEditRouter(self):
+        '''
+        Test that a cacheable edit router is only called once per operation,
+        prim and attribute, until the stage or the edit routers change.
+        '''
+
+        prim = mayaUsd.ufe.ufePathToPrim("|stage1|stageShape1,/B")
+        stage = prim.GetStage()
+        sessionLayer = stage.GetSessionLayer()
+
+        calls = []
+        def countingRouter(context, routingData):
+            calls.append(context.get('attribute'))
+            routeVisibilityAttribute(context, routingData)
+
+        mayaUsd.lib.registerEditRouter('attribute', countingRouter, cacheable=True)
+
+        # The first edit creates B in the session layer, which resyncs it.
+        attrs = ufe.Attributes.attributes(self.b)
+        visibilityAttr = attrs.attribute(UsdGeom.Tokens.visibility)
+        visibilityAttr.set(UsdGeom.Tokens.invisible)
+        self.assertIsNotNone(sessionLayer.GetAttributeAtPath('/B.visibility'))
+        del calls[:]
+
+        # Repeated edits of the same attribute, as when dragging a manipulator,
+        # only call the edit router once.
+        for visibility in [UsdGeom.Tokens.invisible, UsdGeom.Tokens.inherited] * 3:
+            visibilityAttr.set(visibility)
+        self.assertEqual(len(calls), 1)
+
+        # Other attributes are routed separately.
+        mayaUsd.lib.AttributeEditRouterContext(prim, 'xformOp:translate')
+        mayaUsd.lib.AttributeEditRouterContext(prim, 'xformOp:translate')
+        self.assertEqual(len(calls), 2)
+
+        # Each edit target has its own layers, and changing the edit target
+        # keeps the layers of the other ones.
+        stage.SetEditTarget(sessionLayer)
+        visibilityAttr.set(UsdGeom.Tokens.invisible)
+        self.assertEqual(len(calls), 3)
+        stage.SetEditTarget(stage.GetRootLayer())
+        visibilityAttr.set(UsdGeom.Tokens.inherited)
+        self.assertEqual(len(calls), 3)
+
+        # Changing the layer stack invalidates the cache.
+        subLayer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.append(subLayer.identifier)
+        visibilityAttr.set(UsdGeom.Tokens.invisible)
+        self.assertEqual(len(calls), 4)
+
+        # So does clearing it explicitly.
+        mayaUsd.lib.clearEditRouterCache()
+        visibilityAttr.set(UsdGeom.Tokens.inherited)
+        self.assertEqual(len(calls), 5)
+
+        # And registering an edit router.
+        mayaUsd.lib.registerEditRouter('attribute', countingRouter, cacheable=True)
+        visibilityAttr.set(UsdGeom.Tokens.invisible)
+        self.assertEqual(len(calls), 6)
+
+        # Edit routers that are not cacheable are called for every edit.
+        del calls[:]
+        mayaUsd.lib.registerEditRouter('attribute', countingRouter)
+        for visibility in [UsdGeom.Tokens.invisible, UsdGeom.Tokens.inherited] * 3:
+            visibilityAttr.set(visibility)
+        self.assertGreaterEqual(len(calls), 6)
+
     def _verifyEditRouterPreventingCmd(self, operationName, cmdFunc, verifyFunc):
         '''
         Test that an edit router can prevent a command for the given operation name,
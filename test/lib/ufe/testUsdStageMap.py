@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUsd_createStageWithNewLayer
+
+import mayaUsd.ufe
+
+from maya import cmds
+from maya import standalone
+from maya.api import OpenMaya as om
+
+import unittest
+
+
+class UsdStageMapTestCase(unittest.TestCase):
+    '''Verify that the proxy shape path to stage map follows scene changes.'''
+
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+    def testRenameAndReparent(self):
+        shapePath = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(shapePath)
+        self.assertIsNotNone(stage)
+        self.assertEqual(mayaUsd.ufe.stagePath(stage), shapePath)
+
+        # Renaming the proxy shape transform updates both directions.
+        cmds.rename('|stage1', 'renamedStage')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage), '|renamedStage|stageShape1')
+        self.assertEqual(mayaUsd.ufe.getStage('|renamedStage|stageShape1'), stage)
+        self.assertIsNone(mayaUsd.ufe.getStage(shapePath))
+
+        # Reparenting the transform too.
+        cmds.group('|renamedStage', name='parentGroup')
+        newPath = '|parentGroup|renamedStage|stageShape1'
+        self.assertEqual(mayaUsd.ufe.stagePath(stage), newPath)
+        self.assertEqual(mayaUsd.ufe.getStage(newPath), stage)
+
+        # And renaming an ancestor of the transform.
+        cmds.rename('|parentGroup', 'otherGroup')
+        newPath = '|otherGroup|renamedStage|stageShape1'
+        self.assertEqual(mayaUsd.ufe.stagePath(stage), newPath)
+
+        cmds.undo()
+        self.assertEqual(
+            mayaUsd.ufe.stagePath(stage), '|parentGroup|renamedStage|stageShape1')
+
+    def testOtherProxyShapeAncestors(self):
+        shapePath1 = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        shapePath2 = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage1 = mayaUsd.ufe.getStage(shapePath1)
+        stage2 = mayaUsd.ufe.getStage(shapePath2)
+        self.assertNotEqual(stage1, stage2)
+
+        # Only the proxy shapes below the changed node get a new path.
+        cmds.group('|stage1', name='group1')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage1), '|group1|stage1|stageShape1')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage2), shapePath2)
+
+        cmds.rename('|group1', 'renamedGroup')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage1), '|renamedGroup|stage1|stageShape1')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage2), shapePath2)
+        self.assertEqual(mayaUsd.ufe.getStage(shapePath2), stage2)
+
+        cmds.parent('|stage2', '|renamedGroup')
+        self.assertEqual(mayaUsd.ufe.stagePath(stage2), '|renamedGroup|stage2|stageShape2')
+        self.assertEqual(mayaUsd.ufe.getStage('|renamedGroup|stage2|stageShape2'), stage2)
+
+    def testDeleteAndUndo(self):
+        shapePath = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(shapePath)
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), 1)
+
+        cmds.delete('|stage1')
+        self.assertIsNone(mayaUsd.ufe.getStage(shapePath))
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), 0)
+
+        cmds.undo()
+        self.assertEqual(mayaUsd.ufe.getStage(shapePath), stage)
+        self.assertEqual(mayaUsd.ufe.stagePath(stage), shapePath)
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), 1)
+
+        # A new scene empties the map.
+        cmds.file(new=True, force=True)
+        self.assertIsNone(mayaUsd.ufe.getStage(shapePath))
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), 0)
+
+    def testLookupScaling(self):
+        '''Lookups should not scan the scene, whatever the number of proxy shapes.'''
+
+        shapePaths = [mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+                      for _ in range(300)]
+        stages = [mayaUsd.ufe.getStage(p) for p in shapePaths]
+        self.assertEqual(len(set(stages)), len(shapePaths))
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), len(shapePaths))
+
+        # A scan of the scene lists the proxy shapes with the ls command.
+        commands = []
+        def commandCallback(command, clientData):
+            commands.append(command)
+        callbackId = om.MCommandMessage.addCommandCallback(commandCallback)
+        try:
+            for shapePath, stage in zip(shapePaths, stages):
+                self.assertEqual(mayaUsd.ufe.getStage(shapePath), stage)
+                self.assertEqual(mayaUsd.ufe.stagePath(stage), shapePath)
+
+            # Unknown paths are not found without a scan either.
+            self.assertIsNone(mayaUsd.ufe.getStage('|noSuchStage|noSuchStageShape'))
+        finally:
+            om.MMessage.removeCallback(callbackId)
+
+        scans = [c for c in commands if c.lstrip().startswith('ls ')]
+        self.assertEqual(scans, [])
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -128,5 +128,92 @@ class TestUsdExportBlendshapes(unittest.TestCase):
         self.assertEqual(blendShapes[0].GetName(), "tgt1")
         self.assertEqual(blendShapes[1].GetName(), "tgt0")
 
+    def testBlendShapesSparseExport(self):
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        cmds.polyMoveVertex('{}.vtx[0:2]'.format(target), s=(1.0, 1.5, 1.0))
+        # NOTE: This offset is below the export epsilon and must be dropped.
+        cmds.polyMoveVertex('{}.vtx[3]'.format(target), t=(0.0, 0.00001, 0.0))
+        duplicate, _ = cmds.polyCube(name="blendDuplicate")
+        cmds.parent(duplicate, parent)
+        cmds.polyMoveVertex('{}.vtx[0:2]'.format(duplicate), s=(1.0, 1.5, 1.0))
+
+        cmds.blendShape(target, duplicate, base, automatic=True)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapeSparse.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto", bse=0.001)
+
+        stage = Usd.Stage.Open(temp_file)
+        blendShapes = [UsdSkel.BlendShape(prim) for prim in stage.GetPrimAtPath("/root/base").GetChildren()
+                       if prim.GetTypeName() == 'BlendShape']
+        self.assertEqual(len(blendShapes), 2)
+
+        for blendShape in blendShapes:
+            self.assertEqual(list(blendShape.GetPointIndicesAttr().Get()), [0, 1, 2])
+            offsets = blendShape.GetOffsetsAttr().Get()
+            for i, coords in enumerate(offsets):
+                self.assertEqual(list(coords), [0, -0.25 if i < 2 else 0.25, 0])
+
+        self.assertEqual(blendShapes[0].GetOffsetsAttr().Get(), blendShapes[1].GetOffsetsAttr().Get())
+        self.assertEqual(blendShapes[0].GetNormalOffsetsAttr().Get(), blendShapes[1].GetNormalOffsetsAttr().Get())
+
+    def testBlendShapesSparseExportWithoutTargetMesh(self):
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        cmds.polyMoveVertex('{}.vtx[0:2]'.format(target), s=(1.0, 1.5, 1.0))
+        # NOTE: This offset is below the export epsilon and must be dropped.
+        cmds.polyMoveVertex('{}.vtx[3]'.format(target), t=(0.0, 0.001, 0.0))
+
+        cmds.blendShape(target, base, automatic=True)
+
+        # NOTE: Without the target mesh, the offsets are read back from the deformer itself and
+        # come with zeroed normal offsets.
+        cmds.delete(target)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapeSparseNoTarget.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto", bse=0.01)
+
+        stage = Usd.Stage.Open(temp_file)
+        blendShapes = [UsdSkel.BlendShape(prim) for prim in stage.GetPrimAtPath("/root/base").GetChildren()
+                       if prim.GetTypeName() == 'BlendShape']
+        self.assertEqual(len(blendShapes), 1)
+
+        self.assertEqual(list(blendShapes[0].GetPointIndicesAttr().Get()), [0, 1, 2])
+        self.assertEqual(len(blendShapes[0].GetOffsetsAttr().Get()), 3)
+
+    def testBlendShapesSparseExportAllPruned(self):
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        # NOTE: All the offsets are below the export epsilon and must be dropped.
+        cmds.polyMoveVertex('{}.vtx[0:3]'.format(target), t=(0.0, 0.00001, 0.0))
+
+        cmds.blendShape(target, base, automatic=True)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapeSparseAllPruned.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto", bse=0.001)
+
+        stage = Usd.Stage.Open(temp_file)
+        blendShapes = [UsdSkel.BlendShape(prim) for prim in stage.GetPrimAtPath("/root/base").GetChildren()
+                       if prim.GetTypeName() == 'BlendShape']
+        self.assertEqual(len(blendShapes), 1)
+
+        self.assertFalse(blendShapes[0].GetPointIndicesAttr().HasAuthoredValue())
+        self.assertEqual(len(blendShapes[0].GetOffsetsAttr().Get()), 0)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
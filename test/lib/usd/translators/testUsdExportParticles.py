@@ -56,5 +56,38 @@ class testUsdExportParticles(unittest.TestCase):
         self.assertEqual(p.GetWidthsAttr().Get(1), Vt.FloatArray(5, (2.0, 2.0, 2.0, 2.0, 2.0)))
         self.assertEqual(p.GetIdsAttr().Get(1), Vt.Int64Array(5, (0, 1, 2, 3, 4)))
 
+    def testExportAttributes(self):
+        particle, particleShape = cmds.particle(
+            p=[(0.0, 0.0, 0.0), (1.0, 0.0, 0.0), (2.0, 0.0, 0.0)], name='attrParticle')
+        cmds.addAttr(particleShape, longName='customPP', dataType='doubleArray')
+        cmds.addAttr(particleShape, longName='customVectorPP', dataType='vectorArray')
+        for i in range(3):
+            cmds.particle(particleShape, e=True, attribute='customPP', order=i,
+                floatValue=0.5 * i)
+            cmds.particle(particleShape, e=True, attribute='customVectorPP', order=i,
+                vectorValue=(i, 2.0 * i, 3.0 * i))
+        cmds.saveInitialState(particleShape)
+
+        usdFile = os.path.abspath('UsdExportParticles_attributes.usda')
+        cmds.select(particle, replace=True)
+        cmds.usdExport(mergeTransformAndShape=False, selection=True,
+            shadingMode='none', file=usdFile, frameRange=(1, 1))
+
+        stage = Usd.Stage.Open(usdFile)
+
+        p = UsdGeom.Points.Get(stage, '/{}/{}'.format(particle, particleShape))
+        self.assertTrue(p.GetPrim().IsValid())
+        self.assertEqual(p.GetPointsAttr().Get(1), Vt.Vec3fArray(3, (Gf.Vec3f(0.0, 0.0, 0.0), Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3f(2.0, 0.0, 0.0))))
+        self.assertEqual(p.GetIdsAttr().Get(1), Vt.Int64Array(3, (0, 1, 2)))
+
+        masses = p.GetPrim().GetAttribute('mass').Get(1)
+        self.assertEqual(list(masses), [1.0, 1.0, 1.0])
+
+        custom = p.GetPrim().GetAttribute('customPP').Get(1)
+        self.assertEqual(list(custom), [0.0, 0.5, 1.0])
+
+        customVector = p.GetPrim().GetAttribute('customVectorPP').Get(1)
+        self.assertEqual(customVector, Vt.Vec3fArray(3, (Gf.Vec3f(0.0, 0.0, 0.0), Gf.Vec3f(1.0, 2.0, 3.0), Gf.Vec3f(2.0, 4.0, 6.0))))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -0,0 +1,92 @@
+#include <mayaUsd/fileio/importData.h>
+#include <mayaUsdUI/ui/IMayaMQtUtil.h>
+#include <mayaUsdUI/ui/TreeModel.h>
+#include <mayaUsdUI/ui/TreeModelFactory.h>
+
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/variantSets.h>
+
+#include <QtGui/QPixmap>
+#include <QtTest/QSignalSpy>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+using namespace MayaUsd;
+
+namespace {
+
+class TestMayaQtUtil : public IMayaMQtUtil
+{
+public:
+    int      dpiScale(int size) const override { return size; }
+    float    dpiScale(float size) const override { return size; }
+    QPixmap* createPixmap(const std::string&) const override { return new QPixmap(); }
+};
+
+// A prim with two variant sets, nested below prims whose rows are not created.
+UsdStageRefPtr createVariantStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/A/D"));
+    UsdPrim prim = stage->DefinePrim(SdfPath("/A/B/C"));
+
+    UsdVariantSet shading = prim.GetVariantSets().AddVariantSet("shading");
+    shading.AddVariant("red");
+    shading.AddVariant("blue");
+    shading.SetVariantSelection("red");
+    UsdVariantSet lod = prim.GetVariantSets().AddVariantSet("lod");
+    lod.AddVariant("high");
+    lod.AddVariant("low");
+    lod.SetVariantSelection("high");
+    return stage;
+}
+
+} // namespace
+
+TEST(ImportTreeModel, restoreVariantSelections)
+{
+    UsdStageRefPtr stage = createVariantStage();
+    TestMayaQtUtil mayaQtUtil;
+
+    // The selections stored by a previous run of the dialog.
+    ImportData                        importData;
+    ImportData::PrimVariantSelections storedSelections;
+    storedSelections[SdfPath("/A/B/C")]["shading"] = "blue";
+    importData.setPrimVariantSelections(storedSelections);
+
+    auto treeModel = TreeModelFactory::createFromStage(stage, mayaQtUtil, &importData);
+    QSignalSpy modifiedSpy(treeModel.get(), &TreeModel::modifiedVariantCountChanged);
+    treeModel->restoreVariantSelections();
+    treeModel->setRootPrimPath("/");
+    ASSERT_GT(modifiedSpy.count(), 0);
+    EXPECT_EQ(modifiedSpy.last().at(0).toInt(), 1);
+
+    // Accepting the dialog without displaying the prim returns the stored selection, with
+    // the current selection of the other variant set.
+    ImportData::PrimVariantSelections selections;
+    treeModel->fillPrimVariantSelections(selections, QModelIndex());
+    ASSERT_EQ(selections.size(), 1u);
+    const SdfVariantSelectionMap& varSels = selections[SdfPath("/A/B/C")];
+    EXPECT_EQ(varSels.size(), 2u);
+    EXPECT_EQ(varSels.at("shading"), "blue");
+    EXPECT_EQ(varSels.at("lod"), "high");
+
+    // Reopening the dialog with the accepted selections restores them again.
+    ImportData reopenedData;
+    reopenedData.setPrimVariantSelections(selections);
+    auto reopenedModel = TreeModelFactory::createFromStage(stage, mayaQtUtil, &reopenedData);
+    reopenedModel->restoreVariantSelections();
+    ImportData::PrimVariantSelections reopenedSelections;
+    reopenedModel->fillPrimVariantSelections(reopenedSelections, QModelIndex());
+    EXPECT_EQ(reopenedSelections, selections);
+
+    // Resetting the file drops them.
+    reopenedModel->resetVariants();
+    reopenedSelections.clear();
+    reopenedModel->fillPrimVariantSelections(reopenedSelections, QModelIndex());
+    EXPECT_TRUE(reopenedSelections.empty());
+}
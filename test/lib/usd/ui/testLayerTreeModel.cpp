@@ -0,0 +1,232 @@
+#include "abstractCommandHook.h"
+#include "layerTreeItem.h"
+#include "layerTreeModel.h"
+#include "sessionState.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/systemInfo.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtTest/QAbstractItemModelTester>
+#include <QtTest/QSignalSpy>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+using namespace UsdLayerEditor;
+
+namespace {
+
+// The layer editor commands are never run by the model updates.
+class TestCommandHook : public AbstractCommandHook
+{
+public:
+    TestCommandHook(SessionState* in_sessionState)
+        : AbstractCommandHook(in_sessionState)
+    {
+    }
+
+    void     setEditTarget(UsdLayer) override { }
+    void     insertSubLayerPath(UsdLayer, Path, int) override { }
+    void     removeSubLayerPath(UsdLayer, Path) override { }
+    void     replaceSubLayerPath(UsdLayer, Path, Path) override { }
+    void     moveSubLayerPath(Path, UsdLayer, UsdLayer, int) override { }
+    void     discardEdits(UsdLayer) override { }
+    void     clearLayer(UsdLayer) override { }
+    UsdLayer addAnonymousSubLayer(UsdLayer, std::string) override { return nullptr; }
+    void     muteSubLayer(UsdLayer, bool) override { }
+    void     openUndoBracket(const QString&) override { }
+    void     closeUndoBracket() override { }
+    void     showLayerEditorHelp() override { }
+    void     selectPrimsWithSpec(UsdLayer) override { }
+    bool     isProxyShapeStageIncoming(const std::string&) override { return false; }
+    bool     isProxyShapeSharedStage(const std::string&) override { return true; }
+};
+
+class TestSessionState : public SessionState
+{
+public:
+    TestSessionState()
+        : _commandHook(this)
+    {
+    }
+
+    AbstractCommandHook*     commandHook() override { return &_commandHook; }
+    std::vector<StageEntry>  allStages() const override { return {}; }
+    std::string              defaultLoadPath() const override { return {}; }
+    std::vector<std::string> loadLayersUI(const QString&, const std::string&) const override
+    {
+        return {};
+    }
+    bool saveLayerUI(QWidget*, std::string*, const SdfLayerRefPtr&) const override
+    {
+        return false;
+    }
+    void printLayer(const SdfLayerRefPtr&) const override { }
+    void setupCreateMenu(QMenu*) override { }
+    void rootLayerPathChanged(std::string const&) override { }
+
+private:
+    TestCommandHook _commandHook;
+};
+
+class LayerTreeModelTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _rootLayer = SdfLayer::CreateAnonymous("root");
+        for (const char* name : { "a", "b", "c" }) {
+            _subLayers.push_back(SdfLayer::CreateAnonymous(name));
+        }
+        _rootLayer->SetSubLayerPaths(
+            { _subLayers[0]->GetIdentifier(), _subLayers[1]->GetIdentifier() });
+        _stage = UsdStage::Open(_rootLayer);
+
+        _model.reset(new LayerTreeModel(&_sessionState, nullptr));
+        _tester.reset(new QAbstractItemModelTester(
+            _model.get(), QAbstractItemModelTester::FailureReportingMode::Fatal));
+
+        SessionState::StageEntry entry;
+        entry._id = "stage";
+        entry._stage = _stage;
+        entry._displayName = "stage";
+        _sessionState.setStageEntry(entry);
+    }
+
+    void TearDown() override
+    {
+        _tester.reset();
+        _model.reset();
+    }
+
+    // run the updates the model does on idle
+    void processIdleUpdates() { QCoreApplication::processEvents(); }
+
+    LayerTreeItem* rootLayerItem() const
+    {
+        for (auto item : _model->getAllItems()) {
+            if (item->isRootLayer()) {
+                return item;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<std::string> childrenPaths(const LayerTreeItem* item) const
+    {
+        std::vector<std::string> paths;
+        for (auto child : item->childrenVector()) {
+            paths.push_back(child->subLayerPath());
+        }
+        return paths;
+    }
+
+    TestSessionState                          _sessionState;
+    std::unique_ptr<LayerTreeModel>           _model;
+    std::unique_ptr<QAbstractItemModelTester> _tester;
+    SdfLayerRefPtr                            _rootLayer;
+    std::vector<SdfLayerRefPtr>               _subLayers;
+    UsdStageRefPtr                            _stage;
+};
+
+} // namespace
+
+TEST_F(LayerTreeModelTest, insertRemoveAndReorderSubLayers)
+{
+    const std::string a = _subLayers[0]->GetIdentifier();
+    const std::string b = _subLayers[1]->GetIdentifier();
+    const std::string c = _subLayers[2]->GetIdentifier();
+
+    auto rootItem = rootLayerItem();
+    ASSERT_NE(rootItem, nullptr);
+    EXPECT_EQ(childrenPaths(rootItem), std::vector<std::string>({ a, b }));
+
+    // The items of the sublayers that are still there are kept.
+    const auto itemsBefore = rootItem->childrenVector();
+
+    _rootLayer->InsertSubLayerPath(c, 1);
+    processIdleUpdates();
+    ASSERT_EQ(rootLayerItem(), rootItem);
+    EXPECT_EQ(childrenPaths(rootItem), std::vector<std::string>({ a, c, b }));
+    EXPECT_EQ(rootItem->childrenVector()[0], itemsBefore[0]);
+    EXPECT_EQ(rootItem->childrenVector()[2], itemsBefore[1]);
+
+    _rootLayer->SetSubLayerPaths({ b, a, c });
+    processIdleUpdates();
+    EXPECT_EQ(childrenPaths(rootItem), std::vector<std::string>({ b, a, c }));
+    EXPECT_EQ(rootItem->childrenVector()[0], itemsBefore[1]);
+    EXPECT_EQ(rootItem->childrenVector()[1], itemsBefore[0]);
+
+    _rootLayer->RemoveSubLayerPath(1);
+    processIdleUpdates();
+    EXPECT_EQ(childrenPaths(rootItem), std::vector<std::string>({ b, c }));
+    EXPECT_EQ(rootItem->childrenVector()[0], itemsBefore[1]);
+
+    // A sublayer of a sublayer is added under each item of its parent.
+    _subLayers[2]->InsertSubLayerPath(a, 0);
+    processIdleUpdates();
+    auto cItem = rootItem->childrenVector()[1];
+    EXPECT_EQ(childrenPaths(cItem), std::vector<std::string>({ a }));
+}
+
+TEST_F(LayerTreeModelTest, muteSubLayer)
+{
+    auto rootItem = rootLayerItem();
+    ASSERT_NE(rootItem, nullptr);
+    auto bItem = rootItem->childrenVector()[1];
+    EXPECT_FALSE(bItem->isMuted());
+
+    QSignalSpy dataChangedSpy(_model.get(), &QAbstractItemModel::dataChanged);
+    _stage->MuteLayer(_subLayers[1]->GetIdentifier());
+    processIdleUpdates();
+
+    // Muting only refreshes the items, it does not rebuild the tree.
+    EXPECT_EQ(rootItem->childrenVector()[1], bItem);
+    EXPECT_TRUE(bItem->isMuted());
+    EXPECT_TRUE(bItem->appearsMuted());
+    EXPECT_GT(dataChangedSpy.count(), 0);
+
+    _stage->UnmuteLayer(_subLayers[1]->GetIdentifier());
+    processIdleUpdates();
+    EXPECT_EQ(rootItem->childrenVector()[1], bItem);
+    EXPECT_FALSE(bItem->isMuted());
+}
+
+TEST_F(LayerTreeModelTest, createMissingSubLayer)
+{
+    const std::string missingPath = TfStringCatPaths(
+        ArchGetTmpDir(), TfStringPrintf("testLayerTreeModel_%d.usda", ArchGetProcessId()));
+    TfDeleteFile(missingPath);
+
+    _rootLayer->InsertSubLayerPath(missingPath, 0);
+    processIdleUpdates();
+    auto rootItem = rootLayerItem();
+    ASSERT_NE(rootItem, nullptr);
+    auto missingItem = rootItem->childrenVector()[0];
+    EXPECT_EQ(missingItem->subLayerPath(), missingPath);
+    EXPECT_TRUE(missingItem->isInvalidLayer());
+
+    // The next update of the layers picks up the created layer.
+    auto createdLayer = SdfLayer::CreateNew(missingPath);
+    ASSERT_TRUE(createdLayer);
+    _subLayers[0]->SetDocumentation("changed");
+    processIdleUpdates();
+
+    auto createdItem = rootItem->childrenVector()[0];
+    EXPECT_EQ(createdItem->subLayerPath(), missingPath);
+    EXPECT_FALSE(createdItem->isInvalidLayer());
+    EXPECT_EQ(createdItem->layer(), createdLayer);
+
+    createdLayer.Reset();
+    TfDeleteFile(missingPath);
+}
@@ -0,0 +1,255 @@
+#include <mayaUsdUtils/ALHalf.h>
+#include <mayaUsdUtils/SIMDKernels.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+using MayaUsdUtils::SimdIsa;
+using MayaUsdUtils::SimdKernels;
+
+namespace {
+
+// Sizes that exercise the full vector loops as well as every remainder.
+const size_t testSizes[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 257 };
+
+inline float randFloat() { return float(rand()) / RAND_MAX; }
+
+std::vector<float> randomFloats(size_t count)
+{
+    std::vector<float> values(count);
+    for (float& value : values) {
+        value = randFloat();
+    }
+    return values;
+}
+
+std::vector<double> toDoubles(const std::vector<float>& values)
+{
+    return std::vector<double>(values.begin(), values.end());
+}
+
+std::vector<GfHalf> toHalfs(const std::vector<float>& values)
+{
+    return std::vector<GfHalf>(values.begin(), values.end());
+}
+
+std::vector<float> repeated(const std::vector<float>& element, size_t count)
+{
+    std::vector<float> values;
+    for (size_t i = 0; i < count; ++i) {
+        values.insert(values.end(), element.begin(), element.end());
+    }
+    return values;
+}
+
+// The non-scalar kernel tables built into the library and supported by this machine.
+std::vector<std::pair<SimdIsa, const SimdKernels*>> vectorKernels()
+{
+    std::vector<std::pair<SimdIsa, const SimdKernels*>> result;
+    for (SimdIsa isa : { SimdIsa::kSSE, SimdIsa::kAVX2 }) {
+        if (const SimdKernels* kernels = MayaUsdUtils::simdKernels(isa)) {
+            result.emplace_back(isa, kernels);
+        }
+    }
+    return result;
+}
+
+const SimdKernels& scalarKernels() { return *MayaUsdUtils::simdKernels(SimdIsa::kScalar); }
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SIMDKernels, dispatch)
+{
+    ASSERT_NE(MayaUsdUtils::simdKernels(SimdIsa::kScalar), nullptr);
+    EXPECT_NE(MayaUsdUtils::simdKernels(MayaUsdUtils::bestSimdIsa()), nullptr);
+
+    const SimdIsa active = MayaUsdUtils::activeSimdIsa();
+    EXPECT_TRUE(MayaUsdUtils::setActiveSimdIsa(SimdIsa::kScalar));
+    EXPECT_EQ(MayaUsdUtils::activeSimdIsa(), SimdIsa::kScalar);
+    EXPECT_EQ(&MayaUsdUtils::simdKernels(), &scalarKernels());
+    EXPECT_TRUE(MayaUsdUtils::setActiveSimdIsa(active));
+
+    EXPECT_STREQ(MayaUsdUtils::simdIsaName(SimdIsa::kAVX2), "avx2");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SIMDKernels, allTheSame)
+{
+    const SimdKernels& reference = scalarKernels();
+    for (const auto& isaKernels : vectorKernels()) {
+        const SimdKernels& kernels = *isaKernels.second;
+        SCOPED_TRACE(MayaUsdUtils::simdIsaName(isaKernels.first));
+
+        for (size_t count : testSizes) {
+            for (size_t dim = 2; dim <= 4; ++dim) {
+                std::vector<float> values = repeated(randomFloats(dim), count);
+
+                // Alter the last element, so that the tail handling is checked too.
+                for (int pass = 0; pass < 2; ++pass) {
+                    const std::vector<double> doubles = toDoubles(values);
+                    switch (dim) {
+                    case 2:
+                        EXPECT_EQ(
+                            kernels.vec2fAreAllTheSame(values.data(), count),
+                            reference.vec2fAreAllTheSame(values.data(), count));
+                        EXPECT_EQ(
+                            kernels.vec2dAreAllTheSame(doubles.data(), count),
+                            reference.vec2dAreAllTheSame(doubles.data(), count));
+                        break;
+                    case 3:
+                        EXPECT_EQ(
+                            kernels.vec3fAreAllTheSame(values.data(), count),
+                            reference.vec3fAreAllTheSame(values.data(), count));
+                        EXPECT_EQ(
+                            kernels.vec3dAreAllTheSame(doubles.data(), count),
+                            reference.vec3dAreAllTheSame(doubles.data(), count));
+                        break;
+                    case 4:
+                        EXPECT_EQ(
+                            kernels.vec4fAreAllTheSame(values.data(), count),
+                            reference.vec4fAreAllTheSame(values.data(), count));
+                        EXPECT_EQ(
+                            kernels.vec4dAreAllTheSame(doubles.data(), count),
+                            reference.vec4dAreAllTheSame(doubles.data(), count));
+                        break;
+                    }
+                    if (values.empty()) {
+                        break;
+                    }
+                    values.back() += 1.0f;
+                }
+            }
+
+            std::vector<float> u(count, 0.25f), v(count, 0.75f);
+            if (count) {
+                v.back() = 0.5f;
+            }
+            EXPECT_EQ(
+                kernels.vec2AreAllTheSameUV(u.data(), v.data(), count),
+                reference.vec2AreAllTheSameUV(u.data(), v.data(), count));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SIMDKernels, compareArrays)
+{
+    const SimdKernels& reference = scalarKernels();
+    for (const auto& isaKernels : vectorKernels()) {
+        const SimdKernels& kernels = *isaKernels.second;
+        SCOPED_TRACE(MayaUsdUtils::simdIsaName(isaKernels.first));
+
+        for (size_t count : testSizes) {
+            const std::vector<float> a = randomFloats(count * 4);
+            std::vector<float>       b = a;
+            for (int pass = 0; pass < 2; ++pass) {
+                const std::vector<double> da = toDoubles(a), db = toDoubles(b);
+                const std::vector<GfHalf> ha = toHalfs(a);
+
+                EXPECT_EQ(
+                    kernels.compareFloatArray(a.data(), b.data(), count, count, 1e-5f),
+                    reference.compareFloatArray(a.data(), b.data(), count, count, 1e-5f));
+                EXPECT_EQ(
+                    kernels.compareDoubleArray(da.data(), db.data(), count, count, 1e-5),
+                    reference.compareDoubleArray(da.data(), db.data(), count, count, 1e-5));
+                EXPECT_EQ(
+                    kernels.compareHalfFloatArray(ha.data(), b.data(), count, count, 1e-2f),
+                    reference.compareHalfFloatArray(ha.data(), b.data(), count, count, 1e-2f));
+                EXPECT_EQ(
+                    kernels.compareHalfDoubleArray(ha.data(), db.data(), count, count, 1e-2),
+                    reference.compareHalfDoubleArray(ha.data(), db.data(), count, count, 1e-2));
+                EXPECT_EQ(
+                    kernels.compareUvArray(
+                        a.data(), a.data() + count, b.data(), count, count, 1e-5f),
+                    reference.compareUvArray(
+                        a.data(), a.data() + count, b.data(), count, count, 1e-5f));
+                EXPECT_EQ(
+                    kernels.compareArray3Dto4Dd(b.data(), da.data(), count, count, 1e-5f),
+                    reference.compareArray3Dto4Dd(b.data(), da.data(), count, count, 1e-5f));
+                EXPECT_EQ(
+                    kernels.compareRGBAArray(0.5f, 0.5f, 0.5f, 1.0f, b.data(), count, 0.6f),
+                    reference.compareRGBAArray(0.5f, 0.5f, 0.5f, 1.0f, b.data(), count, 0.6f));
+
+                if (count == 0) {
+                    break;
+                }
+                b[count - 1] += 1.0f;
+            }
+
+            // Mismatching sizes never compare equal.
+            EXPECT_FALSE(kernels.compareFloatArray(a.data(), a.data(), count, count + 1, 1e-5f));
+
+            std::vector<int32_t> ia(count), ib;
+            std::vector<int8_t>  ca(count), cb;
+            for (size_t i = 0; i < count; ++i) {
+                ia[i] = rand();
+                ca[i] = int8_t(rand());
+            }
+            ib = ia;
+            cb = ca;
+            if (count) {
+                ib[count / 2] += 1;
+                cb[count / 2] += 1;
+            }
+            EXPECT_EQ(
+                kernels.compareInt32Array(ia.data(), ib.data(), count, count),
+                reference.compareInt32Array(ia.data(), ib.data(), count, count));
+            EXPECT_EQ(
+                kernels.compareInt8Array(ca.data(), cb.data(), count, count),
+                reference.compareInt8Array(ca.data(), cb.data(), count, count));
+
+            const std::vector<float> u(count, 0.25f), v(count, 0.75f);
+            EXPECT_EQ(
+                kernels.compareUvArrayToValue(0.25f, 0.75f, u.data(), v.data(), count, 1e-5f),
+                reference.compareUvArrayToValue(0.25f, 0.75f, u.data(), v.data(), count, 1e-5f));
+            EXPECT_EQ(
+                kernels.compareUvArrayToValue(0.25f, 0.5f, u.data(), v.data(), count, 1e-5f),
+                reference.compareUvArrayToValue(0.25f, 0.5f, u.data(), v.data(), count, 1e-5f));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SIMDKernels, meshConversions)
+{
+    const SimdKernels& reference = scalarKernels();
+    for (const auto& isaKernels : vectorKernels()) {
+        const SimdKernels& kernels = *isaKernels.second;
+        SCOPED_TRACE(MayaUsdUtils::simdIsaName(isaKernels.first));
+
+        for (size_t count : testSizes) {
+            const std::vector<float> u = randomFloats(count);
+            const std::vector<float> v = randomFloats(count);
+
+            std::vector<float> uv(count * 2), expectedUv(count * 2);
+            kernels.zipUVs(u.data(), v.data(), uv.data(), count);
+            reference.zipUVs(u.data(), v.data(), expectedUv.data(), count);
+            EXPECT_EQ(uv, expectedUv);
+
+            std::vector<float> u2(count), v2(count);
+            kernels.unzipUVs(uv.data(), u2.data(), v2.data(), count);
+            EXPECT_EQ(u2, u);
+            EXPECT_EQ(v2, v);
+
+            std::vector<int32_t> indices(count);
+            for (size_t i = 0; i < count; ++i) {
+                indices[i] = int32_t(rand() % count);
+            }
+            std::vector<float> gathered(count * 2), expectedGathered(count * 2);
+            kernels.interleaveIndexedUvData(
+                gathered.data(), u.data(), v.data(), indices.data(), uint32_t(count));
+            reference.interleaveIndexedUvData(
+                expectedGathered.data(), u.data(), v.data(), indices.data(), uint32_t(count));
+            EXPECT_EQ(gathered, expectedGathered);
+
+            std::vector<double> doubles(count);
+            std::vector<float>  floats(count);
+            kernels.floatToDouble(doubles.data(), u.data(), count);
+            kernels.doubleToFloat(floats.data(), doubles.data(), count);
+            EXPECT_EQ(floats, u);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include <mayaUsdUtils/SIMDKernels.h>
+#include <mayaUsdUtils/SmoothNormals.h>
+
+#include <pxr/base/tf/errorMark.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/smoothNormals.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using MayaUsdUtils::SimdIsa;
+using MayaUsdUtils::SmoothNormals;
+
+namespace {
+
+inline float randFloat() { return float(rand()) / RAND_MAX; }
+
+// A bumpy grid of (size x size) points, mixing quads, triangles and, along the first row,
+// pentagons.
+struct TestMesh
+{
+    VtIntArray   faceVertexCounts;
+    VtIntArray   faceVertexIndices;
+    VtVec3fArray points;
+};
+
+TestMesh makeGrid(int size)
+{
+    TestMesh mesh;
+    for (int j = 0; j < size; ++j) {
+        for (int i = 0; i < size; ++i) {
+            mesh.points.push_back(GfVec3f(float(i), float(j), randFloat()));
+        }
+    }
+
+    auto index = [size](int i, int j) { return j * size + i; };
+    for (int j = 0; j + 1 < size; ++j) {
+        for (int i = 0; i + 1 < size; ++i) {
+            const int a = index(i, j), b = index(i + 1, j), c = index(i + 1, j + 1),
+                      d = index(i, j + 1);
+            if (j == 0 && i + 2 < size) {
+                // a pentagon spanning two cells
+                const int e = index(i + 2, j), f = index(i + 2, j + 1);
+                mesh.faceVertexCounts.push_back(5);
+                for (int v : { a, b, e, f, c }) {
+                    mesh.faceVertexIndices.push_back(v);
+                }
+                mesh.faceVertexCounts.push_back(3);
+                for (int v : { a, c, d }) {
+                    mesh.faceVertexIndices.push_back(v);
+                }
+                ++i;
+            } else if ((i + j) % 3 == 0) {
+                mesh.faceVertexCounts.push_back(3);
+                for (int v : { a, b, c }) {
+                    mesh.faceVertexIndices.push_back(v);
+                }
+                mesh.faceVertexCounts.push_back(3);
+                for (int v : { a, c, d }) {
+                    mesh.faceVertexIndices.push_back(v);
+                }
+            } else {
+                mesh.faceVertexCounts.push_back(4);
+                for (int v : { a, b, c, d }) {
+                    mesh.faceVertexIndices.push_back(v);
+                }
+            }
+        }
+    }
+    return mesh;
+}
+
+HdMeshTopology makeTopology(const TestMesh& mesh, bool leftHanded)
+{
+    return HdMeshTopology(
+        TfToken("catmullClark"),
+        leftHanded ? HdTokens->leftHanded : HdTokens->rightHanded,
+        mesh.faceVertexCounts,
+        mesh.faceVertexIndices);
+}
+
+SmoothNormals makeSmoothNormals(const TestMesh& mesh, bool leftHanded)
+{
+    return SmoothNormals(
+        mesh.faceVertexCounts.cdata(),
+        mesh.faceVertexCounts.size(),
+        mesh.faceVertexIndices.cdata(),
+        mesh.faceVertexIndices.size(),
+        leftHanded);
+}
+
+template <typename Vec> void expectNear(const VtArray<Vec>& expected, const VtArray<Vec>& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        for (size_t c = 0; c < 3; ++c) {
+            ASSERT_NEAR(expected[i][c], actual[i][c], 1e-5) << "point " << i;
+        }
+    }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SmoothNormals, matchesHdSmoothNormals)
+{
+    // 150 x 150 points goes through the multithreaded path
+    for (int size : { 2, 3, 10, 150 }) {
+        const TestMesh mesh = makeGrid(size);
+        for (bool leftHanded : { false, true }) {
+            SCOPED_TRACE(leftHanded ? "leftHanded" : "rightHanded");
+            const HdMeshTopology topology = makeTopology(mesh, leftHanded);
+            Hd_VertexAdjacency   adjacency;
+            adjacency.BuildAdjacencyTable(&topology);
+
+            const SmoothNormals smoothNormals = makeSmoothNormals(mesh, leftHanded);
+            ASSERT_TRUE(smoothNormals.isValid());
+            EXPECT_EQ(smoothNormals.numPoints(), mesh.points.size());
+
+            const VtVec3fArray expected = Hd_SmoothNormals::ComputeSmoothNormals(
+                &adjacency, mesh.points.size(), mesh.points.cdata());
+
+            // every instruction set available on this machine gives the same result
+            const SimdIsa active = MayaUsdUtils::activeSimdIsa();
+            for (SimdIsa isa : { SimdIsa::kScalar, SimdIsa::kSSE, SimdIsa::kAVX2 }) {
+                if (!MayaUsdUtils::setActiveSimdIsa(isa)) {
+                    continue;
+                }
+                SCOPED_TRACE(MayaUsdUtils::simdIsaName(isa));
+                VtVec3fArray normals(mesh.points.size());
+                EXPECT_TRUE(
+                    smoothNormals.compute(normals.data(), mesh.points.cdata(), normals.size()));
+                expectNear(expected, normals);
+            }
+            MayaUsdUtils::setActiveSimdIsa(active);
+
+            const VtVec3dArray pointsd(mesh.points.begin(), mesh.points.end());
+            const VtVec3dArray expectedd = Hd_SmoothNormals::ComputeSmoothNormals(
+                &adjacency, pointsd.size(), pointsd.cdata());
+            VtVec3dArray normalsd(pointsd.size());
+            EXPECT_TRUE(smoothNormals.compute(normalsd.data(), pointsd.cdata(), normalsd.size()));
+            expectNear(expectedd, normalsd);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(SmoothNormals, unreferencedAndMissingPoints)
+{
+    TestMesh mesh = makeGrid(4);
+    const SmoothNormals smoothNormals = makeSmoothNormals(mesh, false);
+
+    // extra points, not referenced by any face, get a zero normal
+    mesh.points.push_back(GfVec3f(1.0f, 2.0f, 3.0f));
+    VtVec3fArray normals(mesh.points.size());
+    EXPECT_TRUE(smoothNormals.compute(normals.data(), mesh.points.cdata(), normals.size()));
+    EXPECT_EQ(normals.back(), GfVec3f(0.0f));
+    EXPECT_NE(normals.front(), GfVec3f(0.0f));
+
+    // missing points leave all the normals to zero, without raising errors since the points are
+    // computed again on every frame
+    TfErrorMark mark;
+    normals.resize(mesh.points.size() - 2);
+    EXPECT_FALSE(smoothNormals.compute(normals.data(), mesh.points.cdata(), normals.size()));
+    for (const GfVec3f& normal : normals) {
+        EXPECT_EQ(normal, GfVec3f(0.0f));
+    }
+
+    VtVec3dArray pointsd(normals.size());
+    VtVec3dArray normalsd(normals.size());
+    EXPECT_FALSE(smoothNormals.compute(normalsd.data(), pointsd.cdata(), normalsd.size()));
+
+    // invalid topologies compute no normals either
+    const int           counts[] = { 3 };
+    const int           indices[] = { 0, -1, 2 };
+    const SmoothNormals invalid(counts, 1, indices, 3, false);
+    EXPECT_FALSE(invalid.isValid());
+    EXPECT_FALSE(invalid.compute(normals.data(), mesh.points.cdata(), normals.size()));
+    EXPECT_TRUE(mark.IsClean());
+}